@@ -0,0 +1,146 @@
+/**
+ * @file BancoAsincrono.hpp
+ * @brief Declaración de la clase BancoAsincrono con las operaciones bancarias como corrutinas.
+ * @details Este archivo contiene la declaración de la clase BancoAsincrono, que expone las operaciones
+ *          de Cuenta, Cliente y Prestamo como tareas que se esperan con `co_await`. Las operaciones que
+ *          modifican datos se ejecutan en orden en un pool de un solo hilo escritor y las consultas se
+ *          reparten entre un pool de lectores, de modo que un único hilo puede mantener miles de
+ *          operaciones en curso sin un hilo por sesión.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef BANCO_ASINCRONO_HPP
+#define BANCO_ASINCRONO_HPP
+
+#include "Ejecutor.hpp"
+#include "Tarea.hpp"
+#include <string>
+
+/**
+ * @struct ResultadoOperacion
+ * @brief Resultado de una operación asíncrona.
+ *
+ * - exito: Indica si la operación se realizó correctamente.
+ * - valor: Saldo de la cuenta después de la operación (o ID del cliente en `buscarCliente`).
+ * - detalle: Mensajes de error que la operación escribió con `flujoErrores()`.
+ */
+struct ResultadoOperacion {
+    bool exito = false;
+    double valor = 0;
+    std::string detalle;
+};
+
+/**
+ * @class BancoAsincrono
+ * @brief Operaciones bancarias asíncronas sobre un escritor serializado y un pool de lectores.
+ *
+ * Las escrituras se serializan porque los métodos de Cuenta calculan el nuevo saldo en memoria y
+ * dos escrituras simultáneas sobre la misma cuenta perderían una de ellas. Las corrutinas se
+ * reanudan en el Ejecutor indicado en el constructor.
+ */
+class BancoAsincrono {
+    private:
+        /// @brief Pool de un solo hilo para las operaciones que modifican datos.
+        PoolTrabajo escritor;
+
+        /// @brief Pool de hilos de solo lectura para las consultas.
+        PoolTrabajo lectores;
+
+    public:
+        /**
+         * @brief Constructor de la clase BancoAsincrono.
+         *
+         * @param ejecutor Ejecutor donde se reanudan las corrutinas.
+         * @param nombreDB Nombre del archivo de la base de datos (queda en modo WAL).
+         * @param hilosLectura Cantidad de hilos lectores.
+         * @throws std::runtime_error Si no se pueden abrir las conexiones.
+         */
+        BancoAsincrono(Ejecutor& ejecutor, const std::string& nombreDB, unsigned int hilosLectura);
+
+        /**
+         * @brief Consulta el saldo de una cuenta en el pool de lectores.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta.
+         */
+        Tarea<ResultadoOperacion> verSaldo(int idCuenta);
+
+        /**
+         * @brief Busca un cliente por su cédula en el pool de lectores.
+         *
+         * @param cedula Cédula del cliente.
+         * @return `Tarea<ResultadoOperacion>` ID del cliente.
+         */
+        Tarea<ResultadoOperacion> buscarCliente(int cedula);
+
+        /**
+         * @brief Deposita un monto en una cuenta.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @param monto Monto a depositar.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta después del depósito.
+         */
+        Tarea<ResultadoOperacion> depositar(int idCuenta, double monto);
+
+        /**
+         * @brief Retira un monto de una cuenta.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @param monto Monto a retirar.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta después del retiro.
+         */
+        Tarea<ResultadoOperacion> retirar(int idCuenta, double monto);
+
+        /**
+         * @brief Transfiere un monto entre dos cuentas.
+         *
+         * @param idCuenta ID de la cuenta de origen.
+         * @param idCuentaDestino ID de la cuenta de destino.
+         * @param monto Monto a transferir.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta de origen después de la transferencia.
+         */
+        Tarea<ResultadoOperacion> transferir(int idCuenta, int idCuentaDestino, double monto);
+
+        /**
+         * @brief Abona una cuota mensual de un préstamo desde una cuenta.
+         *
+         * @param idPrestamo ID del préstamo.
+         * @param idCuenta ID de la cuenta de la que se debita el abono.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta después del abono.
+         */
+        Tarea<ResultadoOperacion> abonarCuota(int idPrestamo, int idCuenta);
+
+        /**
+         * @brief Abona varias cuotas mensuales de un préstamo desde una cuenta.
+         *
+         * @param idPrestamo ID del préstamo.
+         * @param idCuenta ID de la cuenta de la que se debita el abono.
+         * @param cantidadCuotas Cantidad de cuotas a abonar.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta después del abono.
+         */
+        Tarea<ResultadoOperacion> abonarCuotas(int idPrestamo, int idCuenta, int cantidadCuotas);
+
+        /**
+         * @brief Solicita un CDP en la moneda de la cuenta.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @param monto Monto del CDP.
+         * @param plazoMeses Plazo del CDP en meses.
+         * @param tasaInteres Tasa de interés anual del CDP.
+         * @return `Tarea<ResultadoOperacion>` Saldo de la cuenta después de la solicitud.
+         */
+        Tarea<ResultadoOperacion> solicitarCDP(int idCuenta, double monto, int plazoMeses, double tasaInteres);
+
+        /**
+         * @brief Termina las operaciones pendientes y detiene los hilos de los pools.
+         *
+         * Las operaciones solicitadas después se ejecutan en el hilo que las solicita.
+         */
+        void cerrar();
+};
+
+#endif // BANCO_ASINCRONO_HPP
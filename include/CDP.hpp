@@ -15,10 +15,13 @@
 #define CDP_HPP
 
 #include "SQLiteStatement.hpp"
+#include "Codigos.hpp"
 #include <sqlite3.h>
 #include <fstream>
 #include <iomanip>
+#include <span>
 #include <string>
+#include <vector>
 
 /**
  * @class CDP
@@ -38,7 +41,7 @@ class CDP {
         int idCuenta;
 
         /// @brief Moneda del CDP
-        std::string moneda;
+        Moneda moneda;
 
         /// @brief Monto del depósito
         double deposito;
@@ -67,7 +70,7 @@ class CDP {
          * @param tasaInteres Tasa de interés anual del CDP.
          * @param fechaSolicitud Fecha en la que se solicita el CDP.
          */
-        CDP(int idCuenta, const std::string &moneda, double deposito, int plazoMeses, double tasaInteres);
+        CDP(int idCuenta, Moneda moneda, double deposito, int plazoMeses, double tasaInteres);
 
         
         /**
@@ -87,6 +90,17 @@ class CDP {
          */
         static CDP obtener(sqlite3* db, int idCDP);
 
+        /**
+         * @brief Método estático para obtener varios CDP en una sola consulta.
+         * 
+         * Los CDP se retornan en el orden de los IDs; los que no existen se omiten.
+         * 
+         * @param db Puntero a la base de datos.
+         * @param idsCDP IDs de los CDP.
+         * @return `std::vector<CDP>` CDP encontrados, o vacío si falló la consulta.
+         */
+        static std::vector<CDP> obtenerVarios(sqlite3* db, std::span<const int> idsCDP);
+
         /**
          * @brief Muestra la información del CDP en formato tabular en la terminal al consultar
          * su estado en el menú.
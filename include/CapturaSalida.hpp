@@ -0,0 +1,83 @@
+/**
+ * @file CapturaSalida.hpp
+ * @brief Declaración de la clase CapturaSalida para capturar los mensajes de las operaciones.
+ * @details Este archivo contiene la declaración de la clase CapturaSalida y de las funciones flujoSalida
+ *          y flujoErrores, que desvían los mensajes de las clases a flujos propios del hilo. Se utilizan
+ *          en los modos sin interacción, donde los mensajes que muestran los métodos de las clases no se
+ *          deben imprimir en la terminal.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef CAPTURA_SALIDA_HPP
+#define CAPTURA_SALIDA_HPP
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+/**
+ * @class CapturaSalida
+ * @brief Desvía a flujos propios del hilo los mensajes de las clases mientras el objeto exista.
+ *
+ * Las clases escriben sus mensajes con `flujoSalida()` y `flujoErrores()`, que retornan `std::cout` y
+ * `std::cerr` salvo que el hilo tenga una captura activa. Con la captura, la salida se descarta y los
+ * errores se guardan en un `std::ostringstream` del objeto. A diferencia de redirigir los flujos
+ * globales, cada hilo escribe en sus propios flujos, así que el estado de formato (`std::fixed`,
+ * `std::setprecision`, el ancho) no se comparte entre hilos.
+ *
+ * Solo se debe usar desde el hilo que la crea. Las capturas se pueden anidar; al destruirse se
+ * restaura la anterior.
+ */
+class CapturaSalida {
+    private:
+        /// @brief Flujo sin buffer que descarta la salida sin costo de formato.
+        std::ostream descarte;
+
+        /// @brief Mensajes de error escritos por el hilo durante la captura.
+        std::ostringstream errores;
+
+        /// @brief Flujos activos del hilo antes de la captura.
+        std::ostream* salidaAnterior;
+        std::ostream* erroresAnterior;
+
+    public:
+        /**
+         * @brief Constructor que activa la captura para el hilo actual.
+         */
+        CapturaSalida();
+
+        /**
+         * @brief Destructor que restaura los flujos anteriores del hilo.
+         */
+        ~CapturaSalida();
+
+        CapturaSalida(const CapturaSalida&) = delete;
+        CapturaSalida& operator=(const CapturaSalida&) = delete;
+
+        /**
+         * @brief Retorna y limpia los mensajes de error guardados, sin los saltos de línea finales.
+         *
+         * @return `std::string` Mensajes de error de la captura.
+         */
+        std::string tomarErrores();
+};
+
+/**
+ * @brief Retorna el flujo para la salida normal de las clases en el hilo actual.
+ *
+ * @return `std::ostream&` Flujo de la captura activa del hilo, o `std::cout` si no hay ninguna.
+ */
+std::ostream& flujoSalida();
+
+/**
+ * @brief Retorna el flujo para los mensajes de error de las clases en el hilo actual.
+ *
+ * @return `std::ostream&` Flujo de la captura activa del hilo, o `std::cerr` si no hay ninguna.
+ */
+std::ostream& flujoErrores();
+
+#endif // CAPTURA_SALIDA_HPP
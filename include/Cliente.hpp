@@ -15,7 +15,9 @@
 #ifndef CLIENTE_HPP
 #define CLIENTE_HPP
 
+#include <span>
 #include <string>
+#include <vector>
 #include <sqlite3.h>
 
 /**
@@ -81,6 +83,17 @@ class Cliente {
          */
         static Cliente obtener(sqlite3* db, int cedula);
 
+        /**
+         * @brief Obtiene varios clientes en una sola consulta a partir de sus cédulas.
+         * 
+         * Los clientes se retornan en el orden de las cédulas; las que no están registradas se omiten.
+         * 
+         * @param db Conexión a la base de datos SQLite.
+         * @param cedulas Números de cédula de los clientes a buscar.
+         * @return Vector con los clientes encontrados, o vacío si falló la consulta.
+         */
+        static std::vector<Cliente> obtenerVarios(sqlite3* db, std::span<const int> cedulas);
+
         /**
          * @brief Verifica si un cliente existe en la base de datos.
          * 
@@ -93,6 +106,21 @@ class Cliente {
          */
         static bool existe(sqlite3* db, int cedula);
 
+        /**
+         * @brief Busca clientes por nombre, apellidos o teléfono.
+         * 
+         * Utiliza el índice de texto completo BusquedaClientes. Cada palabra del texto se busca como
+         * prefijo, sin distinguir mayúsculas ni tildes, y un cliente debe coincidir con todas las
+         * palabras; por ejemplo, "ana mor" encuentra a "Ana Mora Jiménez" y "8888-12" a los teléfonos
+         * que empiezan con esos dígitos. Los resultados se ordenan por relevancia.
+         * 
+         * @param db Conexión a la base de datos SQLite.
+         * @param texto Texto a buscar.
+         * @param limite Cantidad máxima de resultados.
+         * @return `std::vector<Cliente>` Clientes encontrados, vacío si no hay coincidencias.
+         */
+        static std::vector<Cliente> buscar(sqlite3* db, const std::string& texto, int limite = 20);
+
         /**
          * @brief Retorna la cédula del cliente.
          * 
@@ -107,6 +135,20 @@ class Cliente {
          */
         int getID() const;
 
+        /**
+         * @brief Retorna el nombre y los apellidos del cliente.
+         * 
+         * @return `std::string` Nombre completo
+         */
+        std::string getNombreCompleto() const;
+
+        /**
+         * @brief Retorna el número de teléfono del cliente.
+         * 
+         * @return `std::string` telefono
+         */
+        std::string getTelefono() const;
+
 };
 
 #endif // CLIENTE_HPP
\ No newline at end of file
@@ -0,0 +1,137 @@
+/**
+ * @file Cliente360.hpp
+ * @brief Declaración de la clase Cliente360 para obtener la vista completa de un cliente.
+ * @details Este archivo contiene la declaración de la clase Cliente360, que carga un cliente con todas
+ *          sus cuentas, CDP, préstamos y movimientos recientes en tres consultas, en lugar de obtener
+ *          el cliente y luego cada cuenta, CDP y préstamo por separado.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef CLIENTE_360_HPP
+#define CLIENTE_360_HPP
+
+#include "Codigos.hpp"
+#include <sqlite3.h>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad predeterminada de movimientos recientes de la vista.
+constexpr int MOVIMIENTOS_RECIENTES_360 = 10;
+
+/**
+ * @struct CuentaCliente360
+ * @brief Cuenta de un cliente.
+ */
+struct CuentaCliente360 {
+    int idCuenta = 0;
+    Moneda moneda = Moneda::CRC;
+    double saldo = 0.0;
+    double tasaInteres = 0.0;
+};
+
+/**
+ * @struct CDPCliente360
+ * @brief Certificado de depósito a plazo de una cuenta del cliente.
+ */
+struct CDPCliente360 {
+    int idCDP = 0;
+    int idCuenta = 0;
+    Moneda moneda = Moneda::CRC;
+    double deposito = 0.0;
+    int plazoMeses = 0;
+    double tasaInteres = 0.0;
+};
+
+/**
+ * @struct PrestamoCliente360
+ * @brief Préstamo asociado a una cuenta del cliente.
+ */
+struct PrestamoCliente360 {
+    int idPrestamo = 0;
+    int idCuenta = 0;
+    TipoPrestamo tipo = TipoPrestamo::PERSONAL;
+    Moneda moneda = Moneda::CRC;
+    double monto = 0.0;
+    double tasaInteres = 0.0;
+    int plazoMeses = 0;
+    double cuotaMensual = 0.0;
+    int cuotasPagadas = 0;
+    double capitalPagado = 0.0;
+    double interesesPagados = 0.0;
+    bool activo = false;
+    std::string fechaProximoPago;
+    int diasAtraso = 0;
+};
+
+/**
+ * @struct MovimientoCliente360
+ * @brief Movimiento de una cuenta del cliente.
+ *
+ * - contraparte: Cuenta de la contraparte, o 0 en depósitos y retiros.
+ * - monto: Positivo para los créditos y negativo para los débitos de la cuenta.
+ */
+struct MovimientoCliente360 {
+    long long idTransaccion = 0;
+    std::string fecha;
+    int idCuenta = 0;
+    TipoTransaccion tipo = TipoTransaccion::DEPOSITO;
+    int contraparte = 0;
+    double monto = 0.0;
+};
+
+/**
+ * @struct VistaCliente360
+ * @brief Datos del cliente con sus cuentas, CDP, préstamos y movimientos recientes.
+ *
+ * Los CDP y préstamos se ordenan por ID y los movimientos del más reciente al más antiguo.
+ */
+struct VistaCliente360 {
+    int idCliente = 0;
+    int cedula = 0;
+    std::string nombre;
+    std::string primerApellido;
+    std::string segundoApellido;
+    std::string telefono;
+    std::vector<CuentaCliente360> cuentas;
+    std::vector<CDPCliente360> cdps;
+    std::vector<PrestamoCliente360> prestamos;
+    std::vector<MovimientoCliente360> movimientos;
+};
+
+/**
+ * @class Cliente360
+ * @brief Carga y muestra la vista completa de un cliente.
+ *
+ * Las consultas se ejecutan dentro de un savepoint, por lo que la vista es consistente aunque otras
+ * conexiones modifiquen los datos mientras se carga:
+ * 1. El cliente con sus cuentas (`LEFT JOIN`).
+ * 2. Los CDP y préstamos de sus cuentas (`UNION ALL` con una subconsulta de las cuentas del cliente).
+ * 3. Los últimos movimientos, tomando los más recientes de cada cuenta con sus índices `(cuenta, fecha)`.
+ */
+class Cliente360 {
+    public:
+        /**
+         * @brief Carga la vista completa de un cliente a partir de su cédula.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param cedula Cédula del cliente.
+         * @param vista Vista del cliente.
+         * @param movimientos Cantidad de movimientos recientes a cargar.
+         * @return `true` si se encontró el cliente, `false` si no existe o falló la consulta.
+         */
+        static bool cargar(sqlite3* db, int cedula, VistaCliente360& vista, int movimientos = MOVIMIENTOS_RECIENTES_360);
+
+        /**
+         * @brief Muestra la vista de un cliente en la terminal.
+         *
+         * @param vista Vista del cliente.
+         * @return `void`
+         */
+        static void mostrar(const VistaCliente360& vista);
+};
+
+#endif // CLIENTE_360_HPP
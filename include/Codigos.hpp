@@ -0,0 +1,264 @@
+/**
+ * @file Codigos.hpp
+ * @brief Enumeraciones compactas de las monedas y los tipos de préstamo y de transacción.
+ * @details Este archivo contiene las enumeraciones de un byte que reemplazan los códigos de tres letras
+ *          ('CRC', 'PER', 'DEP', ...) en las clases del programa, junto con las funciones `constexpr`
+ *          para convertirlas desde y hacia los códigos de texto y los valores enteros con los que se
+ *          almacenan en la base de datos.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef CODIGOS_HPP
+#define CODIGOS_HPP
+
+#include "constants.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @enum Moneda
+ * @brief Monedas de las cuentas, CDP y préstamos.
+ *
+ * Los valores coinciden con el índice del código en `MONEDAS`.
+ */
+enum class Moneda : uint8_t {
+    CRC,
+    USD
+};
+
+/**
+ * @enum TipoTransaccion
+ * @brief Tipos de transacción de la tabla Transacciones.
+ *
+ * - DEPOSITO: 'DEP'.
+ * - RETIRO: 'RET'.
+ * - TRANSFERENCIA: 'TRA'.
+ * - ABONO: 'ABO', abono a un préstamo.
+ * - CDP: 'CDP', depósito de un certificado de depósito a plazo.
+ */
+enum class TipoTransaccion : uint8_t {
+    DEPOSITO,
+    RETIRO,
+    TRANSFERENCIA,
+    ABONO,
+    CDP
+};
+
+/// @brief Cantidad de monedas ('CRC', 'USD').
+constexpr int CANTIDAD_MONEDAS = 2;
+
+/// @brief Códigos de las monedas en el orden de `Moneda`.
+constexpr const char* MONEDAS[CANTIDAD_MONEDAS] = {"CRC", "USD"};
+
+/// @brief Cantidad de tipos de préstamo ('PER', 'PRE', 'HIP').
+constexpr int CANTIDAD_TIPOS_PRESTAMO = 3;
+
+/// @brief Códigos de los tipos de préstamo en el orden de `TipoPrestamo`.
+constexpr const char* TIPOS_PRESTAMO[CANTIDAD_TIPOS_PRESTAMO] = {"PER", "PRE", "HIP"};
+
+/// @brief Cantidad de tipos de transacción.
+constexpr int CANTIDAD_TIPOS_TRANSACCION = 5;
+
+/// @brief Códigos de los tipos de transacción en el orden de `TipoTransaccion`.
+constexpr const char* TIPOS_TRANSACCION[CANTIDAD_TIPOS_TRANSACCION] = {"DEP", "RET", "TRA", "ABO", "CDP"};
+
+/**
+ * @brief Busca un código en una lista de códigos de tres letras.
+ *
+ * @param codigo Código a buscar.
+ * @param codigos Lista de códigos.
+ * @param cantidad Cantidad de códigos de la lista.
+ * @return `int` Índice del código en la lista, o -1 si no está.
+ */
+constexpr int indiceCodigo(std::string_view codigo, const char* const* codigos, int cantidad) {
+    if (codigo.size() != 3) {
+        return -1;
+    }
+    for (int i = 0; i < cantidad; i++) {
+        if (codigo[0] == codigos[i][0] && codigo[1] == codigos[i][1] && codigo[2] == codigos[i][2]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Retorna el código de una moneda.
+ *
+ * @param moneda Moneda.
+ * @return `const char*` Código de la moneda ('CRC', 'USD'), con duración estática.
+ */
+constexpr const char* codigo(Moneda moneda) {
+    return MONEDAS[static_cast<int>(moneda)];
+}
+
+/**
+ * @brief Retorna el código de un tipo de préstamo.
+ *
+ * @param tipo Tipo de préstamo.
+ * @return `const char*` Código del tipo ('PER', 'PRE', 'HIP'), con duración estática.
+ */
+constexpr const char* codigo(TipoPrestamo tipo) {
+    return TIPOS_PRESTAMO[static_cast<int>(tipo) - static_cast<int>(TipoPrestamo::PERSONAL)];
+}
+
+/**
+ * @brief Retorna el código de un tipo de transacción.
+ *
+ * @param tipo Tipo de transacción.
+ * @return `const char*` Código del tipo ('DEP', 'RET', 'TRA', 'ABO', 'CDP'), con duración estática.
+ */
+constexpr const char* codigo(TipoTransaccion tipo) {
+    return TIPOS_TRANSACCION[static_cast<int>(tipo)];
+}
+
+/**
+ * @brief Obtiene una moneda a partir de su código.
+ *
+ * @param codigo Código de la moneda ('CRC', 'USD').
+ * @return `Moneda` Moneda correspondiente.
+ * @throws std::invalid_argument Si el código no corresponde a una moneda.
+ */
+constexpr Moneda monedaSegunCodigo(std::string_view codigo) {
+    int indice = indiceCodigo(codigo, MONEDAS, CANTIDAD_MONEDAS);
+    if (indice < 0) {
+        throw std::invalid_argument("Error: Moneda inválida: " + std::string(codigo) + ".");
+    }
+    return static_cast<Moneda>(indice);
+}
+
+/**
+ * @brief Obtiene un tipo de préstamo a partir de su código.
+ *
+ * @param codigo Código del tipo de préstamo ('PER', 'PRE', 'HIP').
+ * @return `TipoPrestamo` Tipo correspondiente.
+ * @throws std::invalid_argument Si el código no corresponde a un tipo de préstamo.
+ */
+constexpr TipoPrestamo tipoPrestamoSegunCodigo(std::string_view codigo) {
+    int indice = indiceCodigo(codigo, TIPOS_PRESTAMO, CANTIDAD_TIPOS_PRESTAMO);
+    if (indice < 0) {
+        throw std::invalid_argument("Error: Tipo de préstamo inválido: " + std::string(codigo) + ".");
+    }
+    return static_cast<TipoPrestamo>(indice + static_cast<int>(TipoPrestamo::PERSONAL));
+}
+
+/**
+ * @brief Obtiene un tipo de transacción a partir de su código.
+ *
+ * @param codigo Código del tipo de transacción ('DEP', 'RET', 'TRA', 'ABO', 'CDP').
+ * @return `TipoTransaccion` Tipo correspondiente.
+ * @throws std::invalid_argument Si el código no corresponde a un tipo de transacción.
+ */
+constexpr TipoTransaccion tipoTransaccionSegunCodigo(std::string_view codigo) {
+    int indice = indiceCodigo(codigo, TIPOS_TRANSACCION, CANTIDAD_TIPOS_TRANSACCION);
+    if (indice < 0) {
+        throw std::invalid_argument("Error: Tipo de transacción inválido: " + std::string(codigo) + ".");
+    }
+    return static_cast<TipoTransaccion>(indice);
+}
+
+/**
+ * @brief Retorna el valor con el que se almacena una moneda en la base de datos.
+ *
+ * @param moneda Moneda.
+ * @return `int` Valor de la columna `moneda` (0 = 'CRC', 1 = 'USD').
+ */
+constexpr int valor(Moneda moneda) {
+    return static_cast<int>(moneda);
+}
+
+/**
+ * @brief Retorna el valor con el que se almacena un tipo de préstamo en la base de datos.
+ *
+ * @param tipo Tipo de préstamo.
+ * @return `int` Valor de la columna `tipo` de Prestamos (1 = 'PER', 2 = 'PRE', 3 = 'HIP').
+ */
+constexpr int valor(TipoPrestamo tipo) {
+    return static_cast<int>(tipo);
+}
+
+/**
+ * @brief Retorna el valor con el que se almacena un tipo de transacción en la base de datos.
+ *
+ * @param tipo Tipo de transacción.
+ * @return `int` Valor de la columna `tipo` de Transacciones (0 = 'DEP' ... 4 = 'CDP').
+ */
+constexpr int valor(TipoTransaccion tipo) {
+    return static_cast<int>(tipo);
+}
+
+/**
+ * @brief Obtiene una moneda a partir del valor almacenado en la base de datos.
+ *
+ * @param valorMoneda Valor de la columna `moneda`.
+ * @return `Moneda` Moneda correspondiente.
+ * @throws std::invalid_argument Si el valor no corresponde a una moneda.
+ */
+constexpr Moneda monedaSegunValor(int valorMoneda) {
+    if (valorMoneda < 0 || valorMoneda >= CANTIDAD_MONEDAS) {
+        throw std::invalid_argument("Error: Moneda inválida: " + std::to_string(valorMoneda) + ".");
+    }
+    return static_cast<Moneda>(valorMoneda);
+}
+
+/**
+ * @brief Obtiene un tipo de préstamo a partir del valor almacenado en la base de datos.
+ *
+ * @param valorTipo Valor de la columna `tipo` de Prestamos.
+ * @return `TipoPrestamo` Tipo correspondiente.
+ * @throws std::invalid_argument Si el valor no corresponde a un tipo de préstamo.
+ */
+constexpr TipoPrestamo tipoPrestamoSegunValor(int valorTipo) {
+    int indice = valorTipo - valor(TipoPrestamo::PERSONAL);
+    if (indice < 0 || indice >= CANTIDAD_TIPOS_PRESTAMO) {
+        throw std::invalid_argument("Error: Tipo de préstamo inválido: " + std::to_string(valorTipo) + ".");
+    }
+    return static_cast<TipoPrestamo>(valorTipo);
+}
+
+/**
+ * @brief Obtiene un tipo de transacción a partir del valor almacenado en la base de datos.
+ *
+ * @param valorTipo Valor de la columna `tipo` de Transacciones.
+ * @return `TipoTransaccion` Tipo correspondiente.
+ * @throws std::invalid_argument Si el valor no corresponde a un tipo de transacción.
+ */
+constexpr TipoTransaccion tipoTransaccionSegunValor(int valorTipo) {
+    if (valorTipo < 0 || valorTipo >= CANTIDAD_TIPOS_TRANSACCION) {
+        throw std::invalid_argument("Error: Tipo de transacción inválido: " + std::to_string(valorTipo) + ".");
+    }
+    return static_cast<TipoTransaccion>(valorTipo);
+}
+
+/**
+ * @brief Construye una expresión SQL que convierte una columna codificada en su código de texto.
+ *
+ * Por ejemplo, `expresionCodigos("moneda", MONEDAS, CANTIDAD_MONEDAS)` retorna
+ * `CASE moneda WHEN 0 THEN 'CRC' WHEN 1 THEN 'USD' END`.
+ *
+ * @param columna Nombre de la columna.
+ * @param codigos Lista de códigos en el orden de sus valores.
+ * @param cantidad Cantidad de códigos de la lista.
+ * @param primerValor Valor almacenado del primer código de la lista.
+ * @return `std::string` Expresión SQL.
+ */
+inline std::string expresionCodigos(const std::string& columna, const char* const* codigos, int cantidad, int primerValor = 0) {
+    std::string expresion = "CASE " + columna;
+    for (int i = 0; i < cantidad; i++) {
+        expresion += " WHEN " + std::to_string(primerValor + i) + " THEN '" + codigos[i] + "'";
+    }
+    return expresion + " END";
+}
+
+static_assert(monedaSegunCodigo(codigo(Moneda::USD)) == Moneda::USD);
+static_assert(tipoPrestamoSegunCodigo(codigo(TipoPrestamo::HIPOTECARIO)) == TipoPrestamo::HIPOTECARIO);
+static_assert(tipoTransaccionSegunCodigo(codigo(TipoTransaccion::CDP)) == TipoTransaccion::CDP);
+static_assert(tipoPrestamoSegunValor(valor(TipoPrestamo::PERSONAL)) == TipoPrestamo::PERSONAL);
+
+#endif // CODIGOS_HPP
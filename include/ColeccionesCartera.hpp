@@ -0,0 +1,175 @@
+/**
+ * @file ColeccionesCartera.hpp
+ * @brief Declaración de las colecciones en memoria de cuentas y préstamos en formato columnar.
+ * @details Este archivo contiene la declaración de las estructuras ColeccionCuentas y ColeccionPrestamos,
+ *          que guardan millones de filas como una columna (vector) por atributo, con las monedas y
+ *          los tipos codificados en un byte. Un recorrido que solo usa algunos atributos lee
+ *          únicamente esas columnas, en lugar de objetos Cuenta o Prestamo completos.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef COLECCIONES_CARTERA_HPP
+#define COLECCIONES_CARTERA_HPP
+
+#include "Codigos.hpp"
+#include <sqlite3.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct ColeccionCuentas
+ * @brief Cuentas en memoria, una columna por atributo y ordenadas por ID.
+ *
+ * La fila `i` de la colección está formada por la posición `i` de cada columna.
+ */
+struct ColeccionCuentas {
+    /// @brief ID de cada cuenta.
+    std::vector<int> idCuenta;
+
+    /// @brief ID del cliente de cada cuenta.
+    std::vector<int> idCliente;
+
+    /// @brief Moneda de cada cuenta.
+    std::vector<Moneda> moneda;
+
+    /// @brief Saldo de cada cuenta.
+    std::vector<double> saldo;
+
+    /// @brief Tasa de interés de cada cuenta.
+    std::vector<double> tasaInteres;
+
+    /**
+     * @brief Carga todas las cuentas desde la base de datos.
+     *
+     * Reemplaza cualquier colección cargada anteriormente.
+     *
+     * @param db Conexión a la base de datos SQLite.
+     * @return `true` si la carga fue exitosa, `false` en caso contrario.
+     */
+    bool cargar(sqlite3* db);
+
+    /**
+     * @brief Retorna la cantidad de cuentas cargadas.
+     *
+     * @return `size_t` Cantidad de cuentas.
+     */
+    size_t cantidad() const;
+
+    /**
+     * @brief Busca una cuenta por su ID.
+     *
+     * @param id ID de la cuenta.
+     * @return `size_t` Posición de la cuenta en las columnas, o `cantidad()` si no está cargada.
+     */
+    size_t buscar(int id) const;
+
+    /**
+     * @brief Suma los saldos de las cuentas de una moneda.
+     *
+     * @param monedaSaldo Moneda de las cuentas.
+     * @return `double` Saldo total.
+     */
+    double saldoTotal(Moneda monedaSaldo) const;
+
+    /**
+     * @brief Retorna los bytes reservados por las columnas.
+     *
+     * @return `size_t` Memoria utilizada.
+     */
+    size_t memoria() const;
+};
+
+/**
+ * @struct ColeccionPrestamos
+ * @brief Préstamos en memoria, una columna por atributo y ordenados por ID.
+ *
+ * La fila `i` de la colección está formada por la posición `i` de cada columna. No incluye la fecha
+ * del próximo pago, que solo se utiliza al abonar un préstamo o actualizar la mora.
+ */
+struct ColeccionPrestamos {
+    /// @brief ID de cada préstamo.
+    std::vector<int> idPrestamo;
+
+    /// @brief ID de la cuenta de cada préstamo.
+    std::vector<int> idCuenta;
+
+    /// @brief Tipo de cada préstamo.
+    std::vector<TipoPrestamo> tipo;
+
+    /// @brief Moneda de cada préstamo.
+    std::vector<Moneda> moneda;
+
+    /// @brief 1 si el préstamo está activo, 0 si ya se pagó.
+    std::vector<uint8_t> activo;
+
+    /// @brief Monto solicitado de cada préstamo.
+    std::vector<double> monto;
+
+    /// @brief Tasa de interés anual de cada préstamo.
+    std::vector<double> tasaInteres;
+
+    /// @brief Cuota mensual de cada préstamo.
+    std::vector<double> cuotaMensual;
+
+    /// @brief Capital pagado de cada préstamo.
+    std::vector<double> capitalPagado;
+
+    /// @brief Intereses pagados de cada préstamo.
+    std::vector<double> interesesPagados;
+
+    /// @brief Plazo en meses de cada préstamo.
+    std::vector<int> plazoMeses;
+
+    /// @brief Cuotas pagadas de cada préstamo.
+    std::vector<int> cuotasPagadas;
+
+    /// @brief Días de atraso de la próxima cuota de cada préstamo.
+    std::vector<int> diasAtraso;
+
+    /**
+     * @brief Carga los préstamos desde la base de datos.
+     *
+     * Reemplaza cualquier colección cargada anteriormente.
+     *
+     * @param db Conexión a la base de datos SQLite.
+     * @param soloActivos `true` para cargar únicamente los préstamos activos.
+     * @return `true` si la carga fue exitosa, `false` en caso contrario.
+     */
+    bool cargar(sqlite3* db, bool soloActivos = false);
+
+    /**
+     * @brief Retorna la cantidad de préstamos cargados.
+     *
+     * @return `size_t` Cantidad de préstamos.
+     */
+    size_t cantidad() const;
+
+    /**
+     * @brief Busca un préstamo por su ID.
+     *
+     * @param id ID del préstamo.
+     * @return `size_t` Posición del préstamo en las columnas, o `cantidad()` si no está cargado.
+     */
+    size_t buscar(int id) const;
+
+    /**
+     * @brief Suma el saldo pendiente (monto - capital pagado) de los préstamos activos de una moneda.
+     *
+     * @param monedaSaldo Moneda de los préstamos.
+     * @return `double` Saldo pendiente total.
+     */
+    double saldoPendiente(Moneda monedaSaldo) const;
+
+    /**
+     * @brief Retorna los bytes reservados por las columnas.
+     *
+     * @return `size_t` Memoria utilizada.
+     */
+    size_t memoria() const;
+};
+
+#endif // COLECCIONES_CARTERA_HPP
@@ -0,0 +1,72 @@
+/**
+ * @file Concurrencia.hpp
+ * @brief Control de concurrencia optimista de las cuentas y los préstamos.
+ * @details Este archivo contiene la excepción que lanzan `Cuenta` y `Prestamo` cuando otra sesión
+ *          modificó la fila desde que se leyó, y la función que decide si la operación se reintenta.
+ *          Cada fila de `Cuentas` y `Prestamos` tiene una columna `version` que se incrementa en cada
+ *          actualización; las actualizaciones solo se aplican si la versión es la que se leyó
+ *          (`WHERE ... AND version = ?`), por lo que dos sesiones sobre la misma cuenta no se
+ *          sobrescriben sin necesidad de un bloqueo global.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef CONCURRENCIA_HPP
+#define CONCURRENCIA_HPP
+
+#include "CapturaSalida.hpp"
+#include <iostream>
+#include <sqlite3.h>
+#include <stdexcept>
+#include <string>
+
+/// @brief Cantidad de veces que se reintenta una operación después de un conflicto de versión.
+constexpr int REINTENTOS_CONCURRENCIA = 3;
+
+/**
+ * @class ConflictoVersion
+ * @brief Excepción lanzada cuando una actualización no encuentra la fila con la versión leída.
+ *
+ * Los métodos que actualizan una fila la dejan pasar sin deshacer la transacción, para que la
+ * operación que los llamó recargue los datos y se reintente.
+ */
+class ConflictoVersion : public std::runtime_error {
+    public:
+        /**
+         * @brief Constructor de la excepción.
+         *
+         * @param mensaje Descripción de la fila que cambió.
+         */
+        explicit ConflictoVersion(const std::string& mensaje) : std::runtime_error(mensaje) {}
+};
+
+/**
+ * @brief Deshace la transacción de una operación en conflicto y decide si se reintenta.
+ *
+ * La operación que llama debe recargar sus datos de la base de datos antes de reintentar.
+ *
+ * @param db Conexión a la base de datos SQLite.
+ * @param conflicto Excepción lanzada por la actualización.
+ * @param intento Número del intento que falló, comenzando en 1.
+ * @return `true` si quedan reintentos, `false` en caso contrario.
+ */
+inline bool reintentarConflicto(sqlite3* db, const ConflictoVersion& conflicto, int intento) {
+    // La transacción puede haber terminado ya si el conflicto ocurrió fuera de ella
+    if (!sqlite3_get_autocommit(db) && sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        flujoErrores() << "Error: No se pudo realizar el rollback." << std::endl;
+    }
+
+    if (intento > REINTENTOS_CONCURRENCIA) {
+        flujoErrores() << "Error: " << conflicto.what() << " La operación no se completó después de "
+                  << intento << " intentos." << std::endl;
+        return false;
+    }
+
+    flujoSalida() << conflicto.what() << " Se reintenta con los datos actuales." << std::endl;
+    return true;
+}
+
+#endif // CONCURRENCIA_HPP
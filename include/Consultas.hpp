@@ -0,0 +1,218 @@
+/**
+ * @file Consultas.hpp
+ * @brief Sentencias SQL de las clases del programa y registro para verificar sus planes de ejecución.
+ * @details Este archivo contiene el texto de las sentencias SQL de Cuenta, Cliente, Prestamo, CDP,
+ *          PagoPrestamo y Transaccion, junto con las consultas del estado de cuenta y de la mora. Las
+ *          clases preparan sus sentencias con estas constantes y `CONSULTAS` las enumera, por lo que
+ *          `PlanesConsulta` verifica exactamente el mismo texto que ejecuta el programa.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef CONSULTAS_HPP
+#define CONSULTAS_HPP
+
+#include <vector>
+
+// Cuenta
+
+/// @brief Inserta una cuenta.
+constexpr const char* SQL_CREAR_CUENTA = "INSERT INTO Cuentas (idCliente, moneda, saldo, tasaInteres) VALUES (?, ?, ?, ?);";
+
+/// @brief Obtiene una cuenta por su ID.
+constexpr const char* SQL_OBTENER_CUENTA = "SELECT idCliente, moneda, saldo, tasaInteres, version FROM Cuentas WHERE idCuenta = ?;";
+
+/// @brief Obtiene varias cuentas a partir de un arreglo JSON de IDs; j.key conserva el orden de la lista.
+constexpr const char* SQL_OBTENER_CUENTAS = "SELECT c.idCuenta, c.idCliente, c.moneda, c.saldo, c.tasaInteres, c.version "
+                                            "FROM json_each(?) AS j JOIN Cuentas c ON c.idCuenta = j.value ORDER BY j.key;";
+
+/// @brief Verifica si existe una cuenta.
+constexpr const char* SQL_EXISTE_CUENTA = "SELECT COUNT(1) FROM Cuentas WHERE idCuenta = ?;";
+
+/// @brief Actualiza el saldo de una cuenta si su versión no cambió desde que se leyó, e incrementa la versión.
+constexpr const char* SQL_ACTUALIZAR_SALDO = "UPDATE Cuentas SET saldo = ?, version = version + 1 WHERE idCuenta = ? AND version = ?;";
+
+/// @brief Suma al saldo de una cuenta los movimientos de un lote del libro mayor e incrementa la versión.
+constexpr const char* SQL_SUMAR_SALDO = "UPDATE Cuentas SET saldo = saldo + ?, version = version + 1 WHERE idCuenta = ?;";
+
+/// @brief Cuenta las cuentas de un cliente en una moneda.
+constexpr const char* SQL_CUENTAS_SEGUN_MONEDA = "SELECT COUNT(*) FROM Cuentas WHERE idCliente = ? AND moneda = ?;";
+
+/// @brief Verifica si una cuenta está en una moneda.
+constexpr const char* SQL_COMPATIBILIDAD_MONEDA = "SELECT COUNT(*) FROM Cuentas WHERE idCuenta = ? AND moneda = ?;";
+
+/// @brief Transacciones en las que participa una cuenta.
+constexpr const char* SQL_HISTORIAL_CUENTA = "SELECT * FROM Transacciones WHERE idRemitente = ? OR idDestinatario = ?;";
+
+// Cliente
+
+/// @brief Inserta un cliente.
+constexpr const char* SQL_CREAR_CLIENTE = "INSERT INTO Clientes (cedula, nombre, primerApellido, segundoApellido, telefono) VALUES (?, ?, ?, ?, ?);";
+
+/// @brief Obtiene un cliente por su cédula.
+constexpr const char* SQL_OBTENER_CLIENTE = "SELECT idCliente, nombre, primerApellido, segundoApellido, telefono FROM Clientes WHERE cedula = ?;";
+
+/// @brief Obtiene varios clientes a partir de un arreglo JSON de cédulas; j.key conserva el orden de la lista.
+constexpr const char* SQL_OBTENER_CLIENTES = "SELECT c.idCliente, c.cedula, c.nombre, c.primerApellido, c.segundoApellido, c.telefono "
+                                             "FROM json_each(?) AS j JOIN Clientes c ON c.cedula = j.value ORDER BY j.key;";
+
+/// @brief Verifica si existe un cliente con una cédula.
+constexpr const char* SQL_EXISTE_CLIENTE = "SELECT COUNT(1) FROM Clientes WHERE cedula = ?;";
+
+/// @brief Busca clientes en el índice de texto completo, ordenados por relevancia.
+constexpr const char* SQL_BUSCAR_CLIENTES = "SELECT c.idCliente, c.cedula, c.nombre, c.primerApellido, c.segundoApellido, c.telefono "
+                                            "FROM BusquedaClientes JOIN Clientes c ON c.idCliente = BusquedaClientes.rowid "
+                                            "WHERE BusquedaClientes MATCH ? ORDER BY rank LIMIT ?;";
+
+// Prestamo
+
+/// @brief Inserta un préstamo.
+constexpr const char* SQL_CREAR_PRESTAMO = "INSERT INTO Prestamos (idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, "
+                                           "cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, activo) "
+                                           "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+
+/// @brief Verifica si existe un préstamo.
+constexpr const char* SQL_EXISTE_PRESTAMO = "SELECT COUNT(1) FROM Prestamos WHERE idPrestamo = ?;";
+
+/// @brief Obtiene un préstamo por su ID.
+constexpr const char* SQL_OBTENER_PRESTAMO = "SELECT idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, cuotaMensual, "
+                                             "cuotasPagadas, capitalPagado, interesesPagados, activo, fechaProximoPago, diasAtraso, version "
+                                             "FROM Prestamos WHERE idPrestamo = ?;";
+
+/// @brief Obtiene varios préstamos a partir de un arreglo JSON de IDs; j.key conserva el orden de la lista.
+constexpr const char* SQL_OBTENER_PRESTAMOS = "SELECT p.idPrestamo, p.idCuenta, p.tipo, p.moneda, p.monto, p.tasaInteres, p.plazoMeses, p.cuotaMensual, "
+                                              "p.cuotasPagadas, p.capitalPagado, p.interesesPagados, p.activo, p.fechaProximoPago, p.diasAtraso, p.version "
+                                              "FROM json_each(?) AS j JOIN Prestamos p ON p.idPrestamo = j.value ORDER BY j.key;";
+
+/// @brief Actualiza las cuotas, los montos pagados y el estado de un préstamo después de un abono si su versión no cambió, e incrementa la versión.
+constexpr const char* SQL_ACTUALIZAR_ABONO = "UPDATE Prestamos SET cuotasPagadas = ?, capitalPagado = ?, interesesPagados = ?, "
+                                             "cuotaMensual = ?, activo = ?, version = version + 1 WHERE idPrestamo = ? AND version = ?;";
+
+/// @brief Avanza la fecha del próximo pago un mes por cuota y recalcula el atraso con respecto a la fecha actual.
+constexpr const char* SQL_ACTUALIZAR_VENCIMIENTO = R"(
+    UPDATE Prestamos
+    SET fechaProximoPago = date(fechaProximoPago, ?1),
+        diasAtraso = MAX(0, CAST(julianday(date('now')) - julianday(date(fechaProximoPago, ?1)) AS INTEGER))
+    WHERE idPrestamo = ?2
+    RETURNING fechaProximoPago, diasAtraso;
+)";
+
+/// @brief Pagos de un préstamo.
+constexpr const char* SQL_HISTORIAL_ABONOS = "SELECT cuotaPagada, aporteCapital, aporteIntereses FROM PagoPrestamos WHERE idPrestamo = ?;";
+
+/// @brief Datos de un préstamo para el reporte de su estado.
+constexpr const char* SQL_ESTADO_PRESTAMO = R"(
+    SELECT cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, plazoMeses, fechaProximoPago, diasAtraso
+    FROM Prestamos WHERE idPrestamo = ?;
+)";
+
+// CDP, PagoPrestamo y Transaccion
+
+/// @brief Inserta un CDP.
+constexpr const char* SQL_CREAR_CDP = "INSERT INTO CDP (idCuenta, moneda, deposito, plazoMeses, tasaInteres) VALUES (?, ?, ?, ?, ?);";
+
+/// @brief Obtiene un CDP por su ID.
+constexpr const char* SQL_OBTENER_CDP = "SELECT idCuenta, moneda, deposito, plazoMeses, tasaInteres FROM CDP WHERE idCDP = ?;";
+
+/// @brief Obtiene varios CDP a partir de un arreglo JSON de IDs; j.key conserva el orden de la lista.
+constexpr const char* SQL_OBTENER_CDPS = "SELECT c.idCDP, c.idCuenta, c.moneda, c.deposito, c.plazoMeses, c.tasaInteres "
+                                         "FROM json_each(?) AS j JOIN CDP c ON c.idCDP = j.value ORDER BY j.key;";
+
+/// @brief Inserta un pago de préstamo. `PagoPrestamo::crearVarios` repite la lista de valores por cada pago.
+constexpr const char* SQL_CREAR_PAGO_PRESTAMO = "INSERT INTO PagoPrestamos (idPrestamo, cuotaPagada, aporteCapital, aporteIntereses, saldoRestante) "
+                                                "VALUES (?, ?, ?, ?, ?);";
+
+/// @brief Inserta una transacción.
+constexpr const char* SQL_CREAR_TRANSACCION = "INSERT INTO Transacciones (idRemitente, idDestinatario, tipo, monto) VALUES (?, ?, ?, ?);";
+
+// EstadoCuenta y Mora
+
+/// @brief Movimientos de una cuenta en un rango de fechas, como remitente y como destinatario, cada uno en orden por su índice (cuenta, fecha).
+constexpr const char* SQL_MOVIMIENTOS_CUENTA = R"(
+    SELECT fecha, idTransaccion, tipo, idDestinatario AS contraparte, monto, 1 AS debito
+    FROM Transacciones
+    WHERE idRemitente = ?1 AND fecha >= ?2 AND fecha < ?3
+    UNION ALL
+    SELECT fecha, idTransaccion, tipo, idRemitente, monto, 0
+    FROM Transacciones
+    WHERE idDestinatario = ?1 AND idRemitente IS NOT ?1 AND fecha >= ?2 AND fecha < ?3
+    ORDER BY 1, 2;
+)";
+
+/// @brief Corte diario de los días de atraso; solo visita los préstamos vencidos (índice parcial idx_vencimiento_prestamos).
+constexpr const char* SQL_ACTUALIZAR_MORA = R"(
+    UPDATE Prestamos
+    SET diasAtraso = CAST(julianday(date(?1)) - julianday(fechaProximoPago) AS INTEGER)
+    WHERE activo = 1 AND fechaProximoPago < date(?1)
+      AND diasAtraso <> CAST(julianday(date(?1)) - julianday(fechaProximoPago) AS INTEGER);
+)";
+
+/// @brief Reporte de antigüedad de la mora, leído en orden del índice parcial idx_mora_prestamos, que cubre todas sus columnas.
+constexpr const char* SQL_REPORTE_MORA = R"(
+    SELECT moneda, tipo,
+           SUM(diasAtraso <= 30), SUM(diasAtraso BETWEEN 31 AND 60),
+           SUM(diasAtraso BETWEEN 61 AND 90), SUM(diasAtraso > 90),
+           TOTAL(CASE WHEN diasAtraso <= 30 THEN monto - capitalPagado END),
+           TOTAL(CASE WHEN diasAtraso BETWEEN 31 AND 60 THEN monto - capitalPagado END),
+           TOTAL(CASE WHEN diasAtraso BETWEEN 61 AND 90 THEN monto - capitalPagado END),
+           TOTAL(CASE WHEN diasAtraso > 90 THEN monto - capitalPagado END)
+    FROM Prestamos
+    WHERE activo = 1
+    GROUP BY moneda, tipo;
+)";
+
+/**
+ * @struct ConsultaSQL
+ * @brief Sentencia registrada para verificar su plan de ejecución.
+ *
+ * - nombre: Método que ejecuta la sentencia.
+ * - sql: Texto de la sentencia.
+ * - indices: Índices que debe usar el plan, separados por espacios (vacío si basta la llave primaria).
+ * - ordenamientoPermitido: `true` si puede ordenar con un árbol B temporal, porque solo ordena las
+ *   filas de una lista recibida como parámetro.
+ */
+struct ConsultaSQL {
+    const char* nombre;
+    const char* sql;
+    const char* indices;
+    bool ordenamientoPermitido;
+};
+
+/// @brief Todas las sentencias de este archivo, con los índices que debe usar cada una.
+inline const std::vector<ConsultaSQL> CONSULTAS = {
+    {"Cuenta::crear", SQL_CREAR_CUENTA, "", false},
+    {"Cuenta::obtener", SQL_OBTENER_CUENTA, "", false},
+    {"Cuenta::obtenerVarios", SQL_OBTENER_CUENTAS, "", true},
+    {"Cuenta::existe", SQL_EXISTE_CUENTA, "", false},
+    {"Cuenta::actualizarSaldo", SQL_ACTUALIZAR_SALDO, "", false},
+    {"LibroMayor::guardar", SQL_SUMAR_SALDO, "", false},
+    {"Cuenta::existeSegunMoneda", SQL_CUENTAS_SEGUN_MONEDA, "idx_cliente_moneda_cuentas", false},
+    {"Cuenta::verificarCompatibilidadMoneda", SQL_COMPATIBILIDAD_MONEDA, "", false},
+    {"Cuenta::consultarHistorial", SQL_HISTORIAL_CUENTA, "idx_idRemitente_transacciones idx_idDestinatario_transacciones", false},
+    {"Cliente::crear", SQL_CREAR_CLIENTE, "", false},
+    {"Cliente::obtener", SQL_OBTENER_CLIENTE, "sqlite_autoindex_Clientes_1", false},
+    {"Cliente::obtenerVarios", SQL_OBTENER_CLIENTES, "sqlite_autoindex_Clientes_1", true},
+    {"Cliente::existe", SQL_EXISTE_CLIENTE, "sqlite_autoindex_Clientes_1", false},
+    {"Cliente::buscar", SQL_BUSCAR_CLIENTES, "BusquedaClientes", false},
+    {"Prestamo::crear", SQL_CREAR_PRESTAMO, "", false},
+    {"Prestamo::existe", SQL_EXISTE_PRESTAMO, "", false},
+    {"Prestamo::obtener", SQL_OBTENER_PRESTAMO, "", false},
+    {"Prestamo::obtenerVarios", SQL_OBTENER_PRESTAMOS, "", true},
+    {"Prestamo::actualizarDatosAbono", SQL_ACTUALIZAR_ABONO, "", false},
+    {"Prestamo::actualizarVencimiento", SQL_ACTUALIZAR_VENCIMIENTO, "", false},
+    {"Prestamo::mostrarHistorialAbonos", SQL_HISTORIAL_ABONOS, "idx_idPrestamo_pagoPrestamos", false},
+    {"Prestamo::consultarEstado", SQL_ESTADO_PRESTAMO, "", false},
+    {"CDP::crear", SQL_CREAR_CDP, "", false},
+    {"CDP::obtener", SQL_OBTENER_CDP, "", false},
+    {"CDP::obtenerVarios", SQL_OBTENER_CDPS, "", true},
+    {"PagoPrestamo::crear", SQL_CREAR_PAGO_PRESTAMO, "", false},
+    {"Transaccion::procesar", SQL_CREAR_TRANSACCION, "", false},
+    {"EstadoCuenta::exportarCSV", SQL_MOVIMIENTOS_CUENTA, "idx_idRemitente_transacciones idx_idDestinatario_transacciones", false},
+    {"Mora::actualizar", SQL_ACTUALIZAR_MORA, "idx_vencimiento_prestamos", false},
+    {"Mora::reporte", SQL_REPORTE_MORA, "idx_mora_prestamos", false}
+};
+
+#endif // CONSULTAS_HPP
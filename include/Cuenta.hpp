@@ -17,7 +17,10 @@
 #ifndef CUENTA_HPP
 #define CUENTA_HPP
 
+#include "Codigos.hpp"
+#include <span>
 #include <string>
+#include <vector>
 #include <sqlite3.h>
 
 /**
@@ -36,25 +39,38 @@ class Cuenta {
         /// @brief Identificador único del cliente asociado a la cuenta.
         int idCliente;
 
-        /// @brief Moneda de la cuenta ('USD', 'CRC').
-        std::string moneda;
-
         /// @brief Saldo actual de la cuenta.
         double saldo;
 
         /// @brief Tasa de interés asociada a la cuenta.
         double tasaInteres;
 
+        /// @brief Moneda de la cuenta.
+        Moneda moneda;
+
+        /// @brief Versión de la fila leída de la base de datos, incrementada por cada actualización del saldo.
+        int version = 0;
+
         /**
          * @brief Actualiza el saldo en la base de datos.
          * 
-         * Modifica el saldo de la cuenta en la base de datos para reflejar cambios locales.
+         * Modifica el saldo de la cuenta en la base de datos para reflejar cambios locales, solo si
+         * la fila conserva la versión leída, e incrementa la versión.
          * 
          * @param db Conexión a la base de datos SQLite.
          * @return `true` si la actualización fue exitosa, `false` en caso contrario.
+         * @throws ConflictoVersion Si otra sesión modificó la cuenta desde que se leyó.
          */
         bool actualizarSaldo(sqlite3* db);
 
+        /**
+         * @brief Vuelve a leer el saldo y la versión de la cuenta después de un conflicto de versión.
+         * 
+         * @param db Conexión a la base de datos SQLite.
+         * @return `true` si la cuenta se recargó, `false` si ya no se encuentra.
+         */
+        bool recargar(sqlite3* db);
+
         /**
          * @brief Verifica si existe una cuenta con la misma moneda para el cliente.
          * 
@@ -83,11 +99,11 @@ class Cuenta {
          * @param db Conexión a la base de datos SQLite.
          * @param idRemitente ID de la cuenta remitente.
          * @param idDestinatario ID de la cuenta destinataria.
-         * @param tipo Tipo de transacción ("DEP", "RET", "TRA", "ABO", "CDP").
+         * @param tipo Tipo de transacción.
          * @param monto Monto de la transacción.
          * @return `true` si la transacción fue creada con éxito, `false` en caso contrario.
          */
-        bool crearTransaccion(sqlite3* db, int idRemitente, int idDestinatario, const std::string& tipo, double monto);
+        bool crearTransaccion(sqlite3* db, int idRemitente, int idDestinatario, TipoTransaccion tipo, double monto);
 
     public:
         /**
@@ -96,11 +112,11 @@ class Cuenta {
          * Inicializa una cuenta con los datos especificados.
          * 
          * @param idCliente Identificador del cliente asociado a la cuenta.
-         * @param moneda Moneda de la cuenta ('USD', 'CRC').
+         * @param moneda Moneda de la cuenta.
          * @param saldo Saldo inicial de la cuenta.
          * @param tasaInteres Tasa de interés asociada a la cuenta.
          */
-        Cuenta(int idCliente, const std::string &moneda, double saldo, double tasaInteres);
+        Cuenta(int idCliente, Moneda moneda, double saldo, double tasaInteres);
 
         /**
          * @brief Crea un nuevo registro de cuenta en la base de datos.
@@ -123,6 +139,17 @@ class Cuenta {
          */
         static Cuenta obtener(sqlite3* db, int idCuenta);
 
+        /**
+         * @brief Obtiene varias cuentas en una sola consulta a partir de sus identificadores.
+         * 
+         * Las cuentas se retornan en el orden de los identificadores; los que no existen se omiten.
+         * 
+         * @param db Conexión a la base de datos SQLite.
+         * @param idsCuenta Identificadores de las cuentas a buscar.
+         * @return Vector con las cuentas encontradas, o vacío si falló la consulta.
+         */
+        static std::vector<Cuenta> obtenerVarios(sqlite3* db, std::span<const int> idsCuenta);
+
         /**
          * @brief Verifica si una cuenta existe en la base de datos.
          * 
@@ -153,9 +180,9 @@ class Cuenta {
         /**
          * @brief Retorna el tipo de moneda de la cuenta.
          * 
-         * @return `std::string` La moneda ('CRC', 'USD').
+         * @return `Moneda` La moneda de la cuenta.
          */
-        std::string getMoneda() const;
+        Moneda getMoneda() const;
         
         /**
          * @brief Consulta el saldo actual de la cuenta.
@@ -169,7 +196,8 @@ class Cuenta {
         /**
          * @brief Realiza un depósito en la cuenta.
          * 
-         * Aumenta el saldo de la cuenta en el monto especificado.
+         * Aumenta el saldo de la cuenta en el monto especificado. Si otra sesión modificó la cuenta,
+         * se recarga y se reintenta hasta `REINTENTOS_CONCURRENCIA` veces.
          * 
          * @param db Conexión a la base de datos SQLite.
          * @param monto Monto a depositar.
@@ -180,7 +208,8 @@ class Cuenta {
         /**
          * @brief Realiza un retiro en la cuenta.
          * 
-         * Disminuye el saldo de la cuenta si hay fondos suficientes.
+         * Disminuye el saldo de la cuenta si hay fondos suficientes. Si otra sesión modificó la cuenta,
+         * se recarga y los fondos se verifican de nuevo con el saldo actual.
          * 
          * @param db Conexión a la base de datos SQLite.
          * @param monto Monto a retirar.
@@ -191,7 +220,8 @@ class Cuenta {
         /**
          * @brief Transfiere fondos de esta cuenta a otra cuenta.
          * 
-         * Realiza una transferencia entre cuentas si la moneda es compatible.
+         * Realiza una transferencia entre cuentas si la moneda es compatible. Si otra sesión modificó
+         * alguna de las dos cuentas, ambas se recargan y la transferencia se reintenta.
          * 
          * @param db Conexión a la base de datos SQLite.
          * @param idCuentaDestino Identificador de la cuenta destino.
@@ -203,25 +233,29 @@ class Cuenta {
         /**
          * @brief Realiza un abono a un préstamo desde la cuenta.
          * 
+         * Se ejecuta dentro de la transacción del abono del préstamo, que se encarga de los reintentos.
+         * 
          * @param db Conexión a la base de datos SQLite.
          * @param monto Monto a abonar al préstamo.
          * @return `true` si el abono fue exitoso, `false` en caso contrario.
+         * @throws ConflictoVersion Si otra sesión modificó la cuenta desde que se leyó.
          */
         bool abonarPrestamo(sqlite3* db, double monto);
 
         /**
          * @brief Solicita un Certificado de Depósito a Plazo (CDP) desde la cuenta.
          * 
-         * Crea un CDP con el monto y plazo especificados, disminuyendo el saldo de la cuenta.
+         * Crea un CDP con el monto y plazo especificados, disminuyendo el saldo de la cuenta. Si otra
+         * sesión modificó la cuenta, se recarga y se reintenta.
          * 
          * @param db Conexión a la base de datos SQLite.
-         * @param moneda Tipo de moneda del CDP ('CRC', 'USD')
+         * @param moneda Moneda del CDP.
          * @param monto Monto a depositar en el CDP.
          * @param plazoMeses Plazo del CDP en meses.
          * @param tasaInteres Tasa de interés del CDP
          * @return `true` si la solicitud fue exitosa, `false` en caso contrario.
          */
-        bool solicitarCDP(sqlite3* db, std::string &moneda, double monto, int plazoMeses, double tasaInteres);
+        bool solicitarCDP(sqlite3* db, Moneda moneda, double monto, int plazoMeses, double tasaInteres);
 
         /**
          * @brief Consulta el historial de transacciones de la cuenta.
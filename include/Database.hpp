@@ -17,6 +17,9 @@
 #include <string>
 #include <sqlite3.h>
 
+/// @brief Tiempo máximo en milisegundos que una conexión espera a que otra libere la base de datos.
+constexpr int ESPERA_OCUPADA_DB_MS = 5000;
+
 /**
  * @brief Clase que gestiona la conexión a la base de datos.
  * 
@@ -34,12 +37,16 @@ class Database {
          * @brief Constructor de la clase Database.
          * 
          * Inicializa y abre la conexión a la base de datos especificada. Si no se puede
-         * abrir la base de datos, el constructor maneja el error apropiadamente.
+         * abrir la base de datos, el constructor maneja el error apropiadamente. La conexión
+         * espera hasta `ESPERA_OCUPADA_DB_MS` milisegundos cuando otra sesión tiene la base de
+         * datos bloqueada, en lugar de fallar de inmediato con `SQLITE_BUSY`.
          * 
          * @param dbName Nombre de la base de datos a abrir.
-         * @throws `std::runtime_error` si no se pudo crear/abrir correctamente.
+         * @param soloLectura Abre una base de datos existente sin permitir escrituras.
+         * @throws `std::runtime_error` si no se pudo crear/abrir correctamente, o si la base de
+         *         datos tiene tablas de una versión del esquema distinta de `VERSION_ESQUEMA`.
          */
-        Database(const std::string& dbName);
+        Database(const std::string& dbName, bool soloLectura = false);
         
         /**
          * @brief Destructor de la clase Database.
@@ -0,0 +1,212 @@
+/**
+ * @file Ejecutor.hpp
+ * @brief Declaración de las clases Ejecutor y PoolTrabajo para ejecutar corrutinas.
+ * @details Este archivo contiene la declaración de la clase Ejecutor, que reanuda en un único hilo las
+ *          corrutinas listas para continuar, y de la clase PoolTrabajo, un grupo de hilos con su propia
+ *          conexión a la base de datos. Una corrutina que espera un trabajo de un PoolTrabajo queda
+ *          suspendida sin ocupar un hilo y el Ejecutor la reanuda cuando el trabajo termina.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef EJECUTOR_HPP
+#define EJECUTOR_HPP
+
+#include "Database.hpp"
+#include "Tarea.hpp"
+#include <sqlite3.h>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class Ejecutor
+ * @brief Cola de corrutinas listas que se reanudan en el hilo que llama a `ejecutarListas`.
+ *
+ * Cualquier hilo puede programar una corrutina; solo el hilo del ejecutor la reanuda, por lo que el
+ * código de las corrutinas no necesita sincronización para el estado que comparte con ese hilo.
+ */
+class Ejecutor {
+    private:
+        std::mutex mutex;
+        std::vector<std::coroutine_handle<>> listas;
+
+        /// @brief Función llamada cuando la cola pasa de vacía a tener corrutinas listas.
+        std::function<void()> despertar;
+
+    public:
+        /**
+         * @brief Constructor de la clase Ejecutor.
+         *
+         * @param despertar Función que avisa al hilo del ejecutor que hay corrutinas listas (por ejemplo,
+         *                  escribiendo en un `eventfd`). Se llama desde el hilo que programa la corrutina.
+         */
+        explicit Ejecutor(std::function<void()> despertar = {});
+
+        /**
+         * @brief Programa una corrutina para reanudarla en el hilo del ejecutor.
+         *
+         * @param corrutina Corrutina suspendida.
+         */
+        void programar(std::coroutine_handle<> corrutina);
+
+        /**
+         * @brief Reanuda las corrutinas listas hasta que la cola quede vacía.
+         *
+         * @return `size_t` Cantidad de corrutinas reanudadas.
+         */
+        size_t ejecutarListas();
+
+        /**
+         * @brief Inicia una tarea en el hilo actual sin esperar su resultado.
+         *
+         * La tarea se ejecuta hasta su primera suspensión y el marco se libera al terminar.
+         *
+         * @param tarea Tarea a iniciar.
+         */
+        void lanzar(Tarea<void> tarea);
+};
+
+class PoolTrabajo;
+
+/**
+ * @class EsperaPool
+ * @brief Operación que suspende a la corrutina, ejecuta una función en un PoolTrabajo y la reanuda en el
+ *        Ejecutor con el resultado.
+ *
+ * @tparam Funcion Función que recibe la conexión `sqlite3*` del hilo del pool.
+ */
+template <typename Funcion>
+class EsperaPool {
+    public:
+        using Resultado = std::invoke_result_t<Funcion&, sqlite3*>;
+
+    private:
+        PoolTrabajo& pool;
+        Funcion funcion;
+        std::optional<Resultado> resultado;
+        std::exception_ptr excepcion;
+
+    public:
+        EsperaPool(PoolTrabajo& pool, Funcion funcion) : pool(pool), funcion(std::move(funcion)) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> corrutina);
+        Resultado await_resume() {
+            if (excepcion) std::rethrow_exception(excepcion);
+            return std::move(*resultado);
+        }
+};
+
+/**
+ * @class PoolTrabajo
+ * @brief Grupo de hilos, cada uno con su propia conexión a la base de datos, que atienden trabajos en
+ *        orden de llegada.
+ *
+ * Un pool de un solo hilo serializa los trabajos (por ejemplo, las escrituras) y uno de varios hilos
+ * los reparte (por ejemplo, las consultas). Las conexiones usan modo WAL para que las lecturas no
+ * esperen a las escrituras.
+ */
+class PoolTrabajo {
+    private:
+        Ejecutor& ejecutor;
+        std::vector<std::unique_ptr<Database>> conexiones;
+        std::vector<std::thread> hilos;
+
+        std::mutex mutex;
+        std::condition_variable condicion;
+        std::deque<std::function<void(sqlite3*)>> trabajos;
+        bool cerrado = false;
+
+        // Ciclo de cada hilo del pool
+        void trabajar(sqlite3* db);
+
+    public:
+        /**
+         * @brief Constructor de la clase PoolTrabajo.
+         *
+         * @param ejecutor Ejecutor donde se reanudan las corrutinas que esperan los trabajos.
+         * @param nombreDB Nombre del archivo de la base de datos.
+         * @param cantidadHilos Cantidad de hilos (y conexiones) del pool.
+         * @param soloLectura Si es `true`, las conexiones rechazan cualquier escritura.
+         * @throws std::runtime_error Si no se puede abrir una conexión o activar el modo WAL.
+         */
+        PoolTrabajo(Ejecutor& ejecutor, const std::string& nombreDB, unsigned int cantidadHilos, bool soloLectura);
+
+        /**
+         * @brief Destructor que cierra el pool.
+         */
+        ~PoolTrabajo();
+
+        PoolTrabajo(const PoolTrabajo&) = delete;
+        PoolTrabajo& operator=(const PoolTrabajo&) = delete;
+
+        /**
+         * @brief Agrega un trabajo a la cola del pool.
+         *
+         * Si el pool ya se cerró, el trabajo se rechaza sin ejecutarse: sus conexiones pueden seguir en
+         * uso por los hilos que terminan los trabajos pendientes.
+         *
+         * @param trabajo Función que recibe la conexión del hilo que la ejecuta.
+         * @return `true` si el trabajo se agregó a la cola, `false` si el pool ya se cerró.
+         */
+        bool enviar(std::function<void(sqlite3*)> trabajo);
+
+        /**
+         * @brief Termina los trabajos pendientes y detiene los hilos del pool.
+         */
+        void cerrar();
+
+        /**
+         * @brief Retorna una operación para esperar con `co_await` el resultado de una función ejecutada
+         *        en el pool.
+         *
+         * @param funcion Función que recibe la conexión `sqlite3*` y retorna el resultado.
+         * @return `EsperaPool` Operación a esperar.
+         */
+        template <typename Funcion>
+        EsperaPool<Funcion> ejecutar(Funcion funcion) {
+            return EsperaPool<Funcion>(*this, std::move(funcion));
+        }
+
+        /**
+         * @brief Retorna el ejecutor del pool.
+         *
+         * @return `Ejecutor&` Ejecutor donde se reanudan las corrutinas.
+         */
+        Ejecutor& getEjecutor() { return ejecutor; }
+};
+
+template <typename Funcion>
+bool EsperaPool<Funcion>::await_suspend(std::coroutine_handle<> corrutina) {
+    // Después de enviar el trabajo no se usa `this`: la corrutina pudo reanudarse en el ejecutor
+    bool enviado = pool.enviar([this, corrutina, &ejecutor = pool.getEjecutor()](sqlite3* db) {
+        try {
+            resultado.emplace(funcion(db));
+        } catch (...) {
+            excepcion = std::current_exception();
+        }
+        ejecutor.programar(corrutina);
+    });
+
+    // Trabajo rechazado por el pool cerrado: la corrutina continúa de inmediato con el error
+    if (!enviado) {
+        excepcion = std::make_exception_ptr(std::runtime_error("Error: El pool está cerrado; la operación no se realizó."));
+    }
+    return enviado;
+}
+
+#endif // EJECUTOR_HPP
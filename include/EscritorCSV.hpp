@@ -0,0 +1,120 @@
+/**
+ * @file EscritorCSV.hpp
+ * @brief Declaración de la clase EscritorCSV para escribir archivos `.csv` grandes.
+ * @details Este archivo contiene la declaración de la clase EscritorCSV, que escribe los campos de un
+ *          archivo `.csv` en un buffer propio de gran tamaño, da formato a los números con
+ *          `std::to_chars` y solo llama al sistema cuando el buffer se llena, sin reservar memoria
+ *          por fila.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef ESCRITOR_CSV_HPP
+#define ESCRITOR_CSV_HPP
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/// @brief Tamaño predeterminado del buffer de salida (1 MiB).
+constexpr size_t TAMANO_BUFFER_CSV = 1 << 20;
+
+/**
+ * @class EscritorCSV
+ * @brief Escritor de archivos `.csv` con buffer propio.
+ *
+ * Los campos se agregan en orden con `campo` y cada fila termina con `finFila`. Los textos que
+ * contienen comas, comillas o saltos de línea se escriben entre comillas.
+ */
+class EscritorCSV {
+    private:
+        std::FILE* archivo;
+        std::unique_ptr<char[]> buffer;
+        size_t capacidad;
+        size_t usado = 0;
+        bool inicioFila = true;
+        bool error = false;
+
+        // Escribe el contenido del buffer en el archivo
+        void vaciar();
+
+        // Garantiza espacio para `cantidad` bytes en el buffer
+        void reservar(size_t cantidad) {
+            if (capacidad - usado < cantidad) vaciar();
+        }
+
+        // Agrega la coma antes de cada campo que no es el primero de la fila
+        void separador() {
+            if (!inicioFila) buffer[usado++] = ',';
+            inicioFila = false;
+        }
+
+    public:
+        /**
+         * @brief Constructor que abre (o crea) el archivo de salida.
+         *
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @param capacidad Tamaño del buffer de salida en bytes.
+         */
+        explicit EscritorCSV(const std::string& nombreArchivo, size_t capacidad = TAMANO_BUFFER_CSV);
+
+        /**
+         * @brief Destructor que escribe lo pendiente y cierra el archivo.
+         */
+        ~EscritorCSV();
+
+        EscritorCSV(const EscritorCSV&) = delete;
+        EscritorCSV& operator=(const EscritorCSV&) = delete;
+
+        /**
+         * @brief Indica si el archivo se abrió correctamente.
+         *
+         * @return `true` si el archivo está abierto.
+         */
+        bool abierto() const;
+
+        /**
+         * @brief Agrega un campo entero.
+         *
+         * @param valor Valor del campo.
+         */
+        void campo(long long valor);
+
+        /**
+         * @brief Agrega un campo decimal con la cantidad de decimales indicada.
+         *
+         * @param valor Valor del campo.
+         * @param decimales Cantidad de decimales.
+         */
+        void campo(double valor, int decimales = 2);
+
+        /**
+         * @brief Agrega un campo de texto.
+         *
+         * @param texto Texto del campo.
+         */
+        void campo(std::string_view texto);
+
+        /**
+         * @brief Agrega un campo vacío.
+         */
+        void campoVacio();
+
+        /**
+         * @brief Termina la fila actual.
+         */
+        void finFila();
+
+        /**
+         * @brief Escribe lo pendiente y cierra el archivo.
+         *
+         * @return `true` si todas las escrituras fueron exitosas, `false` en caso contrario.
+         */
+        bool cerrar();
+};
+
+#endif // ESCRITOR_CSV_HPP
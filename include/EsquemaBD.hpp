@@ -0,0 +1,244 @@
+/**
+ * @file EsquemaBD.hpp
+ * @brief Esquema de la base de datos SQLite del banco.
+ * @details Este archivo contiene los scripts SQL de la versión actual del esquema, compartidos por
+ *          `inicio_db`, que crea una base de datos nueva, y `migrar_db`, que convierte una base de
+ *          datos existente. Las tablas se crean por separado de los índices y triggers para que la
+ *          migración pueda copiar las filas antes de construir los índices.
+ *
+ *          Versión 2 del esquema:
+ *          - Tablas `STRICT`, sin `AUTOINCREMENT` (las filas nunca se eliminan, por lo que el ID
+ *            siguiente es siempre el mayor más uno y no es necesario actualizar `sqlite_sequence`).
+ *          - Monedas y tipos almacenados como enteros (los valores de `Codigos.hpp`):
+ *            moneda 0 = 'CRC', 1 = 'USD'; tipo de préstamo 1 = 'PER', 2 = 'PRE', 3 = 'HIP';
+ *            tipo de transacción 0 = 'DEP', 1 = 'RET', 2 = 'TRA', 3 = 'ABO', 4 = 'CDP'.
+ *          - Sin los índices redundantes sobre las llaves primarias y la cédula (que ya tiene el
+ *            índice de su restricción `UNIQUE`).
+ *
+ *          Versión 3 del esquema:
+ *          - Columna `version` en `Cuentas` y `Prestamos`, incrementada en cada actualización, para el
+ *            control de concurrencia optimista (`Concurrencia.hpp`).
+ *
+ *          Versión 4 del esquema:
+ *          - Triggers que rechazan eliminar filas de `Clientes`, `Cuentas` y `Prestamos`. Sin
+ *            `AUTOINCREMENT`, SQLite reutilizaría el ID más alto de una fila eliminada, y los filtros
+ *            de existencia (`FiltrosExistencia.hpp`) solo agregan las filas con un ID mayor al último
+ *            visto.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef ESQUEMA_BD_HPP
+#define ESQUEMA_BD_HPP
+
+#include <vector>
+
+/// @brief Versión del esquema de la base de datos (`PRAGMA user_version`) que espera el programa.
+constexpr int VERSION_ESQUEMA = 4;
+
+/**
+ * @brief Script SQL para la creación de las tablas.
+ *
+ * Incluye las tablas Clientes, Cuentas, CDP, Transacciones, Prestamos y PagoPrestamos, con las
+ * restricciones necesarias en cada campo para la integridad de los datos.
+ */
+constexpr const char* SQL_TABLAS = R"(
+    CREATE TABLE IF NOT EXISTS Clientes (
+        idCliente INTEGER PRIMARY KEY CHECK (idCliente <= 999999999),
+        cedula INTEGER UNIQUE NOT NULL,
+        nombre TEXT NOT NULL,
+        primerApellido TEXT NOT NULL,
+        segundoApellido TEXT,
+        telefono TEXT
+    ) STRICT;
+
+    CREATE TABLE IF NOT EXISTS Cuentas (
+        idCuenta INTEGER PRIMARY KEY,
+        idCliente INTEGER NOT NULL,
+        moneda INTEGER NOT NULL CHECK (moneda IN (0, 1)),
+        saldo REAL NOT NULL,
+        tasaInteres REAL NOT NULL,
+        version INTEGER NOT NULL DEFAULT 0,
+        FOREIGN KEY (idCliente) REFERENCES Clientes(idCliente)
+    ) STRICT;
+
+    CREATE TABLE IF NOT EXISTS CDP (
+        idCDP INTEGER PRIMARY KEY,
+        idCuenta INTEGER NOT NULL,
+        moneda INTEGER NOT NULL CHECK (moneda IN (0, 1)),
+        deposito REAL NOT NULL,
+        plazoMeses INTEGER NOT NULL,
+        tasaInteres REAL NOT NULL,
+        FOREIGN KEY (idCuenta) REFERENCES Cuentas(idCuenta)
+    ) STRICT;
+
+    CREATE TABLE IF NOT EXISTS Transacciones (
+        idTransaccion INTEGER PRIMARY KEY,
+        idRemitente INTEGER,
+        idDestinatario INTEGER,
+        tipo INTEGER NOT NULL CHECK (tipo BETWEEN 0 AND 4),
+        monto REAL NOT NULL,
+        fecha TEXT NOT NULL DEFAULT (datetime('now')),
+        FOREIGN KEY (idRemitente) REFERENCES Cuentas(idCuenta),
+        FOREIGN KEY (idDestinatario) REFERENCES Cuentas(idCuenta)
+    ) STRICT;
+
+    CREATE TABLE IF NOT EXISTS Prestamos (
+        idPrestamo INTEGER PRIMARY KEY,
+        idCuenta INTEGER NOT NULL,
+        tipo INTEGER NOT NULL CHECK (tipo IN (1, 2, 3)),
+        moneda INTEGER NOT NULL CHECK (moneda IN (0, 1)),
+        monto REAL NOT NULL,
+        tasaInteres REAL NOT NULL,
+        plazoMeses INTEGER NOT NULL,
+        cuotaMensual REAL NOT NULL,
+        cuotasPagadas INTEGER NOT NULL DEFAULT 0,
+        capitalPagado REAL NOT NULL DEFAULT 0,
+        interesesPagados REAL NOT NULL DEFAULT 0,
+        activo INTEGER NOT NULL DEFAULT 1 CHECK (activo IN (0, 1)),
+        fechaProximoPago TEXT NOT NULL DEFAULT (date('now', '+1 month')),
+        diasAtraso INTEGER NOT NULL DEFAULT 0,
+        version INTEGER NOT NULL DEFAULT 0,
+        FOREIGN KEY (idCuenta) REFERENCES Cuentas(idCuenta)
+    ) STRICT;
+
+    CREATE TABLE IF NOT EXISTS PagoPrestamos (
+        idPagoPrestamo INTEGER PRIMARY KEY,
+        idPrestamo INTEGER NOT NULL,
+        cuotaPagada REAL NOT NULL,
+        aporteCapital REAL NOT NULL,
+        aporteIntereses REAL NOT NULL,
+        saldoRestante REAL NOT NULL,
+        FOREIGN KEY (idPrestamo) REFERENCES Prestamos(idPrestamo)
+    ) STRICT;
+)";
+
+/**
+ * @brief Script SQL para la creación de los índices, el índice de texto completo y sus triggers.
+ *
+ * Cada índice corresponde a consultas de las clases del programa:
+ * - `idx_cliente_moneda_cuentas`: Cuentas de un cliente (Cliente360) y `Cuenta::existeSegunMoneda`,
+ *   que se responde solo con el índice.
+ * - `idx_idRemitente_transacciones` e `idx_idDestinatario_transacciones`: Movimientos de una cuenta en
+ *   un rango de fechas (EstadoCuenta, Cliente360). Están en el orden (fecha, ID) de los estados de
+ *   cuenta e incluyen el tipo, el monto y la contraparte, por lo que la consulta no visita la tabla
+ *   ni ordena los movimientos.
+ * - `idx_idPrestamo_pagoPrestamos`: Pagos de un préstamo (`Prestamo::mostrarHistorialAbonos`).
+ * - `idx_vencimiento_prestamos` e `idx_mora_prestamos`: Índices parciales de los préstamos activos para
+ *   el control de la mora (Mora).
+ *
+ * Los triggers `trg_*_sin_eliminar` impiden eliminar clientes, cuentas y préstamos, para que sus IDs
+ * no se reutilicen. Al final se reconstruye el índice de texto completo para los clientes registrados antes de crearlo.
+ */
+constexpr const char* SQL_INDICES = R"(
+    CREATE INDEX IF NOT EXISTS idx_cliente_moneda_cuentas ON Cuentas(idCliente, moneda);
+    CREATE INDEX IF NOT EXISTS idx_idCuenta_cdp ON CDP(idCuenta);
+    CREATE INDEX IF NOT EXISTS idx_idRemitente_transacciones ON Transacciones(idRemitente, fecha, idTransaccion, tipo, monto, idDestinatario);
+    CREATE INDEX IF NOT EXISTS idx_idDestinatario_transacciones ON Transacciones(idDestinatario, fecha, idTransaccion, tipo, monto, idRemitente);
+    CREATE INDEX IF NOT EXISTS idx_idCuenta_prestamos ON Prestamos(idCuenta);
+    CREATE INDEX IF NOT EXISTS idx_idPrestamo_pagoPrestamos ON PagoPrestamos(idPrestamo);
+
+    CREATE INDEX IF NOT EXISTS idx_vencimiento_prestamos ON Prestamos(fechaProximoPago) WHERE activo = 1;
+    CREATE INDEX IF NOT EXISTS idx_mora_prestamos ON Prestamos(moneda, tipo, diasAtraso, monto, capitalPagado) WHERE activo = 1;
+
+    -- Índice de texto completo de los nombres y teléfonos de los clientes, sincronizado con triggers
+    CREATE VIRTUAL TABLE IF NOT EXISTS BusquedaClientes USING fts5(
+        nombre, primerApellido, segundoApellido, telefono,
+        content = 'Clientes', content_rowid = 'idCliente',
+        tokenize = 'unicode61 remove_diacritics 2', prefix = '2 3'
+    );
+
+    CREATE TRIGGER IF NOT EXISTS trg_busqueda_clientes_insert AFTER INSERT ON Clientes BEGIN
+        INSERT INTO BusquedaClientes (rowid, nombre, primerApellido, segundoApellido, telefono)
+        VALUES (new.idCliente, new.nombre, new.primerApellido, new.segundoApellido, new.telefono);
+    END;
+
+    CREATE TRIGGER IF NOT EXISTS trg_busqueda_clientes_delete AFTER DELETE ON Clientes BEGIN
+        INSERT INTO BusquedaClientes (BusquedaClientes, rowid, nombre, primerApellido, segundoApellido, telefono)
+        VALUES ('delete', old.idCliente, old.nombre, old.primerApellido, old.segundoApellido, old.telefono);
+    END;
+
+    CREATE TRIGGER IF NOT EXISTS trg_busqueda_clientes_update AFTER UPDATE ON Clientes BEGIN
+        INSERT INTO BusquedaClientes (BusquedaClientes, rowid, nombre, primerApellido, segundoApellido, telefono)
+        VALUES ('delete', old.idCliente, old.nombre, old.primerApellido, old.segundoApellido, old.telefono);
+        INSERT INTO BusquedaClientes (rowid, nombre, primerApellido, segundoApellido, telefono)
+        VALUES (new.idCliente, new.nombre, new.primerApellido, new.segundoApellido, new.telefono);
+    END;
+
+    -- Los IDs no se reutilizan porque estas filas nunca se eliminan
+    CREATE TRIGGER IF NOT EXISTS trg_clientes_sin_eliminar BEFORE DELETE ON Clientes BEGIN
+        SELECT RAISE(ABORT, 'Los clientes no se pueden eliminar.');
+    END;
+
+    CREATE TRIGGER IF NOT EXISTS trg_cuentas_sin_eliminar BEFORE DELETE ON Cuentas BEGIN
+        SELECT RAISE(ABORT, 'Las cuentas no se pueden eliminar.');
+    END;
+
+    CREATE TRIGGER IF NOT EXISTS trg_prestamos_sin_eliminar BEFORE DELETE ON Prestamos BEGIN
+        SELECT RAISE(ABORT, 'Los préstamos no se pueden eliminar.');
+    END;
+
+    INSERT INTO BusquedaClientes (BusquedaClientes) VALUES ('rebuild');
+)";
+
+/**
+ * @struct PasoDatos
+ * @brief Actualización de las filas de una tabla que se ejecuta por bloques de llaves.
+ *
+ * - tabla y llave: Tabla que se recorre y su llave primaria entera.
+ * - sql: Sentencia que actualiza las filas con llave en el rango `(?1, ?2]`. Debe poder repetirse
+ *   sobre un rango ya actualizado sin cambiar el resultado.
+ */
+struct PasoDatos {
+    const char* tabla;
+    const char* llave;
+    const char* sql;
+};
+
+/**
+ * @struct Migracion
+ * @brief Cambio del esquema de la versión anterior a `version`.
+ *
+ * - version: Versión del esquema que resulta de aplicar la migración.
+ * - descripcion: Descripción breve del cambio.
+ * - esquema: Sentencias rápidas (`ALTER TABLE ... ADD COLUMN`, tablas nuevas) que se aplican en una
+ *   transacción antes de los pasos de datos.
+ * - datos: Pasos de datos, cada uno ejecutado en transacciones cortas de un bloque de filas.
+ * - final: Sentencias que se aplican junto con el cambio de `user_version` después de los pasos de
+ *   datos (índices, triggers). Deben usar `IF NOT EXISTS`, porque la reconstrucción desde la versión 1
+ *   ya crea los índices de `SQL_INDICES`.
+ */
+struct Migracion {
+    int version;
+    const char* descripcion;
+    const char* esquema;
+    std::vector<PasoDatos> datos;
+    const char* final;
+};
+
+/**
+ * @brief Migraciones posteriores a la versión 2, en orden de versión.
+ *
+ * Al cambiar `SQL_TABLAS` o `SQL_INDICES` se incrementa `VERSION_ESQUEMA` y se agrega aquí la
+ * migración que lleva una base de datos existente de la versión anterior a la nueva. La versión 2 no
+ * tiene entrada: `MigracionBD` la obtiene reconstruyendo las tablas de la versión 1.
+ */
+inline const std::vector<Migracion> MIGRACIONES = {
+    {3, "Columna version en Cuentas y Prestamos para el control de concurrencia optimista",
+     "ALTER TABLE Cuentas ADD COLUMN version INTEGER NOT NULL DEFAULT 0;"
+     "ALTER TABLE Prestamos ADD COLUMN version INTEGER NOT NULL DEFAULT 0;",
+     {}, nullptr},
+    {4, "Triggers que impiden eliminar clientes, cuentas y préstamos",
+     nullptr, {},
+     "CREATE TRIGGER IF NOT EXISTS trg_clientes_sin_eliminar BEFORE DELETE ON Clientes BEGIN "
+     "SELECT RAISE(ABORT, 'Los clientes no se pueden eliminar.'); END;"
+     "CREATE TRIGGER IF NOT EXISTS trg_cuentas_sin_eliminar BEFORE DELETE ON Cuentas BEGIN "
+     "SELECT RAISE(ABORT, 'Las cuentas no se pueden eliminar.'); END;"
+     "CREATE TRIGGER IF NOT EXISTS trg_prestamos_sin_eliminar BEFORE DELETE ON Prestamos BEGIN "
+     "SELECT RAISE(ABORT, 'Los préstamos no se pueden eliminar.'); END;"},
+};
+
+#endif // ESQUEMA_BD_HPP
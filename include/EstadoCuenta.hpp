@@ -0,0 +1,66 @@
+/**
+ * @file EstadoCuenta.hpp
+ * @brief Declaración de la clase EstadoCuenta para exportar el estado de cuenta a un archivo `.csv`.
+ * @details Este archivo contiene la declaración de la clase EstadoCuenta, que recorre los movimientos de
+ *          una cuenta (opcionalmente en un rango de fechas) directamente desde la consulta y los escribe
+ *          con un EscritorCSV, con memoria constante sin importar la cantidad de movimientos.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef ESTADO_CUENTA_HPP
+#define ESTADO_CUENTA_HPP
+
+#include <sqlite3.h>
+#include <string>
+
+/**
+ * @class EstadoCuenta
+ * @brief Exportación del estado de cuenta de una cuenta.
+ *
+ * Los movimientos se obtienen en orden de fecha con dos recorridos de índice, uno por
+ * `idx_idRemitente_transacciones` y otro por `idx_idDestinatario_transacciones`, que SQLite combina
+ * sin ordenar en una tabla temporal.
+ */
+class EstadoCuenta {
+    public:
+        /// @brief Consulta de los movimientos de una cuenta (`?1` cuenta, `?2` y `?3` límites de fecha).
+        static const char* const CONSULTA_MOVIMIENTOS;
+
+        /**
+         * @brief Exporta los movimientos de una cuenta a un archivo `.csv`.
+         *
+         * Cada fila contiene la fecha, el ID y el tipo de la transacción, la cuenta de contraparte y el
+         * monto como débito o crédito según la cuenta sea la remitente o la destinataria.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param idCuenta ID de la cuenta.
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @param desde Fecha inicial (YYYY-MM-DD), inclusiva, o vacía para no limitar.
+         * @param hasta Fecha final (YYYY-MM-DD), inclusiva, o vacía para no limitar.
+         * @return `long long` Cantidad de movimientos exportados, o -1 si ocurrió un error.
+         */
+        static long long exportarCSV(sqlite3* db, int idCuenta, const std::string& nombreArchivo,
+                                     const std::string& desde = "", const std::string& hasta = "");
+
+        /**
+         * @brief Exporta los movimientos de una cuenta con una consulta ya preparada.
+         *
+         * Permite generar los estados de muchas cuentas con una sola sentencia preparada a partir de
+         * `CONSULTA_MOVIMIENTOS`, que se reinicia al terminar.
+         *
+         * @param consulta Sentencia preparada con `CONSULTA_MOVIMIENTOS`.
+         * @param idCuenta ID de la cuenta.
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @param desde Fecha inicial (YYYY-MM-DD), inclusiva, o vacía para no limitar.
+         * @param hasta Fecha final (YYYY-MM-DD), inclusiva, o vacía para no limitar.
+         * @return `long long` Cantidad de movimientos exportados, o -1 si ocurrió un error.
+         */
+        static long long exportarCSV(sqlite3_stmt* consulta, int idCuenta, const std::string& nombreArchivo,
+                                     const std::string& desde = "", const std::string& hasta = "");
+};
+
+#endif // ESTADO_CUENTA_HPP
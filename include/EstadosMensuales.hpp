@@ -0,0 +1,90 @@
+/**
+ * @file EstadosMensuales.hpp
+ * @brief Declaración de la clase EstadosMensuales para generar los estados de cuenta de cierre de mes.
+ * @details Este archivo contiene la declaración de la clase EstadosMensuales, que genera el estado de cuenta
+ *          de un mes para todas las cuentas de la tabla `Cuentas`, repartiendo las cuentas en lotes entre
+ *          varios hilos con su propia conexión de solo lectura, y que puede reanudar una generación
+ *          interrumpida a partir de los lotes ya completados.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef ESTADOS_MENSUALES_HPP
+#define ESTADOS_MENSUALES_HPP
+
+#include <cstddef>
+#include <string>
+
+/// @brief Rango de IDs de cuenta de cada lote (y de cada subdirectorio de salida).
+constexpr int CUENTAS_POR_LOTE = 1000;
+
+/**
+ * @struct ResultadoEstados
+ * @brief Resultado de una generación de estados de cuenta.
+ *
+ * - cuentas: Estados de cuenta generados en esta ejecución.
+ * - movimientos: Movimientos exportados en esta ejecución.
+ * - lotes: Lotes completados en esta ejecución.
+ * - lotesReanudados: Lotes omitidos por estar completados en una ejecución anterior, sin cuentas nuevas.
+ * - lotesFallidos: Lotes con algún error, que se vuelven a generar en la siguiente ejecución.
+ * - hilos: Cantidad de hilos utilizados.
+ * - segundos: Duración de la generación.
+ */
+struct ResultadoEstados {
+    size_t cuentas = 0;
+    long long movimientos = 0;
+    size_t lotes = 0;
+    size_t lotesReanudados = 0;
+    size_t lotesFallidos = 0;
+    unsigned int hilos = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @class EstadosMensuales
+ * @brief Generación en paralelo de los estados de cuenta de un mes.
+ *
+ * Los estados se guardan en `<directorio>/<periodo>/<lote>/cuenta_<id>.csv`, donde el lote es
+ * `id / CUENTAS_POR_LOTE`. Cada archivo se escribe primero con extensión `.tmp` y se renombra al
+ * terminar, y cada lote completado se agrega al archivo `progreso.txt` del periodo junto con el ID
+ * más alto que se generó en él, por lo que una ejecución interrumpida continúa con los lotes
+ * pendientes y con las cuentas creadas en un lote después de completarlo.
+ */
+class EstadosMensuales {
+    public:
+        /**
+         * @brief Obtiene las fechas inicial y final de un periodo mensual.
+         *
+         * @param periodo Periodo en formato YYYY-MM.
+         * @param desde Fecha inicial del periodo (YYYY-MM-DD).
+         * @param hasta Fecha final del periodo (YYYY-MM-DD).
+         * @return `true` si el periodo es válido, `false` en caso contrario.
+         */
+        static bool limitesPeriodo(const std::string& periodo, std::string& desde, std::string& hasta);
+
+        /**
+         * @brief Genera el estado de cuenta del periodo para todas las cuentas.
+         *
+         * @param nombreDB Nombre del archivo de la base de datos.
+         * @param periodo Periodo en formato YYYY-MM.
+         * @param directorio Directorio de salida.
+         * @param hilos Cantidad de hilos (0 para usar todos los disponibles).
+         * @return `ResultadoEstados` Cantidad de estados, movimientos y lotes procesados.
+         * @throws `std::runtime_error` si el periodo no es válido o no se pudo preparar la generación.
+         */
+        static ResultadoEstados generar(const std::string& nombreDB, const std::string& periodo,
+                                        const std::string& directorio, unsigned int hilos = 0);
+
+        /**
+         * @brief Muestra el resultado de una generación en la terminal.
+         *
+         * @param resultado Resultado de la generación.
+         * @return `void`
+         */
+        static void mostrarResultado(const ResultadoEstados& resultado);
+};
+
+#endif // ESTADOS_MENSUALES_HPP
@@ -0,0 +1,190 @@
+/**
+ * @file FiltrosExistencia.hpp
+ * @brief Declaración de los filtros de Bloom que evitan consultas de existencia a la base de datos.
+ * @details Este archivo contiene la declaración de la clase FiltroBloom y de la clase FiltrosExistencia,
+ *          que mantiene por conexión un filtro de Bloom para las cédulas de los clientes, los IDs de
+ *          las cuentas, las cuentas por cliente y moneda, y los IDs de los préstamos. Los métodos
+ *          `existe` de Cliente, Cuenta y Prestamo consultan primero el filtro: si indica que la clave
+ *          no está, se responde sin ejecutar la consulta en SQLite.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef FILTROS_EXISTENCIA_HPP
+#define FILTROS_EXISTENCIA_HPP
+
+#include "Codigos.hpp"
+#include <sqlite3.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/// @brief Bits por clave de los filtros (con 7 funciones hash, cerca de 1% de falsos positivos).
+constexpr size_t BITS_POR_CLAVE_FILTRO = 10;
+
+/// @brief Cantidad de funciones hash de los filtros.
+constexpr uint32_t FUNCIONES_HASH_FILTRO = 7;
+
+/// @brief Tamaño mínimo de un filtro en bits.
+constexpr size_t BITS_MINIMOS_FILTRO = 1 << 16;
+
+/**
+ * @class FiltroBloom
+ * @brief Filtro de Bloom de claves enteras.
+ *
+ * Responde si una clave puede estar en el conjunto: un resultado negativo es seguro, mientras
+ * que uno positivo puede ser un falso positivo.
+ */
+class FiltroBloom {
+    private:
+        std::vector<uint64_t> bits;
+        size_t cantidadBits = 0;
+        uint32_t funcionesHash = FUNCIONES_HASH_FILTRO;
+        size_t claves = 0;
+
+    public:
+        /**
+         * @brief Constructor que reserva un filtro para una cantidad de claves.
+         *
+         * @param capacidad Cantidad de claves esperadas.
+         */
+        explicit FiltroBloom(size_t capacidad = 0);
+
+        /**
+         * @brief Agrega una clave al filtro.
+         *
+         * @param clave Clave a agregar.
+         * @return `void`
+         */
+        void agregar(int64_t clave);
+
+        /**
+         * @brief Indica si una clave puede estar en el filtro.
+         *
+         * @param clave Clave a verificar.
+         * @return `false` si la clave no está con seguridad, `true` si puede estar.
+         */
+        bool puedeContener(int64_t clave) const;
+
+        /**
+         * @brief Indica si el filtro superó la cantidad de claves para la que se reservó.
+         *
+         * @return `true` si se debe reconstruir con más bits.
+         */
+        bool lleno() const;
+
+        /**
+         * @brief Retorna la cantidad de claves agregadas.
+         *
+         * @return `size_t` Cantidad de claves.
+         */
+        size_t getClaves() const;
+
+        /**
+         * @brief Escribe el filtro en un archivo binario.
+         *
+         * @param archivo Archivo abierto para escritura.
+         * @return `true` si se escribió correctamente.
+         */
+        bool escribir(std::FILE* archivo) const;
+
+        /**
+         * @brief Lee un filtro escrito con `escribir`.
+         *
+         * @param archivo Archivo abierto para lectura.
+         * @return `true` si se leyó un filtro válido.
+         */
+        bool leer(std::FILE* archivo);
+};
+
+/**
+ * @enum FiltroExistencia
+ * @brief Filtros que se mantienen por conexión.
+ *
+ * - CLIENTES: Cédulas de la tabla Clientes.
+ * - CUENTAS: IDs de la tabla Cuentas.
+ * - CUENTAS_MONEDA: Cuentas por cliente y moneda (ver `claveCuentaMoneda`).
+ * - PRESTAMOS: IDs de la tabla Prestamos.
+ */
+enum class FiltroExistencia {
+    CLIENTES,
+    CUENTAS,
+    CUENTAS_MONEDA,
+    PRESTAMOS
+};
+
+/// @brief Cantidad de filtros por conexión.
+constexpr size_t CANTIDAD_FILTROS_EXISTENCIA = 4;
+
+/**
+ * @class FiltrosExistencia
+ * @brief Registro de filtros de Bloom por conexión a la base de datos.
+ *
+ * Los filtros son opcionales: mientras no se activen para una conexión, `puedeExistir` siempre
+ * retorna `true` y las consultas se ejecutan como antes. Al activarlos, se cargan del archivo
+ * indicado si corresponde a la misma base de datos, o se construyen recorriendo las tablas.
+ *
+ * Antes de cada verificación se comparan `PRAGMA data_version` (cambios de otras conexiones) y la
+ * cantidad de cambios de la propia conexión con los de la última sincronización; si alguno cambió,
+ * se agregan las filas con un ID mayor al último visto. Los IDs son `INTEGER PRIMARY KEY` sin
+ * `AUTOINCREMENT`, así que esto depende de que las filas de clientes, cuentas y préstamos nunca se
+ * eliminen, lo que imponen los triggers `trg_*_sin_eliminar` del esquema (`EsquemaBD.hpp`): si se
+ * eliminara la fila con el ID más alto, SQLite podría reutilizar ese ID para una fila nueva y la
+ * búsqueda de IDs mayores al último visto la omitiría.
+ *
+ * Una conexión debe usarse desde un solo hilo a la vez, igual que sus sentencias preparadas.
+ */
+class FiltrosExistencia {
+    public:
+        /**
+         * @brief Activa los filtros para una conexión.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param nombreArchivo Archivo donde se guardan los filtros al desactivarlos; vacío para no guardarlos.
+         * @return `true` si los filtros se activaron, `false` si no se pudieron construir.
+         */
+        static bool activar(sqlite3* db, const std::string& nombreArchivo = "");
+
+        /**
+         * @brief Guarda los filtros de una conexión en su archivo.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @return `true` si se guardaron, `false` si no están activos, no tienen archivo o falló la escritura.
+         */
+        static bool guardar(sqlite3* db);
+
+        /**
+         * @brief Guarda y desactiva los filtros de una conexión; se debe llamar antes de cerrarla.
+         *
+         * Database lo llama en su destructor.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @return `void`
+         */
+        static void desactivar(sqlite3* db);
+
+        /**
+         * @brief Indica si una clave puede existir en la base de datos.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param filtro Filtro a consultar.
+         * @param clave Cédula, ID o clave de `claveCuentaMoneda`.
+         * @return `false` si la clave no existe con seguridad, `true` si puede existir o los filtros no están activos.
+         */
+        static bool puedeExistir(sqlite3* db, FiltroExistencia filtro, int64_t clave);
+
+        /**
+         * @brief Retorna la clave de una cuenta según su cliente y moneda.
+         *
+         * @param idCliente ID del cliente.
+         * @param moneda Moneda de la cuenta.
+         * @return `int64_t` Clave para el filtro CUENTAS_MONEDA.
+         */
+        static int64_t claveCuentaMoneda(int idCliente, Moneda moneda);
+};
+
+#endif // FILTROS_EXISTENCIA_HPP
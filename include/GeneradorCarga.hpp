@@ -0,0 +1,186 @@
+/**
+ * @file GeneradorCarga.hpp
+ * @brief Declaración de la clase GeneradorCarga para simular sesiones concurrentes de ventanilla.
+ * @details Este archivo contiene la declaración de la clase GeneradorCarga, que ejecuta varias sesiones
+ *          de ventanilla en paralelo sobre la biblioteca (Cliente, Cuenta y Prestamo), con una mezcla
+ *          configurable de operaciones, tiempos de espera entre operaciones y una distribución Zipf de
+ *          las cuentas, y mide el rendimiento, los percentiles de latencia y los errores y bloqueos
+ *          de la base de datos a lo largo del tiempo.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef GENERADOR_CARGA_HPP
+#define GENERADOR_CARGA_HPP
+
+#include "Codigos.hpp"
+#include <sqlite3.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de operaciones que ejecutan las sesiones simuladas.
+constexpr int CANTIDAD_OPERACIONES_CARGA = 7;
+
+/// @brief Nombres de las operaciones en el orden de los índices de la mezcla.
+constexpr const char* OPERACIONES_CARGA[CANTIDAD_OPERACIONES_CARGA] = {"LOGIN", "SALDO", "DEP", "RET", "TRA", "CDP", "ABO"};
+
+/// @brief Cantidad de intervalos del histograma de latencias (32 subintervalos por potencia de dos, en us).
+constexpr int INTERVALOS_LATENCIA = 1184;
+
+/**
+ * @struct ParametrosCarga
+ * @brief Parámetros de una ejecución del generador de carga.
+ *
+ * - sesiones: Cantidad de sesiones de ventanilla concurrentes (un hilo y una conexión por sesión).
+ * - segundos: Duración de la ejecución.
+ * - pesos: Peso relativo de cada operación de `OPERACIONES_CARGA` en la mezcla.
+ * - esperaMediaMs: Tiempo medio de espera entre operaciones de una sesión (distribución exponencial).
+ * - exponenteZipf: Exponente de la distribución Zipf de las cuentas (0 para una distribución uniforme).
+ * - esperaOcupadaMs: Tiempo de espera de cada conexión cuando la base de datos está ocupada (0 como
+ *   en el programa principal, donde un bloqueo falla de inmediato).
+ * - intervalo: Duración en segundos de cada intervalo de la serie de tiempo.
+ * - semilla: Semilla base de los generadores aleatorios de las sesiones.
+ */
+struct ParametrosCarga {
+    unsigned int sesiones;
+    double segundos;
+    double pesos[CANTIDAD_OPERACIONES_CARGA];
+    double esperaMediaMs;
+    double exponenteZipf;
+    int esperaOcupadaMs;
+    double intervalo;
+    uint64_t semilla;
+};
+
+/**
+ * @namespace CargaDef
+ * @brief Perfiles predeterminados del generador de carga.
+ *
+ * - NORMAL: Día normal, con predominio de consultas y tiempo de atención entre operaciones.
+ * - CIERRE_MES: Cierre de mes, con predominio de depósitos, retiros y transferencias sin espera y
+ *   concentradas en pocas cuentas (planillas), que reproduce la contención de las sucursales.
+ */
+namespace CargaDef {
+    const ParametrosCarga NORMAL = {8, 10.0, {10, 40, 15, 15, 10, 2, 8}, 50.0, 0.9, 0, 1.0, 20241128};
+    const ParametrosCarga CIERRE_MES = {32, 10.0, {5, 15, 30, 20, 20, 2, 8}, 0.0, 1.2, 0, 1.0, 20241128};
+}
+
+/**
+ * @struct EstadisticasCarga
+ * @brief Estadísticas de una operación durante la ejecución.
+ *
+ * - ejecutadas: Cantidad de operaciones ejecutadas.
+ * - errores: Operaciones fallidas por cualquier motivo (incluye las ocupadas).
+ * - ocupadas: Operaciones fallidas porque la base de datos estaba bloqueada (`SQLITE_BUSY`/`SQLITE_LOCKED`).
+ * - promedioUs, p50Us, p95Us, p99Us, maximoUs: Latencia en microsegundos.
+ */
+struct EstadisticasCarga {
+    uint64_t ejecutadas = 0;
+    uint64_t errores = 0;
+    uint64_t ocupadas = 0;
+    double promedioUs = 0.0;
+    double p50Us = 0.0;
+    double p95Us = 0.0;
+    double p99Us = 0.0;
+    double maximoUs = 0.0;
+};
+
+/**
+ * @struct IntervaloCarga
+ * @brief Totales de un intervalo de la serie de tiempo.
+ */
+struct IntervaloCarga {
+    uint64_t ejecutadas = 0;
+    uint64_t errores = 0;
+    uint64_t ocupadas = 0;
+};
+
+/**
+ * @struct ResultadoCarga
+ * @brief Resultado de una ejecución del generador de carga.
+ *
+ * - operaciones: Estadísticas por operación, en el orden de `OPERACIONES_CARGA`.
+ * - total: Estadísticas de todas las operaciones.
+ * - intervalos: Serie de tiempo de operaciones, errores y bloqueos.
+ * - intervalo: Duración en segundos de cada intervalo.
+ * - sesiones: Cantidad de sesiones simuladas.
+ * - segundos: Duración real de la ejecución.
+ */
+struct ResultadoCarga {
+    EstadisticasCarga operaciones[CANTIDAD_OPERACIONES_CARGA];
+    EstadisticasCarga total;
+    std::vector<IntervaloCarga> intervalos;
+    double intervalo = 1.0;
+    unsigned int sesiones = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @class GeneradorCarga
+ * @brief Generador de carga que simula sesiones de ventanilla concurrentes sobre la biblioteca.
+ *
+ * Cada sesión usa su propio hilo y su propia conexión a la base de datos, igual que varias instancias
+ * del programa principal en distintas sucursales, y llama directamente a los métodos de Cliente,
+ * Cuenta y Prestamo. La salida de consola de esos métodos se descarta durante la ejecución.
+ */
+class GeneradorCarga {
+    private:
+        /// @brief Nombre del archivo de la base de datos.
+        std::string nombreDB;
+
+        /// @brief Cuentas disponibles, con su moneda y la cédula de su cliente.
+        std::vector<int> cuentas;
+        std::vector<Moneda> monedas;
+        std::vector<int> cedulas;
+
+        /// @brief Préstamos activos con la cuenta desde la que se abonan.
+        std::vector<int> prestamos;
+        std::vector<int> cuentasPrestamo;
+
+    public:
+        /**
+         * @brief Constructor de la clase GeneradorCarga.
+         *
+         * @param nombreDB Nombre del archivo de la base de datos.
+         */
+        explicit GeneradorCarga(const std::string& nombreDB);
+
+        /**
+         * @brief Carga las cuentas y los préstamos activos sobre los que se generan las operaciones.
+         *
+         * @param db Conexión a la base de datos SQLite.
+         * @return `true` si hay al menos una cuenta, `false` en caso contrario.
+         */
+        bool cargar(sqlite3* db);
+
+        /**
+         * @brief Ejecuta las sesiones simuladas durante el tiempo indicado.
+         *
+         * @param parametros Parámetros de la ejecución.
+         * @return `ResultadoCarga` Estadísticas por operación y serie de tiempo.
+         */
+        ResultadoCarga ejecutar(const ParametrosCarga& parametros) const;
+
+        /**
+         * @brief Muestra el resultado de una ejecución en formato tabular en la terminal.
+         *
+         * @param resultado Resultado de la ejecución.
+         * @return `void`
+         */
+        static void mostrarResultado(const ResultadoCarga& resultado);
+
+        /**
+         * @brief Exporta la serie de tiempo de una ejecución a un archivo `.csv`.
+         *
+         * @param resultado Resultado de la ejecución.
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @return `true` si el archivo se generó correctamente, `false` en caso contrario.
+         */
+        static bool exportarCSV(const ResultadoCarga& resultado, const std::string& nombreArchivo);
+};
+
+#endif // GENERADOR_CARGA_HPP
@@ -0,0 +1,110 @@
+/**
+ * @file ImportadorCSV.hpp
+ * @brief Declaración de la clase ImportadorCSV para la carga masiva de clientes y cuentas.
+ * @details Este archivo contiene la declaración de la clase ImportadorCSV, que importa archivos `.csv` de
+ *          clientes y de cuentas (por ejemplo, al migrar una cartera) sin pasar por Cliente::crear y
+ *          Cuenta::crear: valida cada fila en memoria, detecta duplicados con conjuntos cargados una sola
+ *          vez desde la base de datos e inserta con sentencias preparadas en transacciones grandes.
+ *
+ *          Formato de los archivos (la primera fila puede ser un encabezado):
+ *          - Clientes: `cedula,nombre,primerApellido,segundoApellido,telefono`
+ *          - Cuentas: `cedula,moneda,saldo,tasaInteres`
+ *
+ *          El segundo apellido y el teléfono pueden estar vacíos; el teléfono, si se indica, debe tener
+ *          el formato `####-####`. Igual que en el menú, el saldo de una cuenta nueva se registra como un
+ *          depósito inicial en `Transacciones`.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef IMPORTADOR_CSV_HPP
+#define IMPORTADOR_CSV_HPP
+
+#include <sqlite3.h>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de filas insertadas en cada transacción.
+constexpr size_t FILAS_POR_TRANSACCION_IMPORTACION = 100000;
+
+/// @brief Cantidad máxima de filas rechazadas que se guardan con su detalle.
+constexpr size_t MAXIMO_DETALLE_RECHAZOS = 100;
+
+/**
+ * @struct RechazoImportacion
+ * @brief Fila del archivo que no se importó.
+ *
+ * - fila: Número de fila en el archivo.
+ * - motivo: Motivo del rechazo.
+ */
+struct RechazoImportacion {
+    size_t fila;
+    std::string motivo;
+};
+
+/**
+ * @struct ResultadoImportacion
+ * @brief Resultado de la importación de un archivo.
+ *
+ * - filas: Filas de datos leídas (sin el encabezado).
+ * - importadas: Filas insertadas en la base de datos.
+ * - invalidas: Filas rechazadas por datos inválidos.
+ * - duplicadas: Filas rechazadas por duplicar un registro existente o anterior del archivo.
+ * - rechazos: Detalle de las primeras `MAXIMO_DETALLE_RECHAZOS` filas rechazadas.
+ * - segundos: Tiempo total de la importación.
+ */
+struct ResultadoImportacion {
+    size_t filas = 0;
+    size_t importadas = 0;
+    size_t invalidas = 0;
+    size_t duplicadas = 0;
+    std::vector<RechazoImportacion> rechazos;
+    double segundos = 0.0;
+};
+
+/**
+ * @class ImportadorCSV
+ * @brief Importación masiva de clientes y cuentas desde archivos `.csv`.
+ *
+ * Si ocurre un error de la base de datos, se revierte la transacción en curso y la importación se
+ * detiene; las transacciones anteriores quedan confirmadas y se reflejan en `importadas`, por lo que
+ * el archivo se puede volver a importar completo (las filas ya importadas se rechazan como duplicadas).
+ */
+class ImportadorCSV {
+    public:
+        /**
+         * @brief Importa clientes desde un archivo `.csv`.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param nombreArchivo Nombre del archivo a importar.
+         * @param resultado Filas importadas y rechazadas.
+         * @return `true` si se leyó todo el archivo, `false` si no se pudo abrir o falló la base de datos.
+         */
+        static bool importarClientes(sqlite3* db, const std::string& nombreArchivo, ResultadoImportacion& resultado);
+
+        /**
+         * @brief Importa cuentas desde un archivo `.csv`.
+         *
+         * Cada cuenta se asocia al cliente con la cédula indicada, que ya debe existir. Un cliente
+         * solo puede tener una cuenta por moneda.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param nombreArchivo Nombre del archivo a importar.
+         * @param resultado Filas importadas y rechazadas.
+         * @return `true` si se leyó todo el archivo, `false` si no se pudo abrir o falló la base de datos.
+         */
+        static bool importarCuentas(sqlite3* db, const std::string& nombreArchivo, ResultadoImportacion& resultado);
+
+        /**
+         * @brief Muestra el resultado de una importación en la terminal.
+         *
+         * @param resultado Resultado de la importación.
+         * @return `void`
+         */
+        static void mostrarResultado(const ResultadoImportacion& resultado);
+};
+
+#endif // IMPORTADOR_CSV_HPP
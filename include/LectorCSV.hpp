@@ -0,0 +1,91 @@
+/**
+ * @file LectorCSV.hpp
+ * @brief Declaración de la clase LectorCSV para leer archivos `.csv` grandes.
+ * @details Este archivo contiene la declaración de la clase LectorCSV, que lee un archivo `.csv` por bloques
+ *          grandes y separa cada fila en campos como `std::string_view` sobre su propio buffer, sin reservar
+ *          memoria por fila.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef LECTOR_CSV_HPP
+#define LECTOR_CSV_HPP
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Tamaño inicial del buffer de lectura (1 MiB).
+constexpr size_t TAMANO_BUFFER_LECTURA_CSV = 1 << 20;
+
+/**
+ * @class LectorCSV
+ * @brief Lector de archivos `.csv` por filas.
+ *
+ * Acepta campos entre comillas (con comillas internas duplicadas, comas y saltos de línea) y filas
+ * terminadas en `\n` o `\r\n`. Los campos de una fila son válidos hasta la siguiente llamada a
+ * `siguienteFila`.
+ */
+class LectorCSV {
+    private:
+        std::FILE* archivo;
+        std::vector<char> buffer;
+        size_t inicio = 0;       // Inicio de la fila actual en el buffer
+        size_t fin = 0;          // Fin de los datos leídos en el buffer
+        bool finArchivo = false;
+        size_t numeroFila = 0;
+        std::vector<std::string_view> campos;
+
+        // Mueve la fila incompleta al inicio del buffer y lee más datos
+        bool leerBloque();
+
+    public:
+        /**
+         * @brief Constructor que abre el archivo a leer.
+         *
+         * @param nombreArchivo Nombre del archivo `.csv`.
+         */
+        explicit LectorCSV(const std::string& nombreArchivo);
+
+        /**
+         * @brief Destructor que cierra el archivo.
+         */
+        ~LectorCSV();
+
+        LectorCSV(const LectorCSV&) = delete;
+        LectorCSV& operator=(const LectorCSV&) = delete;
+
+        /**
+         * @brief Indica si el archivo se abrió correctamente.
+         *
+         * @return `true` si el archivo está abierto.
+         */
+        bool abierto() const;
+
+        /**
+         * @brief Lee la siguiente fila del archivo.
+         *
+         * @return `true` si se leyó una fila, `false` al llegar al final del archivo.
+         */
+        bool siguienteFila();
+
+        /**
+         * @brief Retorna los campos de la fila actual.
+         *
+         * @return `const std::vector<std::string_view>&` Campos de la fila.
+         */
+        const std::vector<std::string_view>& getCampos() const;
+
+        /**
+         * @brief Retorna el número de la fila actual (la primera fila es 1).
+         *
+         * @return `size_t` Número de fila.
+         */
+        size_t getNumeroFila() const;
+};
+
+#endif // LECTOR_CSV_HPP
@@ -0,0 +1,349 @@
+/**
+ * @file LibroMayor.hpp
+ * @brief Declaración de la clase LibroMayor, un libro de saldos en memoria con escritura diferida.
+ * @details Este archivo contiene la declaración de la clase LibroMayor, que mantiene en memoria el saldo
+ *          de todas las cuentas repartido en fragmentos alineados a la línea de caché, cada uno con su
+ *          propio cerrojo de giro. Los depósitos, retiros y transferencias se aplican en memoria y se
+ *          anotan en un registro ordenado que un hilo escritor guarda en `Cuentas` y `Transacciones`
+ *          por lotes, de modo que las transferencias entre cuentas de fragmentos distintos avanzan en
+ *          paralelo en lugar de esperar al único escritor de SQLite.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef LIBRO_MAYOR_HPP
+#define LIBRO_MAYOR_HPP
+
+#include "Codigos.hpp"
+#include "Database.hpp"
+#include <sqlite3.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief Tamaño de la línea de caché; cada fragmento empieza en una línea propia.
+constexpr size_t LINEA_CACHE = 64;
+
+/// @brief Cantidad de fragmentos del libro; la cuenta `id` pertenece al fragmento `id % FRAGMENTOS_LIBRO`.
+constexpr int FRAGMENTOS_LIBRO = 64;
+
+/// @brief Movimientos sin guardar a partir de los cuales las operaciones esperan al escritor.
+constexpr size_t MAXIMO_PENDIENTES_LIBRO = 1 << 21;
+
+/// @brief Tiempo máximo que el escritor espera antes de guardar los movimientos pendientes.
+constexpr int ESPERA_ESCRITOR_LIBRO_MS = 5;
+
+/// @brief Intentos seguidos de guardar un lote antes de considerar que el escritor falló.
+constexpr int REINTENTOS_ESCRITOR_LIBRO = 3;
+
+/**
+ * @enum EstadoLibro
+ * @brief Resultado de una operación del libro.
+ */
+enum class EstadoLibro : uint8_t {
+    OK,
+    CUENTA_INEXISTENTE,
+    MONTO_INVALIDO,
+    FONDOS_INSUFICIENTES,
+    MONEDA_DISTINTA,
+    ESCRITURA_FALLIDA
+};
+
+/**
+ * @brief Retorna el mensaje de error de un estado del libro.
+ *
+ * @param estado Estado de la operación.
+ * @return `const char*` Mensaje para mostrar al usuario.
+ */
+const char* mensajeEstado(EstadoLibro estado);
+
+/**
+ * @class CerrojoGiro
+ * @brief Cerrojo de giro para secciones críticas de pocas instrucciones.
+ *
+ * Mientras está ocupado, los hilos que esperan solo leen la bandera, sin escribir la línea de caché
+ * del dueño, y ceden el procesador después de `GIROS`. Cumple con `Lockable` para usarse con
+ * `std::lock_guard`.
+ */
+class CerrojoGiro {
+    private:
+        std::atomic<bool> ocupado{false};
+
+    public:
+        /// @brief Intentos de espera activa antes de ceder el procesador.
+        static constexpr int GIROS = 64;
+
+        void lock() noexcept;
+        bool try_lock() noexcept { return !ocupado.exchange(true, std::memory_order_acquire); }
+        void unlock() noexcept { ocupado.store(false, std::memory_order_release); }
+};
+
+/**
+ * @struct CuentaLibro
+ * @brief Saldo y moneda de una cuenta en el libro.
+ */
+struct CuentaLibro {
+    double saldo = 0;
+    Moneda moneda = Moneda::CRC;
+    bool existe = false;
+};
+
+/**
+ * @struct MovimientoLibro
+ * @brief Movimiento aplicado en memoria y pendiente de guardar.
+ *
+ * - secuencia: Orden global en que se aplicó el movimiento.
+ * - idRemitente e idDestinatario: Cuentas del movimiento, -1 si no aplica (como en `Transaccion`).
+ */
+struct MovimientoLibro {
+    uint64_t secuencia;
+    int idRemitente;
+    int idDestinatario;
+    TipoTransaccion tipo;
+    double monto;
+};
+
+/**
+ * @struct FragmentoLibro
+ * @brief Fragmento del libro: cerrojo, saldos de sus cuentas y registro de sus movimientos.
+ *
+ * La cuenta `id` ocupa la posición `id / FRAGMENTOS_LIBRO` de `cuentas`. El registro se guarda en el
+ * mismo fragmento que la cuenta de origen, bajo el mismo cerrojo que protege su saldo.
+ */
+struct alignas(LINEA_CACHE) FragmentoLibro {
+    CerrojoGiro cerrojo;
+    std::vector<CuentaLibro> cuentas;
+    std::vector<MovimientoLibro> registro;
+};
+
+/**
+ * @struct EstadisticasLibro
+ * @brief Contadores del libro y de su escritor.
+ *
+ * - aplicados y guardados: Movimientos aplicados en memoria y guardados en la base de datos.
+ * - lotes: Transacciones de SQLite del escritor.
+ * - cuentasActualizadas: Filas de `Cuentas` actualizadas (una por cuenta y lote).
+ * - segundosEscritura: Tiempo del escritor dentro de las transacciones.
+ * - errores: Intentos de guardar un lote que fallaron.
+ * - sinGuardar: Movimientos aplicados en memoria que no se pudieron guardar al cerrar el libro.
+ */
+struct EstadisticasLibro {
+    uint64_t aplicados = 0;
+    uint64_t guardados = 0;
+    uint64_t lotes = 0;
+    uint64_t cuentasActualizadas = 0;
+    double segundosEscritura = 0;
+    uint64_t errores = 0;
+    uint64_t sinGuardar = 0;
+};
+
+/**
+ * @struct ResultadoPruebaLibro
+ * @brief Resultado de una prueba de transferencias concurrentes.
+ *
+ * - hilos y transferencias: Parámetros de la prueba.
+ * - exitosas y rechazadas: Transferencias aplicadas y rechazadas (por ejemplo, por fondos).
+ * - segundosMemoria: Tiempo hasta aplicar todas las transferencias en memoria.
+ * - segundosGuardado: Tiempo adicional hasta guardarlas en la base de datos.
+ */
+struct ResultadoPruebaLibro {
+    unsigned int hilos = 0;
+    long long transferencias = 0;
+    long long exitosas = 0;
+    long long rechazadas = 0;
+    double segundosMemoria = 0;
+    double segundosGuardado = 0;
+};
+
+/**
+ * @class LibroMayor
+ * @brief Saldos de las cuentas en memoria con cerrojos por fragmento y escritura diferida ordenada.
+ *
+ * Una transferencia toma los cerrojos de sus dos fragmentos en orden de índice, por lo que dos
+ * transferencias en sentidos opuestos no se bloquean mutuamente. Cada movimiento recibe un número de
+ * secuencia mientras se tienen sus cerrojos; el escritor toma todos los cerrojos en el mismo orden
+ * para vaciar los registros, de modo que cada lote contiene todos los movimientos anteriores a él y se
+ * guarda en orden de secuencia. Los saldos se guardan como diferencias (`saldo = saldo + ?`) e
+ * incrementan `version`, por lo que las sesiones de `Cuenta` detectan el cambio y recargan la cuenta.
+ *
+ * El libro asume que es el único que modifica los saldos de las cuentas mientras está abierto: los
+ * cambios hechos por otros programas se conservan en la base de datos, pero el libro no los ve.
+ * Los movimientos aplicados se pierden si el proceso termina antes de `persistir` o `cerrar`.
+ *
+ * Si un lote no se puede guardar después de `REINTENTOS_ESCRITOR_LIBRO` intentos seguidos, el libro
+ * queda en falla: las operaciones se rechazan con `ESCRITURA_FALLIDA` sin modificar los saldos, y
+ * `persistir` retorna `false` en lugar de esperar. El escritor sigue intentando y el libro sale de la
+ * falla cuando el lote se guarda.
+ */
+class LibroMayor {
+    private:
+        /// @brief Fragmentos del libro, alineados a la línea de caché.
+        std::unique_ptr<FragmentoLibro[]> fragmentos;
+
+        /// @brief Siguiente número de secuencia, en su propia línea de caché.
+        alignas(LINEA_CACHE) std::atomic<uint64_t> secuencia{0};
+
+        /// @brief Movimientos aplicados y aún no guardados.
+        alignas(LINEA_CACHE) std::atomic<size_t> pendientes{0};
+
+        /// @brief Conexión del hilo escritor.
+        Database db;
+
+        std::mutex mutex;
+        std::condition_variable condicionEscritor;
+        std::condition_variable condicionGuardado;
+        bool cerrado = false;
+        bool urgente = false;
+        std::atomic<bool> fallido{false};
+        EstadisticasLibro contadores;
+        std::thread escritor;
+
+        // Retorna la cuenta `idCuenta` de su fragmento, o nullptr si no existe; requiere el cerrojo del fragmento
+        CuentaLibro* buscar(int idCuenta);
+
+        // Anota un movimiento en el registro de un fragmento; requiere el cerrojo del fragmento
+        void registrar(FragmentoLibro& fragmento, int idRemitente, int idDestinatario, TipoTransaccion tipo, double monto);
+
+        // Espera al escritor si hay demasiados movimientos pendientes; retorna false si el escritor falló
+        bool limitarPendientes();
+
+        // Toma todos los cerrojos en orden y vacía los registros en orden de secuencia; `repuestos` tiene un
+        // registro vacío por fragmento, que se entrega al fragmento para conservar su capacidad
+        std::vector<MovimientoLibro> vaciarRegistros(std::vector<std::vector<MovimientoLibro>>& repuestos);
+
+        // Guarda un lote de movimientos en una transacción
+        bool guardar(const std::vector<MovimientoLibro>& movimientos, uint64_t& cuentasActualizadas);
+
+        // Ciclo del hilo escritor
+        void escribir();
+
+    public:
+        /**
+         * @brief Constructor de la clase LibroMayor.
+         *
+         * Carga el saldo de todas las cuentas e inicia el hilo escritor. La conexión del escritor queda
+         * en modo WAL.
+         *
+         * @param nombreDB Nombre del archivo de la base de datos.
+         * @throws std::runtime_error Si no se puede abrir la base de datos o cargar las cuentas.
+         */
+        explicit LibroMayor(const std::string& nombreDB);
+
+        /**
+         * @brief Destructor que guarda los movimientos pendientes y detiene el escritor.
+         */
+        ~LibroMayor();
+
+        LibroMayor(const LibroMayor&) = delete;
+        LibroMayor& operator=(const LibroMayor&) = delete;
+
+        /**
+         * @brief Deposita un monto en una cuenta.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @param monto Monto a depositar.
+         * @param saldo Si no es nulo, recibe el saldo de la cuenta después del depósito.
+         * @return `EstadoLibro` Resultado de la operación.
+         */
+        EstadoLibro depositar(int idCuenta, double monto, double* saldo = nullptr);
+
+        /**
+         * @brief Retira un monto de una cuenta si tiene fondos suficientes.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @param monto Monto a retirar.
+         * @param saldo Si no es nulo, recibe el saldo de la cuenta después del retiro.
+         * @return `EstadoLibro` Resultado de la operación.
+         */
+        EstadoLibro retirar(int idCuenta, double monto, double* saldo = nullptr);
+
+        /**
+         * @brief Transfiere un monto entre dos cuentas de la misma moneda.
+         *
+         * @param idCuenta ID de la cuenta de origen.
+         * @param idCuentaDestino ID de la cuenta de destino.
+         * @param monto Monto a transferir.
+         * @param saldo Si no es nulo, recibe el saldo de la cuenta de origen después de la transferencia.
+         * @return `EstadoLibro` Resultado de la operación.
+         */
+        EstadoLibro transferir(int idCuenta, int idCuentaDestino, double monto, double* saldo = nullptr);
+
+        /**
+         * @brief Consulta el saldo de una cuenta en memoria.
+         *
+         * @param idCuenta ID de la cuenta.
+         * @param saldo Recibe el saldo de la cuenta.
+         * @return `true` si la cuenta existe, `false` en caso contrario.
+         */
+        bool verSaldo(int idCuenta, double& saldo);
+
+        /**
+         * @brief Espera hasta que los movimientos aplicados antes de la llamada estén guardados.
+         *
+         * @return `true` si se guardaron, `false` si el escritor falló antes de guardarlos.
+         */
+        bool persistir();
+
+        /**
+         * @brief Guarda los movimientos pendientes y detiene el escritor.
+         *
+         * El último lote se intenta guardar hasta `REINTENTOS_ESCRITOR_LIBRO` veces. No se deben
+         * realizar operaciones después de cerrar el libro: ya no se guardarían.
+         *
+         * @return `true` si todos los movimientos aplicados quedaron guardados, `false` si alguno se
+         *         perdió (la cantidad queda en `EstadisticasLibro::sinGuardar`).
+         */
+        bool cerrar();
+
+        /**
+         * @brief Cuenta las cuentas cuyo saldo en memoria difiere del de la base de datos.
+         *
+         * Se debe llamar después de `persistir` y sin operaciones en curso.
+         *
+         * @param conexion Conexión a la base de datos SQLite.
+         * @return `long long` Cantidad de cuentas con saldo distinto, o -1 si no se pudieron leer.
+         */
+        long long diferencias(sqlite3* conexion);
+
+        /**
+         * @brief Retorna una copia de los contadores del libro.
+         *
+         * @return `EstadisticasLibro` Contadores actuales.
+         */
+        EstadisticasLibro estadisticas();
+
+        /**
+         * @brief Ejecuta transferencias aleatorias entre un grupo de cuentas desde varios hilos.
+         *
+         * Cada hilo transfiere montos pequeños entre pares de cuentas del grupo. Mide el tiempo hasta
+         * aplicarlas en memoria y el tiempo adicional hasta guardarlas.
+         *
+         * @param libro Libro sobre el que se ejecutan las transferencias.
+         * @param cuentas IDs de las cuentas del grupo, todas de la misma moneda.
+         * @param hilos Cantidad de hilos.
+         * @param transferencias Cantidad total de transferencias.
+         * @return `ResultadoPruebaLibro` Resultado de la prueba.
+         */
+        static ResultadoPruebaLibro probar(LibroMayor& libro, const std::vector<int>& cuentas,
+                                           unsigned int hilos, long long transferencias);
+
+        /**
+         * @brief Muestra los resultados de varias pruebas y la aceleración con respecto a la primera.
+         *
+         * @param resultados Resultados en orden de cantidad de hilos.
+         * @param estadisticas Contadores del libro al terminar.
+         * @return `void`
+         */
+        static void mostrarResultado(const std::vector<ResultadoPruebaLibro>& resultados, const EstadisticasLibro& estadisticas);
+};
+
+#endif // LIBRO_MAYOR_HPP
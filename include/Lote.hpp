@@ -0,0 +1,135 @@
+/**
+ * @file Lote.hpp
+ * @brief Declaración de la clase Lote para ejecutar scripts de operaciones sin interacción.
+ * @details Este archivo contiene la declaración de la clase Lote, que lee un archivo de operaciones
+ *          (una por línea) y las ejecuta directamente con las clases Cliente, Cuenta y Prestamo, sin
+ *          solicitar datos al usuario ni mostrar mensajes por cada operación. Al finalizar se obtiene
+ *          un resumen con los tiempos por tipo de operación y las líneas que fallaron.
+ *
+ *          Formato de cada línea (los campos se separan con espacios y `#` inicia un comentario):
+ *          - `NEW_CLIENT <cedula> <nombre> <primerApellido> <segundoApellido> <telefono>`
+ *          - `NEW_ACCOUNT <cedula> <moneda> <saldoInicial> <tasaInteres>`
+ *          - `DEP <idCuenta> <monto>`
+ *          - `RET <idCuenta> <monto>`
+ *          - `TRA <idCuentaOrigen> <idCuentaDestino> <monto>`
+ *          - `ABO <idPrestamo> <idCuenta> [cuotas]`
+ *          - `CDP <idCuenta> <monto> <plazoMeses> <tasaInteres>`
+ *          - `LOAN <idCuenta> <PER|PRE|HIP> [monto plazoMeses tasaInteres]`
+ *
+ *          En `NEW_CLIENT`, un `-` indica un segundo apellido o teléfono vacío. En `LOAN`, si no se
+ *          indican monto, plazo y tasa se usan los valores predeterminados del tipo de préstamo.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef LOTE_HPP
+#define LOTE_HPP
+
+#include <sqlite3.h>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de tipos de operación de un lote.
+constexpr int CANTIDAD_OPERACIONES_LOTE = 8;
+
+/// @brief Nombres de las operaciones de un lote, en el orden de los índices del resumen.
+constexpr const char* OPERACIONES_LOTE[CANTIDAD_OPERACIONES_LOTE] = {
+    "NEW_CLIENT", "NEW_ACCOUNT", "DEP", "RET", "TRA", "ABO", "CDP", "LOAN"
+};
+
+/**
+ * @struct EstadisticasOperacion
+ * @brief Resumen de las ejecuciones de un tipo de operación.
+ *
+ * - ejecutadas: Cantidad de líneas con la operación.
+ * - fallidas: Cantidad de líneas que fallaron.
+ * - segundos: Tiempo total de ejecución de la operación.
+ */
+struct EstadisticasOperacion {
+    int ejecutadas = 0;
+    int fallidas = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @struct FalloLote
+ * @brief Línea del lote que no se pudo ejecutar.
+ *
+ * - linea: Número de línea en el archivo.
+ * - detalle: Mensajes de error generados por la operación.
+ */
+struct FalloLote {
+    int linea;
+    std::string detalle;
+};
+
+/**
+ * @struct ResultadoLote
+ * @brief Resultado de la ejecución de un lote.
+ *
+ * - operaciones: Estadísticas por tipo de operación.
+ * - fallos: Líneas que fallaron, en el orden del archivo.
+ * - lineas: Cantidad de líneas con operaciones.
+ * - segundos: Tiempo total de ejecución.
+ */
+struct ResultadoLote {
+    EstadisticasOperacion operaciones[CANTIDAD_OPERACIONES_LOTE];
+    std::vector<FalloLote> fallos;
+    int lineas = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @class Lote
+ * @brief Ejecutor de scripts de operaciones bancarias sin interacción con el usuario.
+ *
+ * Cada línea se ejecuta con su propia transacción (la de cada método de Cuenta o Prestamo), de
+ * modo que una línea con error no afecta a las demás. Durante la ejecución una CapturaSalida
+ * descarta la salida de las clases y sus mensajes de error se guardan como detalle de la línea que falló.
+ */
+class Lote {
+    private:
+        /// @brief Conexión a la base de datos.
+        sqlite3* db;
+
+        /**
+         * @brief Ejecuta una operación con sus argumentos.
+         *
+         * @param indice Índice de la operación en `OPERACIONES_LOTE`.
+         * @param argumentos Argumentos de la línea, después del nombre de la operación.
+         * @return `true` si la operación fue exitosa, `false` en caso contrario.
+         * @throws std::invalid_argument Si faltan argumentos o alguno es inválido.
+         */
+        bool ejecutarOperacion(int indice, std::istringstream& argumentos);
+
+    public:
+        /**
+         * @brief Constructor de la clase Lote.
+         *
+         * @param db Conexión a la base de datos SQLite.
+         */
+        explicit Lote(sqlite3* db);
+
+        /**
+         * @brief Ejecuta todas las operaciones de un flujo de entrada.
+         *
+         * @param entrada Flujo con una operación por línea.
+         * @return `ResultadoLote` Tiempos por operación y líneas que fallaron.
+         */
+        ResultadoLote ejecutar(std::istream& entrada);
+
+        /**
+         * @brief Muestra el resumen de la ejecución de un lote.
+         *
+         * @param resultado Resultado del lote.
+         * @return `void`
+         */
+        static void mostrarResumen(const ResultadoLote& resultado);
+};
+
+#endif // LOTE_HPP
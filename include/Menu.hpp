@@ -19,6 +19,7 @@
 #include <iostream>
 #include "constants.hpp"
 #include "Cuenta.hpp"
+#include "Prestamo.hpp"
 
 /**
  * @brief Muestra el menú principal de la aplicación.
@@ -71,6 +72,17 @@ void iniciarSesionCliente(sqlite3* db);
  */
 void registrarCliente(sqlite3* db);
 
+/**
+ * @brief Busca clientes por nombre, apellidos o teléfono.
+ * 
+ * Solicita el texto a buscar y muestra la cédula, el nombre completo y el teléfono de los
+ * clientes encontrados, ordenados por relevancia.
+ * 
+ * @param db Puntero a la base de datos SQLite.
+ * @return `void`
+ */
+void buscarCliente(sqlite3* db);
+
 /**
  * @brief Muestra y gestiona el menú de operaciones del cliente.
  * 
@@ -114,6 +126,19 @@ void manejarCDP(sqlite3* db, Cuenta& cuenta);
  */
 void manejarAbonoPrestamo(sqlite3* db, Cuenta& cuenta);
 
+/**
+ * @brief Realiza un abono a un préstamo según el tipo de abono elegido.
+ * 
+ * Permite pagar la cuota mensual, varias cuotas en una sola operación o un abono
+ * extraordinario al capital.
+ * 
+ * @param db Puntero a la base de datos SQLite.
+ * @param prestamo Referencia al préstamo a abonar.
+ * @param cuenta Referencia a la cuenta desde la que se realiza el abono.
+ * @return `true` si el abono se realizó, `false` si falló o fue cancelado.
+ */
+bool realizarAbonoPrestamo(sqlite3* db, Prestamo& prestamo, Cuenta& cuenta);
+
 /**
  * @brief Realiza un depósito en la cuenta.
  * 
@@ -147,6 +172,18 @@ void realizarTransferencia(sqlite3* db, Cuenta& cuenta);
  */
 void realizarRetiro(sqlite3* db, Cuenta& cuenta);
 
+/**
+ * @brief Exporta el estado de cuenta a un archivo (.csv).
+ * 
+ * Solicita un rango de fechas opcional y el nombre del archivo, y escribe los movimientos de la
+ * cuenta actual en orden de fecha.
+ * 
+ * @param db Puntero a la base de datos SQLite.
+ * @param cuenta Referencia a la cuenta del cliente.
+ * @return `void`
+ */
+void exportarEstadoCuenta(sqlite3* db, Cuenta& cuenta);
+
 /**
  * @brief Muestra y gestiona el menú de préstamos.
  * 
@@ -186,5 +223,37 @@ void solicitarPrestamo(sqlite3* db);
  */
 void consultarPrestamos(sqlite3* db);
 
+/**
+ * @brief Genera una tabla de cuotas mensuales por plazo y tasa.
+ * 
+ * Permite seleccionar el tipo de préstamo y la moneda, ajustar el rango de plazos y tasas,
+ * y exportar la tabla resultante a un archivo `.csv`.
+ * 
+ * @return `void`
+ */
+void generarTablaCuotas();
+
+/**
+ * @brief Genera el reporte de mora de la cartera de préstamos.
+ * 
+ * Actualiza los días de atraso de los préstamos vencidos, muestra los préstamos activos y su saldo
+ * por rango de días de atraso, moneda y tipo, y permite exportar el reporte a un archivo `.csv`.
+ * 
+ * @param db Puntero a la base de datos SQLite.
+ * @return `void`
+ */
+void reporteMora(sqlite3* db);
+
+/**
+ * @brief Genera el reporte de estado de todos los préstamos.
+ * 
+ * Escribe en un archivo `.csv` la cuota, cuotas pagadas, capital e intereses pagados y cuotas
+ * restantes de cada préstamo, y muestra los totales por tipo y moneda.
+ * 
+ * @param db Puntero a la base de datos SQLite.
+ * @return `void`
+ */
+void reporteCartera(sqlite3* db);
+
 
 #endif // MENU_HPP
\ No newline at end of file
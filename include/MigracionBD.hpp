@@ -0,0 +1,139 @@
+/**
+ * @file MigracionBD.hpp
+ * @brief Declaración de la clase MigracionBD para actualizar el esquema de una base de datos existente.
+ * @details Este archivo contiene la declaración de la clase MigracionBD, que lleva una base de datos a
+ *          la versión actual de `EsquemaBD.hpp`. Una base de datos de la versión 1 (monedas y tipos como
+ *          texto, tablas sin `STRICT`) se reconstruye copiando las filas por bloques a un archivo nuevo;
+ *          las versiones posteriores se actualizan en el mismo archivo aplicando en orden las
+ *          `MIGRACIONES`, con los pasos de datos en transacciones cortas que se pueden reanudar.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef MIGRACION_BD_HPP
+#define MIGRACION_BD_HPP
+
+#include "PlanesConsulta.hpp"
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de filas que se copian en cada transacción de la reconstrucción desde la versión 1.
+constexpr long long FILAS_POR_BLOQUE_MIGRACION = 100000;
+
+/// @brief Cantidad de llaves que abarca cada transacción de un paso de datos sobre la base de datos en uso.
+constexpr long long FILAS_POR_BLOQUE_DATOS = 10000;
+
+/// @brief Pausa entre los bloques de un paso de datos, para que las ventanillas obtengan el bloqueo de escritura.
+constexpr int PAUSA_ENTRE_BLOQUES_MS = 5;
+
+/// @brief Tiempo máximo de espera por el bloqueo de escritura de la base de datos.
+constexpr int ESPERA_BLOQUEO_MIGRACION_MS = 5000;
+
+/**
+ * @struct TablaMigrada
+ * @brief Cantidad de filas copiadas de una tabla y el tiempo que tomó.
+ */
+struct TablaMigrada {
+    std::string nombre;
+    long long filas = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @struct MigracionAplicada
+ * @brief Migración aplicada sobre el archivo de la base de datos.
+ *
+ * - version y descripcion: Los de la migración.
+ * - filas: Filas actualizadas por sus pasos de datos.
+ * - reanudada: `true` si continuó una ejecución interrumpida.
+ * - segundos: Tiempo que tomó.
+ */
+struct MigracionAplicada {
+    int version = 0;
+    std::string descripcion;
+    long long filas = 0;
+    bool reanudada = false;
+    double segundos = 0.0;
+};
+
+/**
+ * @struct ResultadoMigracion
+ * @brief Resultado de la migración de una base de datos.
+ *
+ * - versionAnterior y versionNueva: Versiones del esquema antes y después de migrar.
+ * - tablas: Filas copiadas por tabla en la reconstrucción desde la versión 1.
+ * - migraciones: Migraciones aplicadas sobre el archivo.
+ * - bytesAntes y bytesDespues: Tamaño del archivo antes y después de la reconstrucción.
+ * - segundosIndices: Tiempo de creación de los índices en la reconstrucción.
+ * - segundos: Tiempo total.
+ * - respaldo: Archivo con la base de datos original, si se reconstruyó.
+ * - planes: Verificación del plan de las sentencias de `Consultas.hpp` con el esquema migrado.
+ * - reanudable: Si la migración falló con avance guardado en `ProgresoMigracion`, por lo que al
+ *   ejecutarla de nuevo continúa desde el último bloque confirmado.
+ */
+struct ResultadoMigracion {
+    int versionAnterior = 0;
+    int versionNueva = 0;
+    std::vector<TablaMigrada> tablas;
+    std::vector<MigracionAplicada> migraciones;
+    long long bytesAntes = 0;
+    long long bytesDespues = 0;
+    double segundosIndices = 0.0;
+    double segundos = 0.0;
+    std::string respaldo;
+    ResultadoPlanes planes;
+    bool reanudable = false;
+};
+
+/**
+ * @class MigracionBD
+ * @brief Migración de una base de datos a la versión actual del esquema.
+ *
+ * La reconstrucción desde la versión 1 copia las filas a un archivo nuevo mientras mantiene un bloqueo
+ * de escritura sobre la base de datos original, que a partir de ahí queda en modo de bloqueo exclusivo.
+ * Con el bloqueo exclusivo guarda el original como respaldo (`<archivo>.v1`) y sobrescribe el archivo
+ * con la versión nueva en lugar de renombrarlo, por lo que un programa anterior que aún lo tenga
+ * abierto ve la versión nueva en su siguiente operación y nunca escribe en el respaldo. Una base de
+ * datos en modo WAL con otras conexiones abiertas se rechaza. Si falla antes de sobrescribir, el
+ * archivo original queda intacto.
+ *
+ * Las migraciones posteriores se aplican sobre el mismo archivo y las ventanillas pueden seguir
+ * operando con la versión anterior del programa mientras se ejecutan: el avance de cada paso de datos
+ * se guarda en la tabla `ProgresoMigracion` en la misma transacción que su bloque, y `user_version`
+ * cambia solo en la última transacción de la migración. Si se interrumpe, al ejecutarla de nuevo
+ * continúa desde el último bloque confirmado.
+ */
+class MigracionBD {
+    public:
+        /**
+         * @brief Migra una base de datos a la versión `VERSION_ESQUEMA`.
+         *
+         * Si la base de datos está en la versión 1, crea las tablas en `<archivo>.v2`, copia cada
+         * tabla en bloques de `filasPorBloque` filas convirtiendo las monedas y los tipos a sus valores
+         * enteros, ejecuta los pasos de datos de las `MIGRACIONES`, crea los índices y verifica la
+         * cantidad de filas de cada tabla antes de sobrescribir el archivo original. Luego aplica en
+         * orden las `MIGRACIONES` pendientes y al final verifica el plan de las sentencias de
+         * `Consultas.hpp` con `PlanesConsulta`.
+         *
+         * @param nombreDB Archivo de la base de datos.
+         * @param resultado Estructura donde se guarda el resultado de la migración.
+         * @param filasPorBloque Cantidad de filas que se copian en cada transacción de la reconstrucción.
+         * @return `true` si la base de datos quedó en la versión actual y todas las sentencias usan
+         *         los índices esperados, `false` en caso contrario.
+         */
+        static bool migrar(const std::string& nombreDB, ResultadoMigracion& resultado,
+                           long long filasPorBloque = FILAS_POR_BLOQUE_MIGRACION);
+
+        /**
+         * @brief Muestra el resultado de una migración.
+         *
+         * @param resultado Resultado de la migración.
+         * @return `void`
+         */
+        static void mostrarResultado(const ResultadoMigracion& resultado);
+};
+
+#endif // MIGRACION_BD_HPP
@@ -0,0 +1,92 @@
+/**
+ * @file Mora.hpp
+ * @brief Declaración de la clase Mora para el control de atrasos de la cartera de préstamos.
+ * @details Este archivo contiene la declaración de la clase Mora, que mantiene los días de atraso de
+ *          los préstamos activos a partir de su fecha de próximo pago y genera el reporte de antigüedad
+ *          de la mora por moneda y tipo de préstamo. Ambas operaciones se resuelven con los índices
+ *          parciales de la tabla Prestamos, sin recorrer el historial de PagoPrestamos.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef MORA_HPP
+#define MORA_HPP
+
+#include <sqlite3.h>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de rangos de antigüedad de la mora.
+constexpr int CANTIDAD_RANGOS_MORA = 4;
+
+/// @brief Nombres de los rangos de días de atraso, en el orden de los índices del reporte.
+constexpr const char* RANGOS_MORA[CANTIDAD_RANGOS_MORA] = {"0-30", "31-60", "61-90", "90+"};
+
+/**
+ * @struct FilaMora
+ * @brief Fila del reporte de mora para una moneda y un tipo de préstamo.
+ *
+ * - moneda: Moneda de los préstamos ('CRC' o 'USD').
+ * - tipo: Tipo de préstamo ('PER', 'PRE' o 'HIP').
+ * - prestamos: Cantidad de préstamos activos en cada rango de días de atraso.
+ * - saldo: Saldo pendiente de los préstamos de cada rango.
+ */
+struct FilaMora {
+    std::string moneda;
+    std::string tipo;
+    int prestamos[CANTIDAD_RANGOS_MORA] = {};
+    double saldo[CANTIDAD_RANGOS_MORA] = {};
+};
+
+/**
+ * @class Mora
+ * @brief Control de los días de atraso y reporte de antigüedad de la mora.
+ *
+ * Los días de atraso de cada préstamo se guardan en la tabla Prestamos. Se actualizan al abonar
+ * cuotas (Prestamo::abonarCuotas) y con el corte diario de `actualizar`, que solo visita los
+ * préstamos con la fecha de próximo pago vencida.
+ */
+class Mora {
+    public:
+        /**
+         * @brief Realiza el corte diario de los días de atraso.
+         *
+         * Recalcula los días de atraso de los préstamos activos cuya fecha de próximo pago ya pasó.
+         * Se puede ejecutar varias veces en el mismo día sin efectos adicionales.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param fecha Fecha del corte en formato YYYY-MM-DD (por defecto, la fecha actual).
+         * @return `int` Cantidad de préstamos actualizados, o -1 en caso de error.
+         */
+        static int actualizar(sqlite3* db, const std::string& fecha = "");
+
+        /**
+         * @brief Genera el reporte de antigüedad de la mora por moneda y tipo de préstamo.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @return `std::vector<FilaMora>` Filas del reporte, ordenadas por moneda y tipo.
+         */
+        static std::vector<FilaMora> reporte(sqlite3* db);
+
+        /**
+         * @brief Muestra el reporte de mora en formato tabular en la terminal.
+         *
+         * @param filas Filas del reporte.
+         * @return `void`
+         */
+        static void mostrarReporte(const std::vector<FilaMora>& filas);
+
+        /**
+         * @brief Exporta el reporte de mora a un archivo `.csv`.
+         *
+         * @param filas Filas del reporte.
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @return `true` si el archivo se generó correctamente, `false` en caso contrario.
+         */
+        static bool exportarCSV(const std::vector<FilaMora>& filas, const std::string& nombreArchivo);
+};
+
+#endif // MORA_HPP
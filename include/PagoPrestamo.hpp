@@ -17,6 +17,10 @@
 
 #include <sqlite3.h>
 #include <string>
+#include <vector>
+
+/// @brief Cantidad máxima de pagos que se insertan en una misma sentencia.
+constexpr size_t PAGOS_POR_INSERCION = 128;
 
 /**
  * @class PagoPrestamo
@@ -68,6 +72,40 @@ class PagoPrestamo {
          * @return `true` si el registro se crea correctamente, `false` en caso de error.
          */
         bool crear(sqlite3* db);
+
+        /**
+         * @brief Obtiene la cuota pagada.
+         * 
+         * @return Monto total del pago.
+         */
+        double getCuotaPagada() const;
+
+        /**
+         * @brief Obtiene el aporte al capital del pago.
+         * 
+         * @return Monto destinado al capital.
+         */
+        double getAporteCapital() const;
+
+        /**
+         * @brief Obtiene el aporte a intereses del pago.
+         * 
+         * @return Monto destinado a intereses.
+         */
+        double getAporteIntereses() const;
+
+        /**
+         * @brief Registra varios pagos en la base de datos con inserciones de múltiples filas.
+         * 
+         * Los pagos se insertan en bloques de hasta `PAGOS_POR_INSERCION` filas por sentencia, por lo
+         * que registrar varias cuotas requiere una sola sentencia en la mayoría de los casos. No abre
+         * una transacción propia: se debe llamar dentro de la transacción del abono.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param pagos Pagos a registrar.
+         * @return `true` si todos los registros se crean correctamente, `false` en caso de error.
+         */
+        static bool crearVarios(sqlite3* db, const std::vector<PagoPrestamo>& pagos);
 };
 
 #endif // PAGO_PRESTAMO_HPP
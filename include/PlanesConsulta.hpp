@@ -0,0 +1,96 @@
+/**
+ * @file PlanesConsulta.hpp
+ * @brief Declaración de la clase PlanesConsulta para detectar regresiones en los planes de las consultas SQL.
+ * @details Este archivo contiene la declaración de la clase PlanesConsulta, que ejecuta
+ *          `EXPLAIN QUERY PLAN` sobre cada sentencia de `Consultas.hpp` y reporta las que recorren una
+ *          tabla completa, necesitan un índice automático, ordenan con un árbol B temporal o no usan
+ *          los índices esperados. Puede generar una base de datos sintética grande con estadísticas
+ *          (`ANALYZE`) para que el planificador elija como lo haría en producción.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef PLANES_CONSULTA_HPP
+#define PLANES_CONSULTA_HPP
+
+#include "Consultas.hpp"
+#include <sqlite3.h>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de clientes de la base de datos sintética (con 2 cuentas, 10 transacciones, 1 préstamo y 3 pagos por cliente).
+constexpr int CLIENTES_BASE_PLANES = 100000;
+
+/**
+ * @struct PlanConsulta
+ * @brief Plan de ejecución de una sentencia y el resultado de su verificación.
+ *
+ * - nombre: Método que ejecuta la sentencia.
+ * - plan: Líneas de `EXPLAIN QUERY PLAN`.
+ * - problemas: Motivos por los que el plan no es válido (vacío si es válido).
+ */
+struct PlanConsulta {
+    std::string nombre;
+    std::vector<std::string> plan;
+    std::vector<std::string> problemas;
+};
+
+/**
+ * @struct ResultadoPlanes
+ * @brief Resultado de la verificación de los planes.
+ *
+ * - consultas: Plan de cada sentencia verificada.
+ * - invalidos: Cantidad de sentencias con algún problema.
+ */
+struct ResultadoPlanes {
+    std::vector<PlanConsulta> consultas;
+    int invalidos = 0;
+};
+
+/**
+ * @class PlanesConsulta
+ * @brief Verificación de los planes de ejecución de las sentencias registradas.
+ */
+class PlanesConsulta {
+    public:
+        /**
+         * @brief Crea el esquema actual en una base de datos vacía y la llena con datos sintéticos.
+         *
+         * Crea las tablas, inserta las filas con consultas recursivas, crea los índices y ejecuta
+         * `ANALYZE`.
+         *
+         * @param db Conexión a una base de datos vacía.
+         * @param clientes Cantidad de clientes.
+         * @return `true` si la base de datos se generó correctamente, `false` en caso contrario.
+         */
+        static bool generarBaseDatos(sqlite3* db, int clientes = CLIENTES_BASE_PLANES);
+
+        /**
+         * @brief Verifica el plan de las sentencias.
+         *
+         * Un plan no es válido si recorre una tabla sin índice (`SCAN <tabla>`), crea un índice
+         * automático, ordena con un árbol B temporal sin `ordenamientoPermitido` o no usa alguno de
+         * los índices esperados.
+         *
+         * @param db Conexión a la base de datos SQLite.
+         * @param resultado Estructura donde se guarda el plan de cada sentencia.
+         * @param consultas Sentencias a verificar.
+         * @return `true` si todos los planes son válidos, `false` en caso contrario.
+         */
+        static bool verificar(sqlite3* db, ResultadoPlanes& resultado,
+                              const std::vector<ConsultaSQL>& consultas = CONSULTAS);
+
+        /**
+         * @brief Muestra el resultado de cada sentencia y el plan de las que no son válidas.
+         *
+         * @param resultado Resultado de la verificación.
+         * @param detallado `true` para mostrar también el plan de las sentencias válidas.
+         * @return `void`
+         */
+        static void mostrarResultado(const ResultadoPlanes& resultado, bool detallado = false);
+};
+
+#endif // PLANES_CONSULTA_HPP
@@ -16,7 +16,11 @@
 
 #include "Cuenta.hpp"
 #include "constants.hpp"
+#include "Codigos.hpp"
+#include "PagoPrestamo.hpp"
+#include <span>
 #include <string>
+#include <vector>
 #include <sqlite3.h>
 
 /**
@@ -35,11 +39,11 @@ class Prestamo {
         /// @brief Identificador de la cuenta
         int idCuenta;
 
-        /// @brief Tipo de préstamo: 'PER' (personal), 'PRE' (prendario), 'HIP' (hipotecario)
-        std::string tipo;
+        /// @brief Tipo de préstamo: personal, prendario o hipotecario
+        TipoPrestamo tipo;
 
-        /// @brief Tipo de moneda del préstamo: 'CRC' o 'USD'.
-        std::string moneda;
+        /// @brief Moneda del préstamo
+        Moneda moneda;
 
         /// @brief Monto solicitado del préstamo
         double monto;
@@ -68,10 +72,58 @@ class Prestamo {
         /// @brief Estado de actividad del préstamo: true si no ha sido pagado totalmente y false en caso contrario
         bool activo;
 
+        /// @brief Fecha de vencimiento de la próxima cuota (YYYY-MM-DD)
+        std::string fechaProximoPago;
+
+        /// @brief Días de atraso de la próxima cuota
+        int diasAtraso = 0;
+
+        /// @brief Versión de la fila leída de la base de datos, incrementada por cada abono
+        int version = 0;
+
         /// @brief Método privado para calcular el los intereses a pagar en el préstamo 
-        /// @return Intereses a pagar del préstamo
+        /// @return Intereses del mes sobre el saldo pendiente del préstamo
         double calcularIntereses();
 
+        /**
+         * @brief Método privado para aplicar un abono ya calculado en una sola transacción.
+         * 
+         * Debita el total de la cuenta una sola vez, actualiza los datos del préstamo y registra los
+         * pagos con una inserción de múltiples filas. Si algún paso falla se revierte la transacción
+         * y se restauran los datos en memoria del préstamo y de la cuenta. Un conflicto de versión se
+         * deja pasar para que el abono se calcule de nuevo con los datos actuales.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param cuenta Cuenta desde la que se realiza el abono.
+         * @param pagos Pagos a registrar en PagoPrestamos.
+         * @param cuotas Cantidad de cuotas que cubre el abono.
+         * @param nuevaCuota Cuota mensual del préstamo después del abono.
+         * @return `true` si el abono se realiza correctamente, `false` en caso contrario.
+         * @throws ConflictoVersion Si otra sesión modificó el préstamo o la cuenta desde que se leyeron.
+         */
+        bool aplicarAbono(sqlite3* db, Cuenta& cuenta, const std::vector<PagoPrestamo>& pagos, int cuotas, double nuevaCuota);
+
+        /**
+         * @brief Método privado para adelantar la fecha de próximo pago después de abonar cuotas.
+         * 
+         * Avanza la fecha de vencimiento un mes por cada cuota pagada y recalcula los días de atraso
+         * con respecto a la fecha actual.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param cuotas Cantidad de cuotas pagadas.
+         * @return `true` si la actualización es exitosa, `false` en caso contrario.
+         */
+        bool actualizarVencimiento(sqlite3* db, int cuotas);
+
+        /**
+         * @brief Método privado para volver a leer el préstamo y la cuenta después de un conflicto de versión.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param cuenta Cuenta desde la que se realiza el abono.
+         * @return `true` si ambos se recargaron, `false` si alguno ya no se encuentra.
+         */
+        bool recargar(sqlite3* db, Cuenta& cuenta);
+
     public:
         /**
          * @brief Constructor de la clase Prestamo.
@@ -79,8 +131,8 @@ class Prestamo {
          * Inicializa un objeto Prestamo con los datos especificados.
          * 
          * @param idCuenta ID de la cuenta asociada.
-         * @param tipo Tipo de préstamo ('PER', 'PRE', 'HIP').
-         * @param moneda Moneda del préstamo ('CRC', 'USD').
+         * @param tipo Tipo de préstamo.
+         * @param moneda Moneda del préstamo.
          * @param monto Monto solicitado.
          * @param tasaInteres Tasa de interés aplicada.
          * @param plazoMeses Plazo en meses para el pago.
@@ -92,8 +144,8 @@ class Prestamo {
          */
         Prestamo(
             int idCuenta,
-            const std::string &tipo,
-            const std::string &moneda,
+            TipoPrestamo tipo,
+            Moneda moneda,
             double monto, 
             double tasaInteres,
             int plazoMeses,
@@ -123,6 +175,17 @@ class Prestamo {
          */
         static Prestamo obtener(sqlite3* db, int idPrestamo);
 
+        /**
+         * @brief Obtiene varios préstamos en una sola consulta.
+         * 
+         * Los préstamos se retornan en el orden de los IDs; los que no existen se omiten.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param idsPrestamo IDs de los préstamos a obtener.
+         * @return Vector con los préstamos encontrados, o vacío si falló la consulta.
+         */
+        static std::vector<Prestamo> obtenerVarios(sqlite3* db, std::span<const int> idsPrestamo);
+
         /**
          * @brief Verifica si un préstamo existe en la base de datos.
          * 
@@ -142,6 +205,28 @@ class Prestamo {
          */
         static double calcularCuotaMensual(double monto, double tasaInteres, int plazoMeses);
 
+        /**
+         * @brief Calcula los intereses de un mes sobre un saldo.
+         * 
+         * @param saldo Saldo sobre el que se calculan los intereses.
+         * @param tasaInteres Tasa de interés anual (%).
+         * @return El monto de intereses del mes.
+         */
+        static double calcularInteresesMensuales(double saldo, double tasaInteres);
+
+        /**
+         * @brief Calcula el saldo pendiente de un préstamo después de pagar varias cuotas.
+         * 
+         * Cada cuota paga los intereses del mes sobre el saldo y el resto se abona al capital.
+         * 
+         * @param monto Saldo inicial del préstamo.
+         * @param tasaInteres Tasa de interés anual (%).
+         * @param cuotaMensual Cuota mensual pagada.
+         * @param cuotasPagadas Cantidad de cuotas pagadas.
+         * @return El saldo pendiente.
+         */
+        static double calcularSaldoRestante(double monto, double tasaInteres, double cuotaMensual, int cuotasPagadas);
+
         /**
          * @brief Realiza un abono a la cuota de un préstamo.
          * 
@@ -151,11 +236,42 @@ class Prestamo {
          */
         bool abonarCuota(sqlite3* db, Cuenta& cuenta);
 
+        /**
+         * @brief Realiza el abono de varias cuotas de un préstamo en una sola operación.
+         * 
+         * Cada cuota paga los intereses del mes sobre el saldo pendiente y el resto se abona al capital.
+         * La última cuota del préstamo liquida el saldo que quede pendiente. Si otra sesión modificó el
+         * préstamo o la cuenta, ambos se recargan y el desglose se calcula de nuevo antes de reintentar.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param cuenta Objeto Cuenta desde la que se realizará el abono.
+         * @param cantidadCuotas Cantidad de cuotas a pagar (entre 1 y las cuotas restantes).
+         * @return `true` si el abono se realiza correctamente, `false` en caso contrario.
+         */
+        bool abonarCuotas(sqlite3* db, Cuenta& cuenta, int cantidadCuotas);
+
+        /**
+         * @brief Realiza un abono extraordinario al capital del préstamo.
+         * 
+         * El monto se aplica completo al saldo pendiente y la cuota mensual se recalcula para las
+         * cuotas restantes. Si el saldo queda en cero, el préstamo se marca como pagado. Los conflictos de
+         * versión se reintentan igual que en `abonarCuotas`.
+         * 
+         * @param db Puntero a la base de datos SQLite.
+         * @param cuenta Objeto Cuenta desde la que se realizará el abono.
+         * @param montoCapital Monto a abonar al capital (no puede superar el saldo pendiente).
+         * @return `true` si el abono se realiza correctamente, `false` en caso contrario.
+         */
+        bool abonarCapital(sqlite3* db, Cuenta& cuenta, double montoCapital);
+
         /**
          * @brief Actualiza los datos del préstamo después de un abono.
          * 
+         * La actualización solo se aplica si la fila conserva la versión leída, e incrementa la versión.
+         * 
          * @param db Puntero a la base de datos SQLite.
          * @return `true` si la actualización es exitosa, `false` en caso contrario.
+         * @throws ConflictoVersion Si otra sesión modificó el préstamo desde que se leyó.
          */
         bool actualizarDatosAbono(sqlite3* db);
 
@@ -212,7 +328,7 @@ class Prestamo {
          * @param tasaInteres Tasa de interés.
          * @param cuotaMensual Cuota mensual calculada.
          */
-        static void reportePagoEstimado(const std::string& moneda, double monto, int plazoMeses, double tasaInteres, double cuotaMensual);
+        static void reportePagoEstimado(Moneda moneda, double monto, int plazoMeses, double tasaInteres, double cuotaMensual);
 
         /**
          * @brief Obtiene valores predeterminados para un tipo de préstamo.
@@ -221,7 +337,7 @@ class Prestamo {
          * @param moneda Moneda del préstamo.
          * @return Estructura ValoresPrestamo con los valores obtenidos.
          */
-        static ValoresPrestamo obtenerValoresPredeterminados(TipoPrestamo tipo, const std::string &moneda);
+        static ValoresPrestamo obtenerValoresPredeterminados(TipoPrestamo tipo, Moneda moneda);
 };
 
 #endif // PRESTAMO_HPP
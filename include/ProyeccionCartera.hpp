@@ -0,0 +1,152 @@
+/**
+ * @file ProyeccionCartera.hpp
+ * @brief Declaración de la clase ProyeccionCartera para proyectar intereses de la cartera.
+ * @details Este archivo contiene la declaración de la clase ProyeccionCartera, que carga una sola vez
+ *          los préstamos activos y los CDP de la base de datos en un formato columnar en memoria
+ *          (un arreglo contiguo por campo y por moneda) y proyecta mes a mes los intereses que
+ *          ingresan por préstamos y los intereses que se pagan por CDP. La proyección se reparte
+ *          entre varios hilos y cada hilo recorre arreglos contiguos sin saltos condicionales.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef PROYECCION_CARTERA_HPP
+#define PROYECCION_CARTERA_HPP
+
+#include "Codigos.hpp"
+#include <sqlite3.h>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ColumnasPrestamos
+ * @brief Préstamos activos de una moneda en formato columnar.
+ *
+ * - saldo: Saldo pendiente (monto - capital pagado).
+ * - tasaMensual: Tasa de interés mensual en forma decimal.
+ * - cuota: Cuota mensual del préstamo.
+ * - cuotasRestantes: Cuotas que faltan por pagar.
+ */
+struct ColumnasPrestamos {
+    std::vector<double> saldo;
+    std::vector<double> tasaMensual;
+    std::vector<double> cuota;
+    std::vector<int> cuotasRestantes;
+};
+
+/**
+ * @struct ColumnasCDP
+ * @brief CDP de una moneda en formato columnar.
+ *
+ * - interesMensual: Intereses que se pagan cada mes por el CDP.
+ * - mesesRestantes: Meses que faltan para el vencimiento del CDP.
+ */
+struct ColumnasCDP {
+    std::vector<double> interesMensual;
+    std::vector<int> mesesRestantes;
+};
+
+/**
+ * @struct FilaProyeccion
+ * @brief Resultado de la proyección para un mes y una moneda.
+ *
+ * - mes: Número de mes proyectado (1 es el próximo mes).
+ * - moneda: Moneda de la fila ('CRC', 'USD').
+ * - interesesPrestamos: Intereses que ingresan por préstamos.
+ * - interesesCDP: Intereses que se pagan por CDP.
+ */
+struct FilaProyeccion {
+    int mes;
+    std::string moneda;
+    double interesesPrestamos;
+    double interesesCDP;
+};
+
+/**
+ * @class ProyeccionCartera
+ * @brief Proyección mensual de ingresos y gastos por intereses de la cartera.
+ *
+ * Cada préstamo se amortiza con su cuota mensual: los intereses del mes se calculan sobre el saldo
+ * pendiente con `Prestamo::calcularInteresesMensuales` y el resto de la cuota reduce el saldo, hasta
+ * completar las cuotas restantes. Cada CDP paga intereses fijos sobre su depósito durante su plazo.
+ */
+class ProyeccionCartera {
+    private:
+        /// @brief Préstamos activos agrupados por moneda.
+        ColumnasPrestamos prestamos[CANTIDAD_MONEDAS];
+
+        /// @brief CDP agrupados por moneda.
+        ColumnasCDP cdps[CANTIDAD_MONEDAS];
+
+        /**
+         * @brief Proyecta los intereses de un bloque de préstamos.
+         *
+         * @param columnas Préstamos de una moneda.
+         * @param inicio Índice del primer préstamo del bloque.
+         * @param fin Índice siguiente al último préstamo del bloque.
+         * @param meses Cantidad de meses a proyectar.
+         * @param acumulado Arreglo de `meses` posiciones donde se suman los intereses de cada mes.
+         * @return `void`
+         */
+        static void proyectarPrestamos(const ColumnasPrestamos& columnas, size_t inicio, size_t fin, int meses, double* acumulado);
+
+        /**
+         * @brief Proyecta los intereses de un bloque de CDP.
+         *
+         * @param columnas CDP de una moneda.
+         * @param inicio Índice del primer CDP del bloque.
+         * @param fin Índice siguiente al último CDP del bloque.
+         * @param meses Cantidad de meses a proyectar.
+         * @param acumulado Arreglo de `meses` posiciones donde se suman los intereses de cada mes.
+         * @return `void`
+         */
+        static void proyectarCDP(const ColumnasCDP& columnas, size_t inicio, size_t fin, int meses, double* acumulado);
+
+    public:
+        /**
+         * @brief Carga los préstamos activos y los CDP desde la base de datos.
+         *
+         * Reemplaza cualquier cartera cargada anteriormente.
+         *
+         * @param db Conexión a la base de datos SQLite.
+         * @return `true` si la carga fue exitosa, `false` en caso contrario.
+         */
+        bool cargar(sqlite3* db);
+
+        /**
+         * @brief Proyecta los intereses de los próximos meses por moneda.
+         *
+         * @param meses Cantidad de meses a proyectar.
+         * @param hilos Cantidad de hilos a utilizar (0 para usar todos los núcleos disponibles).
+         * @return `std::vector<FilaProyeccion>` Una fila por mes y moneda, ordenadas por mes.
+         */
+        std::vector<FilaProyeccion> proyectar(int meses, unsigned int hilos = 0) const;
+
+        /**
+         * @brief Retorna la cantidad de préstamos activos cargados.
+         *
+         * @return `size_t` Cantidad de préstamos.
+         */
+        size_t cantidadPrestamos() const;
+
+        /**
+         * @brief Retorna la cantidad de CDP cargados.
+         *
+         * @return `size_t` Cantidad de CDP.
+         */
+        size_t cantidadCDP() const;
+
+        /**
+         * @brief Exporta el resumen de una proyección a un archivo `.csv`.
+         *
+         * @param filas Filas de la proyección.
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @return `true` si el archivo se generó correctamente, `false` en caso contrario.
+         */
+        static bool exportarCSV(const std::vector<FilaProyeccion>& filas, const std::string& nombreArchivo);
+};
+
+#endif // PROYECCION_CARTERA_HPP
@@ -0,0 +1,87 @@
+/**
+ * @file ReporteCartera.hpp
+ * @brief Declaración de la clase ReporteCartera para el reporte de estado de toda la cartera de préstamos.
+ * @details Este archivo contiene la declaración de la clase ReporteCartera, que genera en un solo recorrido
+ *          de la tabla Prestamos el estado de cada préstamo (las mismas columnas de
+ *          Prestamo::consultarEstado) en un archivo `.csv`, junto con los totales por tipo y moneda.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef REPORTE_CARTERA_HPP
+#define REPORTE_CARTERA_HPP
+
+#include "SimuladorCartera.hpp"
+#include <sqlite3.h>
+#include <string>
+
+/**
+ * @struct TotalesCartera
+ * @brief Totales de los préstamos de un tipo y una moneda.
+ *
+ * - prestamos: Cantidad de préstamos.
+ * - activos: Cantidad de préstamos activos.
+ * - monto: Monto total otorgado.
+ * - cuotaMensual: Suma de las cuotas mensuales de los préstamos activos.
+ * - cuotasPagadas: Cuotas pagadas.
+ * - cuotasRestantes: Cuotas restantes de los préstamos activos.
+ * - capitalPagado: Aporte total al capital.
+ * - interesesPagados: Intereses pagados.
+ * - saldoPendiente: Saldo pendiente de los préstamos activos.
+ */
+struct TotalesCartera {
+    long long prestamos = 0;
+    long long activos = 0;
+    double monto = 0.0;
+    double cuotaMensual = 0.0;
+    long long cuotasPagadas = 0;
+    long long cuotasRestantes = 0;
+    double capitalPagado = 0.0;
+    double interesesPagados = 0.0;
+    double saldoPendiente = 0.0;
+};
+
+/**
+ * @struct ResumenCartera
+ * @brief Totales de la cartera por tipo de préstamo (`TIPOS_PRESTAMO`) y moneda (`MONEDAS`).
+ */
+struct ResumenCartera {
+    TotalesCartera segmentos[CANTIDAD_TIPOS_PRESTAMO][CANTIDAD_MONEDAS];
+    TotalesCartera total;
+};
+
+/**
+ * @class ReporteCartera
+ * @brief Reporte de estado de todos los préstamos.
+ *
+ * Los préstamos se leen en orden de ID con un solo recorrido de la tabla y cada fila se escribe en el
+ * archivo a medida que se lee, mientras los totales se acumulan en memoria por tipo y moneda.
+ */
+class ReporteCartera {
+    public:
+        /**
+         * @brief Genera el reporte de estado de todos los préstamos.
+         *
+         * Escribe una fila por préstamo y, al final, una fila `TOTAL` por cada tipo y moneda con
+         * préstamos, con las sumas de cada columna y la cantidad de préstamos activos en `Activo`.
+         *
+         * @param db Puntero a la base de datos SQLite.
+         * @param nombreArchivo Nombre del archivo `.csv` a generar.
+         * @param resumen Totales de la cartera por tipo y moneda.
+         * @return `true` si el reporte se generó correctamente, `false` en caso contrario.
+         */
+        static bool generar(sqlite3* db, const std::string& nombreArchivo, ResumenCartera& resumen);
+
+        /**
+         * @brief Muestra los totales de la cartera en formato tabular en la terminal.
+         *
+         * @param resumen Totales de la cartera.
+         * @return `void`
+         */
+        static void mostrarResumen(const ResumenCartera& resumen);
+};
+
+#endif // REPORTE_CARTERA_HPP
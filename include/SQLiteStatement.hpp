@@ -15,6 +15,7 @@
 #define SQLITE_STATEMENT_H
 
 #include <sqlite3.h>
+#include <span>
 #include <string>
 
 /**
@@ -52,6 +53,19 @@ class SQLiteStatement {
          */
         sqlite3_stmt* get() const;
 
+        /**
+         * @brief Asigna una lista de enteros a un parámetro como un arreglo JSON.
+         * 
+         * Permite consultar varios IDs en una sola sentencia con `json_each`, por ejemplo
+         * `SELECT ... FROM json_each(?1) AS j JOIN Cuentas c ON c.idCuenta = j.value ORDER BY j.key`,
+         * donde `j.key` es la posición del ID en la lista.
+         * 
+         * @param indice Índice del parámetro (desde 1).
+         * @param valores Enteros a asignar.
+         * @return `void`
+         */
+        void bindLista(int indice, std::span<const int> valores);
+
     private:
         /// @brief Puntero a la declaración preparada de SQLite.
         sqlite3_stmt* stmt_;
@@ -0,0 +1,216 @@
+/**
+ * @file Servidor.hpp
+ * @brief Declaración de la clase Servidor para atender varias ventanillas desde un solo proceso.
+ * @details Este archivo contiene la declaración de la clase Servidor, que escucha en un socket de
+ *          dominio Unix, atiende las conexiones con un ciclo de eventos `epoll` y ejecuta cada
+ *          solicitud como una corrutina de BancoAsincrono. Solo está disponible en Linux.
+ *
+ *          Protocolo (enteros en little-endian, `f64` en formato IEEE 754):
+ *          - Solicitud: `u32 largo | u32 id | u8 operacion | argumentos`, donde `largo` cuenta los
+ *            bytes que siguen al propio campo.
+ *          - Respuesta: `u32 largo | u32 id | u8 estado | datos`. Con estado `OK` los datos son el
+ *            resultado de la operación; en caso contrario, el mensaje de error.
+ *
+ *          | Operación       | Argumentos                                       | Resultado            |
+ *          |-----------------|--------------------------------------------------|----------------------|
+ *          | `SALDO`         | `i32 idCuenta`                                   | `f64 saldo`          |
+ *          | `DEPOSITO`      | `i32 idCuenta, f64 monto`                        | `f64 saldo`          |
+ *          | `RETIRO`        | `i32 idCuenta, f64 monto`                        | `f64 saldo`          |
+ *          | `TRANSFERENCIA` | `i32 idCuenta, i32 idCuentaDestino, f64 monto`   | `f64 saldo`          |
+ *          | `ABONO`         | `i32 idPrestamo, i32 idCuenta, i32 cuotas`       | `f64 saldo`          |
+ *          | `CDP`           | `i32 idCuenta, f64 monto, i32 plazo, f64 tasa`   | `f64 saldo`          |
+ *          | `CLIENTE`       | `i32 cedula`                                     | `i32 idCliente`      |
+ *
+ *          Una conexión puede enviar varias solicitudes sin esperar las respuestas. Las respuestas
+ *          pueden llegar en otro orden y se asocian a su solicitud por el `id`.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef SERVIDOR_HPP
+#define SERVIDOR_HPP
+
+#ifdef __linux__
+
+#include "BancoAsincrono.hpp"
+#include "Ejecutor.hpp"
+#include "Tarea.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @enum OperacionServidor
+ * @brief Operaciones del protocolo del servidor.
+ */
+enum class OperacionServidor : uint8_t {
+    SALDO = 1,
+    DEPOSITO,
+    RETIRO,
+    TRANSFERENCIA,
+    ABONO,
+    CDP,
+    CLIENTE
+};
+
+/**
+ * @enum EstadoRespuesta
+ * @brief Estado de una respuesta del servidor.
+ *
+ * - OK: La operación se realizó correctamente.
+ * - ERROR: La operación falló (fondos insuficientes, cuenta inexistente, etc.).
+ * - SOLICITUD_INVALIDA: La operación no existe o sus argumentos no tienen el formato esperado.
+ */
+enum class EstadoRespuesta : uint8_t {
+    OK = 0,
+    ERROR,
+    SOLICITUD_INVALIDA
+};
+
+/// @brief Tamaño máximo de una solicitud, sin contar el campo de largo.
+constexpr uint32_t MAXIMO_TRAMA = 4096;
+
+/// @brief Cantidad máxima de solicitudes pendientes por conexión antes de dejar de leer de ella.
+constexpr size_t MAXIMO_PENDIENTES = 1024;
+
+/**
+ * @struct Solicitud
+ * @brief Solicitud recibida de una conexión.
+ *
+ * - conexion: Identificador de la conexión que la envió.
+ * - id: Identificador de la solicitud, que se devuelve en la respuesta.
+ * - operacion: Código de la operación.
+ * - argumentos: Bytes de los argumentos.
+ */
+struct Solicitud {
+    uint64_t conexion;
+    uint32_t id;
+    uint8_t operacion;
+    std::string argumentos;
+};
+
+/**
+ * @class Servidor
+ * @brief Servidor de operaciones bancarias sobre un socket de dominio Unix.
+ *
+ * El hilo principal ejecuta el ciclo de eventos: acepta conexiones, separa las solicitudes de cada
+ * conexión, lanza una corrutina por solicitud y envía las respuestas. Las corrutinas esperan a los
+ * pools de BancoAsincrono (varios lectores para `SALDO` y `CLIENTE`, un único escritor para el resto)
+ * y se reanudan en el mismo hilo del ciclo de eventos, por lo que el estado de las conexiones no
+ * necesita sincronización.
+ */
+class Servidor {
+    private:
+        /**
+         * @struct Conexion
+         * @brief Estado de una conexión de cliente.
+         *
+         * `finEntrada` indica que el cliente cerró su lado de escritura: las solicitudes completas que
+         * ya llegaron se atienden y la conexión se cierra después de enviar sus respuestas. Con
+         * `eventos` en 0 el descriptor no está registrado en `epoll`.
+         */
+        struct Conexion {
+            int descriptor;
+            std::string entrada;
+            std::string salida;
+            size_t pendientes = 0;
+            bool leyendo = true;
+            bool finEntrada = false;
+            uint32_t eventos = 0;
+        };
+
+        /// @brief Nombre del archivo de la base de datos.
+        std::string nombreDB;
+
+        /// @brief Ruta del socket de dominio Unix.
+        std::string rutaSocket;
+
+        /// @brief Cantidad de hilos lectores.
+        unsigned int hilosLectura;
+
+        /// @brief Descriptores del socket de escucha, de `epoll` y del `eventfd` para despertar el ciclo.
+        int descriptorEscucha = -1;
+        int descriptorEpoll = -1;
+        int descriptorEvento = -1;
+
+        /// @brief Indica si el ciclo de eventos debe continuar.
+        std::atomic<bool> activo{false};
+
+        /// @brief Ejecutor de las corrutinas, que se reanudan en el hilo del ciclo de eventos.
+        Ejecutor ejecutor;
+
+        /// @brief Operaciones bancarias asíncronas con sus pools de escritor y lectores.
+        std::unique_ptr<BancoAsincrono> banco;
+
+        /// @brief Conexiones abiertas por identificador.
+        std::unordered_map<uint64_t, Conexion> conexiones;
+
+        /// @brief Conexiones con respuestas nuevas por enviar.
+        std::vector<uint64_t> conexionesConRespuestas;
+
+        /// @brief Siguiente identificador de conexión.
+        uint64_t siguienteConexion;
+
+        // Ejecuta una solicitud y agrega la respuesta a la salida de su conexión
+        Tarea<void> atender(Solicitud solicitud);
+        void responder(uint64_t idConexion, std::string trama);
+
+        // Manejo de eventos del ciclo principal
+        void aceptarConexiones();
+        void leerConexion(uint64_t id, Conexion& conexion);
+        bool procesarSolicitudes(uint64_t id, Conexion& conexion);
+        bool escribirConexion(uint64_t id, Conexion& conexion);
+        void enviarRespuestas();
+        void actualizarEventos(uint64_t id, Conexion& conexion);
+        void cerrarConexion(uint64_t id);
+
+        // Despierta al ciclo de eventos escribiendo en el eventfd
+        void despertar();
+
+    public:
+        /**
+         * @brief Constructor de la clase Servidor.
+         *
+         * @param nombreDB Nombre del archivo de la base de datos.
+         * @param rutaSocket Ruta del socket de dominio Unix.
+         * @param hilosLectura Cantidad de hilos lectores (0 para usar todos los núcleos disponibles).
+         */
+        Servidor(const std::string& nombreDB, const std::string& rutaSocket, unsigned int hilosLectura = 0);
+
+        /**
+         * @brief Destructor que termina las operaciones pendientes y cierra los descriptores.
+         */
+        ~Servidor();
+
+        Servidor(const Servidor&) = delete;
+        Servidor& operator=(const Servidor&) = delete;
+
+        /**
+         * @brief Crea el socket de escucha e inicia los pools de BancoAsincrono.
+         *
+         * @return `true` si el servidor quedó listo para atender conexiones, `false` en caso contrario.
+         */
+        bool iniciar();
+
+        /**
+         * @brief Ejecuta el ciclo de eventos hasta que se llame a `detener` y termina las operaciones en curso.
+         */
+        void ejecutar();
+
+        /**
+         * @brief Solicita detener el ciclo de eventos.
+         *
+         * Solo escribe en un `eventfd`, por lo que se puede llamar desde un manejador de señales.
+         */
+        void detener();
+};
+
+#endif // __linux__
+
+#endif // SERVIDOR_HPP
@@ -0,0 +1,167 @@
+/**
+ * @file SimuladorCartera.hpp
+ * @brief Declaración de la clase SimuladorCartera para simular choques de tasa e impagos en la cartera.
+ * @details Este archivo contiene la declaración de la clase SimuladorCartera, que ejecuta miles de
+ *          escenarios Monte Carlo sobre los préstamos activos. En cada escenario se aplica un choque a
+ *          las tasas de interés, se recalculan las cuotas con la matemática de la clase Prestamo y se
+ *          simula el impago de cada préstamo. Los flujos de caja y las pérdidas se resumen por tipo de
+ *          préstamo y moneda con estadísticas acumuladas, sin guardar los resultados de cada escenario.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef SIMULADOR_CARTERA_HPP
+#define SIMULADOR_CARTERA_HPP
+
+#include "ProyeccionCartera.hpp"
+#include <sqlite3.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief Cantidad de intervalos del histograma de pérdidas de cada segmento.
+constexpr int INTERVALOS_HISTOGRAMA = 1000;
+
+/**
+ * @struct ParametrosSimulacion
+ * @brief Parámetros de los escenarios de la simulación.
+ *
+ * - escenarios: Cantidad de escenarios a simular.
+ * - volatilidadTasa: Desviación estándar del choque de tasa, en puntos porcentuales.
+ * - probabilidadImpago: Probabilidad anual de impago por tipo de préstamo.
+ * - sensibilidadImpago: Aumento relativo de la probabilidad de impago por cada punto de choque de tasa.
+ * - recuperacion: Fracción del saldo que se recupera al caer en impago, por tipo de préstamo.
+ * - semilla: Semilla base de los generadores aleatorios.
+ * - hilos: Cantidad de hilos a utilizar (0 para usar todos los núcleos disponibles).
+ */
+struct ParametrosSimulacion {
+    int escenarios;
+    double volatilidadTasa;
+    double probabilidadImpago[CANTIDAD_TIPOS_PRESTAMO];
+    double sensibilidadImpago;
+    double recuperacion[CANTIDAD_TIPOS_PRESTAMO];
+    uint64_t semilla;
+    unsigned int hilos;
+};
+
+/**
+ * @namespace SimulacionDef
+ * @brief Parámetros predeterminados de la simulación.
+ */
+namespace SimulacionDef {
+    const ParametrosSimulacion PARAMETROS = {10000, 1.5, {0.04, 0.02, 0.01}, 0.25, {0.10, 0.50, 0.70}, 20241128, 0};
+}
+
+/**
+ * @struct EstadisticasSegmento
+ * @brief Distribución de los resultados de un segmento (tipo de préstamo y moneda) entre escenarios.
+ *
+ * - prestamos: Cantidad de préstamos del segmento.
+ * - exposicion: Saldo pendiente total del segmento.
+ * - flujoMedio, flujoDesviacion, flujoMinimo, flujoMaximo: Flujo de caja total por escenario.
+ * - perdidaMedia, perdidaDesviacion, perdidaP95, perdidaP99, perdidaMaxima: Pérdida total por escenario.
+ */
+struct EstadisticasSegmento {
+    size_t prestamos = 0;
+    double exposicion = 0.0;
+    double flujoMedio = 0.0;
+    double flujoDesviacion = 0.0;
+    double flujoMinimo = 0.0;
+    double flujoMaximo = 0.0;
+    double perdidaMedia = 0.0;
+    double perdidaDesviacion = 0.0;
+    double perdidaP95 = 0.0;
+    double perdidaP99 = 0.0;
+    double perdidaMaxima = 0.0;
+};
+
+/**
+ * @struct ResultadoSimulacion
+ * @brief Resultado de una simulación completa.
+ *
+ * - segmentos: Estadísticas por tipo de préstamo y moneda.
+ * - escenarios: Cantidad de escenarios simulados.
+ * - prestamos: Cantidad de préstamos simulados en cada escenario.
+ * - segundos: Tiempo total de la simulación.
+ * - segundosPorMillon: Tiempo por cada millón de combinaciones préstamo-escenario.
+ */
+struct ResultadoSimulacion {
+    EstadisticasSegmento segmentos[CANTIDAD_TIPOS_PRESTAMO][CANTIDAD_MONEDAS];
+    int escenarios = 0;
+    size_t prestamos = 0;
+    double segundos = 0.0;
+    double segundosPorMillon = 0.0;
+};
+
+/**
+ * @class SimuladorCartera
+ * @brief Simulador Monte Carlo de choques de tasa e impagos sobre los préstamos activos.
+ *
+ * Los escenarios se reparten dinámicamente entre los hilos: cada hilo toma el siguiente bloque libre
+ * de escenarios de un contador compartido, de modo que ningún hilo queda ocioso mientras haya trabajo.
+ * El generador aleatorio de cada escenario se inicializa a partir de la semilla y del número de
+ * escenario, por lo que el resultado no depende de la cantidad de hilos.
+ */
+class SimuladorCartera {
+    private:
+        /// @brief Índice del tipo de préstamo de cada préstamo.
+        std::vector<uint8_t> tipo;
+
+        /// @brief Índice de la moneda de cada préstamo.
+        std::vector<uint8_t> moneda;
+
+        /// @brief Saldo pendiente de cada préstamo.
+        std::vector<double> saldo;
+
+        /// @brief Tasa de interés anual (%) de cada préstamo.
+        std::vector<double> tasaInteres;
+
+        /// @brief Cuotas pendientes de cada préstamo.
+        std::vector<int> cuotasRestantes;
+
+    public:
+        /**
+         * @brief Carga los préstamos activos desde la base de datos.
+         *
+         * @param db Conexión a la base de datos SQLite.
+         * @return `true` si la carga fue exitosa, `false` en caso contrario.
+         */
+        bool cargar(sqlite3* db);
+
+        /**
+         * @brief Ejecuta la simulación.
+         *
+         * @param parametros Parámetros de los escenarios.
+         * @return `ResultadoSimulacion` Estadísticas por segmento y tiempos de ejecución.
+         */
+        ResultadoSimulacion simular(const ParametrosSimulacion& parametros) const;
+
+        /**
+         * @brief Retorna la cantidad de préstamos cargados.
+         *
+         * @return `size_t` Cantidad de préstamos.
+         */
+        size_t cantidadPrestamos() const;
+
+        /**
+         * @brief Muestra el resultado de una simulación en formato tabular en la terminal.
+         *
+         * @param resultado Resultado de la simulación.
+         * @return `void`
+         */
+        static void mostrarResultado(const ResultadoSimulacion& resultado);
+
+        /**
+         * @brief Exporta el resultado de una simulación a un archivo `.csv`.
+         *
+         * @param resultado Resultado de la simulación.
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @return `true` si el archivo se generó correctamente, `false` en caso contrario.
+         */
+        static bool exportarCSV(const ResultadoSimulacion& resultado, const std::string& nombreArchivo);
+};
+
+#endif // SIMULADOR_CARTERA_HPP
@@ -0,0 +1,240 @@
+/**
+ * @file SnapshotColumnar.hpp
+ * @brief Declaración de las clases SnapshotColumnar y LectorSnapshot para instantáneas columnares de la base de datos.
+ * @details Este archivo contiene la declaración de la clase SnapshotColumnar, que exporta una instantánea
+ *          consistente de las tablas Cuentas, Transacciones, Prestamos, PagoPrestamos y CDP a un archivo
+ *          binario columnar, y de la clase LectorSnapshot, que mapea ese archivo en memoria para recorrer
+ *          sus columnas sin consultar la base de datos en uso.
+ *
+ *          Formato del archivo (little-endian):
+ *          - Cabecera (`CabeceraSnapshot`) con la posición del directorio.
+ *          - Bloques de datos: cada tabla se divide en grupos de hasta `FILAS_POR_GRUPO` filas y cada
+ *            columna de un grupo es un bloque alineado a 8 bytes, con una de las codificaciones de
+ *            `CodificacionColumna`.
+ *          - Directorio al final del archivo: por tabla, su nombre, filas y columnas (nombre,
+ *            codificación y diccionario), y por grupo, la cantidad de filas y la posición y el tamaño del
+ *            bloque de cada columna.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef SNAPSHOT_COLUMNAR_HPP
+#define SNAPSHOT_COLUMNAR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Identificador al inicio de los archivos de instantánea.
+constexpr char MAGIA_SNAPSHOT[4] = {'B', 'C', 'O', 'L'};
+
+/// @brief Versión del formato de instantánea.
+constexpr uint32_t VERSION_SNAPSHOT = 1;
+
+/// @brief Cantidad máxima de filas de cada grupo de una tabla.
+constexpr size_t FILAS_POR_GRUPO = 65536;
+
+/**
+ * @enum CodificacionColumna
+ * @brief Codificación de los valores de una columna.
+ *
+ * - ENTERO_DELTA: Enteros de 64 bits como diferencia con el valor anterior del grupo, en zigzag y
+ *   varint (IDs, fechas en segundos desde 1970 y contadores). Los valores NULL se guardan como -1.
+ * - DECIMAL: Arreglo de `double` sin comprimir, que se lee directamente del mapeo.
+ * - DICCIONARIO: Un byte por fila con el índice del texto en el diccionario de la columna (moneda y tipo).
+ */
+enum class CodificacionColumna : uint8_t {
+    ENTERO_DELTA = 1,
+    DECIMAL = 2,
+    DICCIONARIO = 3
+};
+
+/**
+ * @struct CabeceraSnapshot
+ * @brief Cabecera al inicio del archivo.
+ */
+struct CabeceraSnapshot {
+    char magia[4];
+    uint32_t version;
+    int64_t creado;
+    uint64_t inicioDirectorio;
+    uint64_t tamanoDirectorio;
+};
+
+/**
+ * @struct ColumnaSnapshot
+ * @brief Descripción de una columna de una tabla de la instantánea.
+ */
+struct ColumnaSnapshot {
+    std::string nombre;
+    CodificacionColumna codificacion;
+    std::vector<std::string> diccionario;
+};
+
+/**
+ * @struct BloqueSnapshot
+ * @brief Posición y tamaño en bytes del bloque de una columna en un grupo.
+ */
+struct BloqueSnapshot {
+    uint64_t inicio;
+    uint64_t tamano;
+};
+
+/**
+ * @struct GrupoSnapshot
+ * @brief Grupo de filas de una tabla, con un bloque por columna.
+ */
+struct GrupoSnapshot {
+    uint32_t filas;
+    std::vector<BloqueSnapshot> bloques;
+};
+
+/**
+ * @struct TablaSnapshot
+ * @brief Descripción de una tabla de la instantánea.
+ */
+struct TablaSnapshot {
+    std::string nombre;
+    uint64_t filas = 0;
+    std::vector<ColumnaSnapshot> columnas;
+    std::vector<GrupoSnapshot> grupos;
+
+    /**
+     * @brief Obtiene el índice de una columna a partir de su nombre.
+     *
+     * @param nombreColumna Nombre de la columna.
+     * @return `size_t` Índice de la columna.
+     * @throws `std::out_of_range` si la tabla no tiene la columna.
+     */
+    size_t columna(std::string_view nombreColumna) const;
+};
+
+/**
+ * @struct ResumenSnapshot
+ * @brief Resultado de una exportación.
+ *
+ * - filas: Filas exportadas de cada tabla, en el orden de exportación.
+ * - bytes: Tamaño del archivo generado.
+ * - segundos: Duración de la exportación.
+ */
+struct ResumenSnapshot {
+    std::vector<std::pair<std::string, uint64_t>> filas;
+    uint64_t bytes = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @class SnapshotColumnar
+ * @brief Exportación de instantáneas columnares.
+ *
+ * La exportación abre la base de datos en modo de solo lectura y lee todas las tablas dentro de una
+ * sola transacción de lectura, por lo que la instantánea es consistente y no bloquea las escrituras de
+ * los demás procesos. Por eso la base de datos debe estar en modo WAL (`inicio_db` la crea así y el
+ * servidor lo activa al iniciar); en otro modo la exportación se rechaza. Solo se mantiene en memoria
+ * un grupo de filas por tabla.
+ */
+class SnapshotColumnar {
+    public:
+        /**
+         * @brief Exporta una instantánea de la base de datos.
+         *
+         * @param nombreDB Nombre del archivo de la base de datos.
+         * @param nombreArchivo Nombre del archivo de instantánea a generar.
+         * @param resumen Filas exportadas, tamaño y duración.
+         * @return `true` si la instantánea se generó correctamente, `false` en caso contrario.
+         */
+        static bool exportar(const std::string& nombreDB, const std::string& nombreArchivo, ResumenSnapshot& resumen);
+};
+
+/**
+ * @class LectorSnapshot
+ * @brief Lector de instantáneas columnares mapeadas en memoria.
+ *
+ * Las columnas `DECIMAL` y `DICCIONARIO` se leen directamente del mapeo, sin copias. Las columnas
+ * `ENTERO_DELTA` se decodifican por grupo en un vector que el llamador puede reutilizar.
+ */
+class LectorSnapshot {
+    private:
+        const uint8_t* datos = nullptr;
+        size_t tamano = 0;
+        std::vector<uint8_t> copia; // Contenido del archivo en sistemas sin mmap
+        std::vector<TablaSnapshot> tablas;
+
+        // Lee el directorio del final del archivo
+        void leerDirectorio(const CabeceraSnapshot& cabecera);
+
+        // Obtiene el bloque de una columna en un grupo, verificando su codificación
+        const BloqueSnapshot& bloque(const TablaSnapshot& tabla, size_t columna, size_t grupo,
+                                     CodificacionColumna codificacion) const;
+
+    public:
+        /**
+         * @brief Constructor que abre y mapea en memoria un archivo de instantánea.
+         *
+         * @param nombreArchivo Nombre del archivo de instantánea.
+         * @throws `std::runtime_error` si no se pudo abrir o el archivo no es una instantánea válida.
+         */
+        explicit LectorSnapshot(const std::string& nombreArchivo);
+
+        /**
+         * @brief Destructor que libera el mapeo del archivo.
+         */
+        ~LectorSnapshot();
+
+        LectorSnapshot(const LectorSnapshot&) = delete;
+        LectorSnapshot& operator=(const LectorSnapshot&) = delete;
+
+        /**
+         * @brief Retorna las tablas de la instantánea.
+         *
+         * @return `const std::vector<TablaSnapshot>&` Tablas en el orden de exportación.
+         */
+        const std::vector<TablaSnapshot>& getTablas() const;
+
+        /**
+         * @brief Obtiene una tabla a partir de su nombre.
+         *
+         * @param nombre Nombre de la tabla.
+         * @return `const TablaSnapshot&` Descripción de la tabla.
+         * @throws `std::out_of_range` si la instantánea no tiene la tabla.
+         */
+        const TablaSnapshot& tabla(std::string_view nombre) const;
+
+        /**
+         * @brief Decodifica una columna `ENTERO_DELTA` de un grupo.
+         *
+         * @param tabla Tabla de la instantánea.
+         * @param columna Índice de la columna.
+         * @param grupo Índice del grupo.
+         * @param valores Vector donde se guardan los valores (se reutiliza su memoria).
+         * @return `void`
+         */
+        void enteros(const TablaSnapshot& tabla, size_t columna, size_t grupo, std::vector<int64_t>& valores) const;
+
+        /**
+         * @brief Obtiene los valores de una columna `DECIMAL` de un grupo.
+         *
+         * @param tabla Tabla de la instantánea.
+         * @param columna Índice de la columna.
+         * @param grupo Índice del grupo.
+         * @return `const double*` Valores del grupo (`GrupoSnapshot::filas` elementos).
+         */
+        const double* decimales(const TablaSnapshot& tabla, size_t columna, size_t grupo) const;
+
+        /**
+         * @brief Obtiene los códigos de una columna `DICCIONARIO` de un grupo.
+         *
+         * @param tabla Tabla de la instantánea.
+         * @param columna Índice de la columna.
+         * @param grupo Índice del grupo.
+         * @return `const uint8_t*` Índices en el diccionario de la columna (`GrupoSnapshot::filas` elementos).
+         */
+        const uint8_t* codigos(const TablaSnapshot& tabla, size_t columna, size_t grupo) const;
+};
+
+#endif // SNAPSHOT_COLUMNAR_HPP
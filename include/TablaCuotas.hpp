@@ -0,0 +1,186 @@
+/**
+ * @file TablaCuotas.hpp
+ * @brief Declaración de la clase TablaCuotas para generar tablas de cuotas mensuales de préstamos.
+ * @details Este archivo contiene la declaración de la clase TablaCuotas, que calcula en una sola pasada
+ *          la matriz completa de cuotas mensuales para un rango de plazos (filas) y de tasas de interés
+ *          (columnas). Las potencias de (1 + tasa mensual) se reutilizan de una fila a la siguiente, por
+ *          lo que cada celda cuesta una multiplicación y una división. Las tablas se guardan en caché
+ *          por tipo de préstamo y moneda, y se pueden exportar a un archivo `.csv`.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef TABLA_CUOTAS_HPP
+#define TABLA_CUOTAS_HPP
+
+#include "constants.hpp"
+#include "Codigos.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct RangoTablaCuotas
+ * @brief Rango de plazos y tasas que cubre una tabla de cuotas.
+ *
+ * - plazoMinimo, plazoMaximo: Plazos en meses de la primera y última fila (inclusivos).
+ * - tasaMinima, tasaMaxima: Tasas de interés anuales (%) de la primera y última columna.
+ * - cantidadTasas: Cantidad de columnas, espaciadas uniformemente entre ambas tasas.
+ */
+struct RangoTablaCuotas {
+    int plazoMinimo;
+    int plazoMaximo;
+    double tasaMinima;
+    double tasaMaxima;
+    int cantidadTasas;
+
+    /// @brief Compara dos rangos campo por campo.
+    bool operator==(const RangoTablaCuotas&) const = default;
+};
+
+/**
+ * @namespace TablaCuotasDef
+ * @brief Valores predeterminados de las tablas de cuotas que se muestran en ventanilla y en el sitio web.
+ */
+namespace TablaCuotasDef {
+    /// @brief Plazos de 1 a 360 meses y 200 tasas entre 0,25% y 50%.
+    const RangoTablaCuotas RANGO = {1, 360, 0.25, 50.0, 200};
+}
+
+/**
+ * @class TablaCuotas
+ * @brief Matriz de cuotas mensuales para un monto fijo y un rango de plazos y tasas.
+ *
+ * Las cuotas se almacenan por filas: la fila `i` corresponde al plazo `plazoMinimo + i` y la
+ * columna `j` a la tasa `tasa(j)`. La fórmula es la misma de `Prestamo::calcularCuotaMensual`.
+ */
+class TablaCuotas {
+    private:
+        /// @brief Monto del préstamo para el que se calculan las cuotas.
+        double monto;
+
+        /// @brief Rango de plazos y tasas de la tabla.
+        RangoTablaCuotas rango;
+
+        /// @brief Tasas de interés anuales (%) de cada columna.
+        std::vector<double> tasas;
+
+        /// @brief Cuotas mensuales almacenadas fila por fila (plazo × tasa).
+        std::vector<double> cuotas;
+
+        /// @brief Tiempo que tomó calcular la matriz, en microsegundos.
+        double tiempoCalculo = 0.0;
+
+        /**
+         * @brief Calcula todas las cuotas de la matriz.
+         *
+         * Recorre los plazos en orden creciente y mantiene un vector con (1 + i)^n por columna, de modo
+         * que la potencia de cada fila se obtiene con una multiplicación a partir de la fila anterior.
+         * El ciclo interno recorre las columnas de forma contigua y sin saltos para que el compilador
+         * lo pueda vectorizar.
+         *
+         * @return `void`
+         */
+        void calcular();
+
+    public:
+        /**
+         * @brief Constructor de la clase TablaCuotas.
+         *
+         * Calcula inmediatamente la matriz completa de cuotas.
+         *
+         * @param monto Monto del préstamo.
+         * @param rango Rango de plazos y tasas de la tabla.
+         * @throws `std::invalid_argument` si el rango no es válido (plazos o tasas no positivos, o sin columnas).
+         */
+        TablaCuotas(double monto, const RangoTablaCuotas& rango);
+
+        /**
+         * @brief Obtiene la tabla de cuotas de un tipo de préstamo y moneda, usando la caché.
+         *
+         * El monto se toma de los valores predeterminados en `Prestamos::Colones` o `Prestamos::Dolares`.
+         * Si la tabla ya se había calculado con el mismo rango, se retorna la almacenada; de lo contrario
+         * se calcula y reemplaza la anterior.
+         *
+         * @param tipo Tipo de préstamo.
+         * @param moneda Moneda del préstamo.
+         * @param rango Rango de plazos y tasas (opcional, por defecto `TablaCuotasDef::RANGO`).
+         * @return `std::shared_ptr<const TablaCuotas>` Tabla calculada.
+         */
+        static std::shared_ptr<const TablaCuotas> obtener(TipoPrestamo tipo, Moneda moneda,
+                                                          const RangoTablaCuotas& rango = TablaCuotasDef::RANGO);
+
+        /**
+         * @brief Elimina todas las tablas almacenadas en la caché.
+         *
+         * @return `void`
+         */
+        static void limpiarCache();
+
+        /**
+         * @brief Retorna la cuota mensual de una celda de la tabla.
+         *
+         * @param plazoMeses Plazo en meses (entre `plazoMinimo` y `plazoMaximo`).
+         * @param indiceTasa Índice de la columna de tasa (entre 0 y `cantidadTasas() - 1`).
+         * @return `double` Cuota mensual.
+         */
+        double cuota(int plazoMeses, int indiceTasa) const;
+
+        /**
+         * @brief Retorna la tasa de interés anual (%) de una columna.
+         *
+         * @param indiceTasa Índice de la columna.
+         * @return `double` Tasa de interés anual.
+         */
+        double tasa(int indiceTasa) const;
+
+        /**
+         * @brief Retorna la cantidad de filas (plazos) de la tabla.
+         *
+         * @return `int` Cantidad de plazos.
+         */
+        int cantidadPlazos() const;
+
+        /**
+         * @brief Retorna la cantidad de columnas (tasas) de la tabla.
+         *
+         * @return `int` Cantidad de tasas.
+         */
+        int cantidadTasas() const;
+
+        /**
+         * @brief Retorna el monto para el que se calculó la tabla.
+         *
+         * @return `double` Monto del préstamo.
+         */
+        double getMonto() const;
+
+        /**
+         * @brief Retorna el rango de plazos y tasas de la tabla.
+         *
+         * @return `const RangoTablaCuotas&` Rango de la tabla.
+         */
+        const RangoTablaCuotas& getRango() const;
+
+        /**
+         * @brief Retorna el tiempo que tomó calcular la matriz.
+         *
+         * @return `double` Tiempo en microsegundos.
+         */
+        double getTiempoCalculo() const;
+
+        /**
+         * @brief Exporta la tabla a un archivo `.csv`.
+         *
+         * La primera fila contiene las tasas y cada fila siguiente inicia con el plazo en meses.
+         *
+         * @param nombreArchivo Nombre del archivo a generar.
+         * @return `true` si el archivo se generó correctamente, `false` en caso contrario.
+         */
+        bool exportarCSV(const std::string& nombreArchivo) const;
+};
+
+#endif // TABLA_CUOTAS_HPP
@@ -0,0 +1,148 @@
+/**
+ * @file Tarea.hpp
+ * @brief Declaración de la clase Tarea para operaciones asíncronas con corrutinas de C++20.
+ * @details Este archivo contiene la plantilla Tarea, el tipo de retorno de las corrutinas del sistema.
+ *          Una Tarea no se ejecuta hasta que otra corrutina la espera con `co_await` o se lanza en un
+ *          Ejecutor, y al terminar reanuda directamente a la corrutina que la esperaba.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef TAREA_HPP
+#define TAREA_HPP
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+template <typename T>
+class Tarea;
+
+/**
+ * @class PromesaBase
+ * @brief Parte común de las promesas de Tarea: continuación y excepción de la corrutina.
+ */
+class PromesaBase {
+    public:
+        /// @brief Corrutina a reanudar cuando la tarea termine.
+        std::coroutine_handle<> continuacion = std::noop_coroutine();
+
+        /// @brief Excepción lanzada por la corrutina, si la hubo.
+        std::exception_ptr excepcion;
+
+        /**
+         * @brief Al terminar, transfiere el control a la continuación sin crecer la pila.
+         */
+        struct EsperaFinal {
+            bool await_ready() noexcept { return false; }
+
+            template <typename Promesa>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promesa> corrutina) noexcept {
+                return corrutina.promise().continuacion;
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        // La corrutina inicia suspendida: se ejecuta cuando alguien la espera
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        EsperaFinal final_suspend() noexcept { return {}; }
+        void unhandled_exception() noexcept { excepcion = std::current_exception(); }
+};
+
+/**
+ * @class PromesaTarea
+ * @brief Promesa de una Tarea que retorna un valor de tipo T.
+ */
+template <typename T>
+class PromesaTarea : public PromesaBase {
+    public:
+        /// @brief Valor retornado con `co_return`.
+        std::optional<T> valor;
+
+        Tarea<T> get_return_object() noexcept;
+        void return_value(T resultado) { valor.emplace(std::move(resultado)); }
+
+        T obtener() {
+            if (excepcion) std::rethrow_exception(excepcion);
+            return std::move(*valor);
+        }
+};
+
+/**
+ * @class PromesaTarea<void>
+ * @brief Promesa de una Tarea que no retorna valor.
+ */
+template <>
+class PromesaTarea<void> : public PromesaBase {
+    public:
+        Tarea<void> get_return_object() noexcept;
+        void return_void() noexcept {}
+
+        void obtener() {
+            if (excepcion) std::rethrow_exception(excepcion);
+        }
+};
+
+/**
+ * @class Tarea
+ * @brief Corrutina diferida que retorna un valor de tipo T al esperarla con `co_await`.
+ *
+ * La Tarea es dueña del marco de la corrutina y lo destruye al destruirse. Se puede mover, pero no
+ * copiar, y solo se puede esperar una vez.
+ *
+ * @tparam T Tipo del valor retornado (`void` si no retorna valor).
+ */
+template <typename T = void>
+class Tarea {
+    public:
+        using promise_type = PromesaTarea<T>;
+
+    private:
+        std::coroutine_handle<promise_type> corrutina;
+
+    public:
+        explicit Tarea(std::coroutine_handle<promise_type> corrutina) noexcept : corrutina(corrutina) {}
+
+        Tarea(Tarea&& otra) noexcept : corrutina(std::exchange(otra.corrutina, nullptr)) {}
+
+        Tarea& operator=(Tarea&& otra) noexcept {
+            if (this != &otra) {
+                if (corrutina) corrutina.destroy();
+                corrutina = std::exchange(otra.corrutina, nullptr);
+            }
+            return *this;
+        }
+
+        Tarea(const Tarea&) = delete;
+        Tarea& operator=(const Tarea&) = delete;
+
+        ~Tarea() {
+            if (corrutina) corrutina.destroy();
+        }
+
+        // Interfaz de espera: suspende a quien espera y ejecuta la tarea hasta su primera suspensión
+        bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> quienEspera) noexcept {
+            corrutina.promise().continuacion = quienEspera;
+            return corrutina;
+        }
+
+        T await_resume() { return corrutina.promise().obtener(); }
+};
+
+template <typename T>
+Tarea<T> PromesaTarea<T>::get_return_object() noexcept {
+    return Tarea<T>(std::coroutine_handle<PromesaTarea<T>>::from_promise(*this));
+}
+
+inline Tarea<void> PromesaTarea<void>::get_return_object() noexcept {
+    return Tarea<void>(std::coroutine_handle<PromesaTarea<void>>::from_promise(*this));
+}
+
+#endif // TAREA_HPP
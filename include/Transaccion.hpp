@@ -15,7 +15,7 @@
 #ifndef TRANSACCION_HPP
 #define TRANSACCION_HPP
 
-#include <string>
+#include "Codigos.hpp"
 #include <sqlite3.h>
 
 /**
@@ -38,7 +38,7 @@ class Transaccion {
         int idDestinatario;
 
         /// @brief Tipo de transacción
-        std::string tipo;
+        TipoTransaccion tipo;
 
         /// @brief Monto de la transacción
         double monto;
@@ -52,10 +52,10 @@ class Transaccion {
          * 
          * @param idRemitente ID de la cuenta remitente.
          * @param idDestinatario ID de la cuenta destinataria.
-         * @param tipo Tipo de transacción ('DEP' para depósito, 'RET' para retiro, 'TRA' para transaccion, 'ABO' para abono, 'CDP' para CDP).
+         * @param tipo Tipo de transacción (depósito, retiro, transferencia, abono o CDP).
          * @param monto Monto de la transacción.
          */
-        Transaccion(int idRemitente, int idDestinatario, const std::string &tipo, double monto);
+        Transaccion(int idRemitente, int idDestinatario, TipoTransaccion tipo, double monto);
         
         /**
          * @brief Procesa la transacción en la base de datos.
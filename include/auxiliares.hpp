@@ -15,17 +15,19 @@
 #ifndef AUXILIARES_HPP
 #define AUXILIARES_HPP
 
+#include "Codigos.hpp"
 #include <iostream>
 
 /**
  * @brief Valida y obtiene una fecha en formato YYYY-MM-DD.
  * 
- * Esta función solicita una fecha al usuario y verifica que cumpla con el formato y
- * los límites de días y meses.
+ * Esta función solicita una fecha al usuario y verifica con esFechaValida que cumpla con
+ * el formato y los límites de días y meses, incluidos los años bisiestos.
  * 
+ * @param entrada Flujo desde el que se lee la fecha.
  * @return `std::string` La fecha validada en formato YYYY-MM-DD.
  */
-std::string validarFecha();
+std::string validarFecha(std::istream& entrada = std::cin);
 
 /**
  * @brief Obtiene un número entero positivo del usuario.
@@ -52,9 +54,9 @@ double obtenerDecimal();
  * 
  * Presenta opciones de moneda al usuario ('USD' o 'CRC') y solicita una selección.
  * 
- * @return `std::string` La moneda seleccionada ('USD' o 'CRC').
+ * @return `Moneda` La moneda seleccionada.
  */
-std::string validarMoneda();
+Moneda validarMoneda();
 
 /**
  * @brief Valida y obtiene un número de teléfono en formato ####-####.
@@ -62,9 +64,10 @@ std::string validarMoneda();
  * Solicita un número de teléfono al usuario y verifica que cumpla con el formato
  * ####-####. En caso de formato incorrecto, solicita nuevamente el ingreso.
  * 
+ * @param entrada Flujo desde el que se lee el número de teléfono.
  * @return `std::string` El número de teléfono validado en formato ####-####.
  */
-std::string validarTelefono();
+std::string validarTelefono(std::istream& entrada = std::cin);
 
 /**
  * @brief Valida el ingreso de 's' o 'n' para operaciones donde se realizan preguntas binarias.
@@ -78,11 +81,12 @@ bool validarRespuestaSN();
 /**
  * @brief Valida el ingreso de un nombre de un archivo con extensión .csv.
  * 
- * Utiliza regex para validar el formato y solicita el ingreso del nombre hasta que se indique uno válido.
+ * Utiliza esArchivoCSV para validar el formato y solicita el ingreso del nombre hasta que se indique uno válido.
  * 
+ * @param entrada Flujo desde el que se lee el nombre del archivo.
  * @return `std::string` El nombre del .csv ingresado.
  */
-std::string obtenerArchivoCSV();
+std::string obtenerArchivoCSV(std::istream& entrada = std::cin);
 
 /**
  * @brief Calcula la potencia de un número.
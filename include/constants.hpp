@@ -14,6 +14,8 @@
 #ifndef CONSTANTS_HPP
 #define CONSTANTS_HPP
 
+#include <cstdint>
+
 /**
  * @enum MenuPrincipalOpciones
  * @brief Opciones del menú principal de la aplicación.
@@ -36,11 +38,13 @@ enum class MenuPrincipalOpciones {
  * Enumeración que representa las opciones en el menú de atención al cliente:
  * - INICIAR_SESION: Opción para iniciar sesión con un cliente existente.
  * - REGISTRAR_CLIENTE: Opción para registrar un nuevo cliente.
+ * - BUSCAR_CLIENTE: Opción para buscar clientes por nombre, apellidos o teléfono.
  * - REGRESAR: Opción para regresar al menú principal.
  */
 enum class MenuAtencionClienteOpciones {
     INICIAR_SESION = 1,
     REGISTRAR_CLIENTE,
+    BUSCAR_CLIENTE,
     REGRESAR
 };
 
@@ -71,6 +75,7 @@ enum class MenuCuentaOpciones {
  * - DEPOSITO: Opción para realizar un depósito en la cuenta.
  * - TRANSFERENCIA: Opción para realizar una transferencia a otra cuenta.
  * - RETIRO: Opción para retirar fondos de la cuenta.
+ * - EXPORTAR_ESTADO_CUENTA: Opción para exportar el estado de cuenta a un archivo (.csv).
  * - REGRESAR: Opción para regresar al menú de selección de cuenta.
  */
 enum class OperacionesCliente {
@@ -81,6 +86,7 @@ enum class OperacionesCliente {
     DEPOSITO,
     TRANSFERENCIA,
     RETIRO,
+    EXPORTAR_ESTADO_CUENTA,
     REGRESAR
 };
 
@@ -91,11 +97,17 @@ enum class OperacionesCliente {
  * Enumeración que representa las acciones disponibles en el menú de préstamos:
  * - SOLICITAR_PRESTAMO: Opción para solicitar un nuevo préstamo.
  * - CONSULTAR_PRESTAMOS: Opción para consultar los préstamos existentes.
+ * - TABLA_CUOTAS: Opción para generar una tabla de cuotas por plazo y tasa.
+ * - REPORTE_MORA: Opción para generar el reporte de mora de la cartera.
+ * - REPORTE_CARTERA: Opción para generar el reporte de estado de todos los préstamos.
  * - REGRESAR: Opción para regresar al menú principal.
  */
 enum class MenuPrestamosOpciones {
     SOLICITAR_PRESTAMO = 1,
     CONSULTAR_PRESTAMOS,
+    TABLA_CUOTAS,
+    REPORTE_MORA,
+    REPORTE_CARTERA,
     REGRESAR
 };
 
@@ -129,6 +141,23 @@ enum class OpcionesAbono {
     REGRESAR
 };
 
+/**
+ * @enum TipoAbono
+ * @brief Tipos de abono que se pueden realizar a un préstamo.
+ * 
+ * Enumeración que representa la forma del abono:
+ * - CUOTA_MENSUAL: Pago de la cuota mensual.
+ * - VARIAS_CUOTAS: Pago de varias cuotas en una sola operación.
+ * - CAPITAL: Abono extraordinario al capital.
+ * - CANCELAR: Opción para cancelar el abono.
+ */
+enum class TipoAbono {
+    CUOTA_MENSUAL = 1,
+    VARIAS_CUOTAS,
+    CAPITAL,
+    CANCELAR
+};
+
 /**
  * @enum TipoPrestamo
  * @brief Tipos de préstamos disponibles.
@@ -138,7 +167,7 @@ enum class OpcionesAbono {
  * - PRENDARIO: Préstamo prendario.
  * - HIPOTECARIO: Préstamo hipotecario.
  */
-enum class TipoPrestamo {
+enum class TipoPrestamo : uint8_t {
     PERSONAL = 1,
     PRENDARIO,
     HIPOTECARIO
@@ -0,0 +1,129 @@
+/**
+ * @file validaciones.hpp
+ * @brief Funciones para validar el formato de fechas, teléfonos y nombres de archivos `.csv`.
+ * @details Este archivo contiene funciones `constexpr` que verifican los mismos formatos que las
+ *          funciones de ingreso de auxiliares.hpp recorriendo los caracteres directamente, sin
+ *          expresiones regulares ni lectura de la entrada estándar. Se utilizan tanto en los menús
+ *          como en las importaciones masivas, donde se validan millones de valores.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifndef VALIDACIONES_HPP
+#define VALIDACIONES_HPP
+
+#include <string_view>
+
+/**
+ * @brief Indica si un carácter es un dígito decimal.
+ *
+ * @param c Carácter a verificar.
+ * @return `true` si el carácter está entre '0' y '9'.
+ */
+constexpr bool esDigito(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Indica si un año es bisiesto según el calendario gregoriano.
+ *
+ * @param año Año a verificar.
+ * @return `true` si el año es bisiesto.
+ */
+constexpr bool esBisiesto(int año) {
+    return año % 4 == 0 && (año % 100 != 0 || año % 400 == 0);
+}
+
+/**
+ * @brief Retorna la cantidad de días de un mes.
+ *
+ * @param año Año del mes, para febrero en años bisiestos.
+ * @param mes Mes entre 1 y 12.
+ * @return `int` Cantidad de días del mes, o 0 si el mes no es válido.
+ */
+constexpr int diasDelMes(int año, int mes) {
+    constexpr int dias[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (mes < 1 || mes > 12) {
+        return 0;
+    }
+    return mes == 2 && esBisiesto(año) ? 29 : dias[mes - 1];
+}
+
+/**
+ * @brief Verifica que una fecha tenga el formato YYYY-MM-DD y exista en el calendario.
+ *
+ * El año debe estar entre 1000 y 2999, y el día debe existir en el mes indicado, incluido el
+ * 29 de febrero de los años bisiestos.
+ *
+ * @param fecha Fecha a verificar.
+ * @return `true` si la fecha es válida.
+ */
+constexpr bool esFechaValida(std::string_view fecha) {
+    if (fecha.size() != 10 || fecha[4] != '-' || fecha[7] != '-') {
+        return false;
+    }
+    for (size_t i : {0, 1, 2, 3, 5, 6, 8, 9}) {
+        if (!esDigito(fecha[i])) {
+            return false;
+        }
+    }
+
+    int año = (fecha[0] - '0') * 1000 + (fecha[1] - '0') * 100 + (fecha[2] - '0') * 10 + (fecha[3] - '0');
+    int mes = (fecha[5] - '0') * 10 + (fecha[6] - '0');
+    int dia = (fecha[8] - '0') * 10 + (fecha[9] - '0');
+
+    return año >= 1000 && año <= 2999 && dia >= 1 && dia <= diasDelMes(año, mes);
+}
+
+/**
+ * @brief Verifica que un número de teléfono tenga el formato ####-####.
+ *
+ * @param telefono Número de teléfono a verificar.
+ * @return `true` si el formato es válido.
+ */
+constexpr bool esTelefonoValido(std::string_view telefono) {
+    if (telefono.size() != 9 || telefono[4] != '-') {
+        return false;
+    }
+    for (size_t i = 0; i < telefono.size(); i++) {
+        if (i != 4 && !esDigito(telefono[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Verifica que un nombre corresponda a un archivo con extensión `.csv`.
+ *
+ * La extensión no distingue mayúsculas de minúsculas, el nombre antes de la extensión no puede
+ * estar vacío y no puede contener los caracteres `/ : * ? " < > |`.
+ *
+ * @param nombreArchivo Nombre del archivo a verificar.
+ * @return `true` si el nombre es válido.
+ */
+constexpr bool esArchivoCSV(std::string_view nombreArchivo) {
+    if (nombreArchivo.size() < 5) {
+        return false;
+    }
+
+    std::string_view extension = nombreArchivo.substr(nombreArchivo.size() - 4);
+    if (extension[0] != '.' || (extension[1] | 0x20) != 'c' || (extension[2] | 0x20) != 's' || (extension[3] | 0x20) != 'v') {
+        return false;
+    }
+
+    for (char c : nombreArchivo.substr(0, nombreArchivo.size() - 4)) {
+        switch (c) {
+            case '/': case ':': case '*': case '?': case '"': case '<': case '>': case '|':
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+#endif // VALIDACIONES_HPP
@@ -0,0 +1,138 @@
+/**
+ * @file BancoAsincrono.cpp
+ * @brief Implementación de la clase BancoAsincrono con las operaciones bancarias como corrutinas.
+ * @details Este archivo contiene la definición de las corrutinas de BancoAsincrono. Cada una envía la
+ *          operación al pool correspondiente, donde se ejecuta con los métodos de Cuenta, Cliente y
+ *          Prestamo, y se reanuda en el Ejecutor con el resultado.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "BancoAsincrono.hpp"
+#include "Cliente.hpp"
+#include "Cuenta.hpp"
+#include "Prestamo.hpp"
+#include "CapturaSalida.hpp"
+#include <iostream>
+#include <utility>
+
+// Función auxiliar para ejecutar una operación y guardar sus mensajes de error como detalle
+template <typename Operacion>
+static ResultadoOperacion capturar(Operacion operacion) {
+    ResultadoOperacion resultado;
+    CapturaSalida captura; // Mensajes de esta operación en flujos propios del hilo del pool
+
+    try {
+        resultado.exito = operacion(resultado.valor);
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        resultado.exito = false;
+    }
+
+    if (!resultado.exito) {
+        resultado.detalle = captura.tomarErrores();
+    }
+    return resultado;
+}
+
+// Función auxiliar para ejecutar una operación sobre una cuenta existente y retornar su saldo
+template <typename Operacion>
+static ResultadoOperacion operarCuenta(sqlite3* db, int idCuenta, Operacion operacion) {
+    return capturar([&](double& saldo) {
+        Cuenta cuenta = Cuenta::obtener(db, idCuenta);
+        if (cuenta.getID() == 0 || !operacion(cuenta)) {
+            return false;
+        }
+        saldo = cuenta.verSaldo();
+        return true;
+    });
+}
+
+// Corrutina auxiliar que ejecuta una operación en un pool; si el pool ya se cerró, retorna un resultado fallido
+template <typename Funcion>
+static Tarea<ResultadoOperacion> ejecutarEn(PoolTrabajo& pool, Funcion funcion) {
+    try {
+        co_return co_await pool.ejecutar(std::move(funcion));
+    } catch (const std::exception& e) {
+        co_return ResultadoOperacion{false, 0, e.what()};
+    }
+}
+
+
+// Definición del constructor de la clase BancoAsincrono
+BancoAsincrono::BancoAsincrono(Ejecutor& ejecutor, const std::string& nombreDB, unsigned int hilosLectura)
+    : escritor(ejecutor, nombreDB, 1, false), lectores(ejecutor, nombreDB, hilosLectura, true) {}
+
+
+// Definición de corrutina para consultar el saldo de una cuenta
+Tarea<ResultadoOperacion> BancoAsincrono::verSaldo(int idCuenta) {
+    return ejecutarEn(lectores, [idCuenta](sqlite3* db) {
+        return operarCuenta(db, idCuenta, [](Cuenta&) { return true; });
+    });
+}
+
+// Definición de corrutina para buscar un cliente por su cédula
+Tarea<ResultadoOperacion> BancoAsincrono::buscarCliente(int cedula) {
+    return ejecutarEn(lectores, [cedula](sqlite3* db) {
+        return capturar([&](double& idCliente) {
+            Cliente cliente = Cliente::obtener(db, cedula);
+            idCliente = cliente.getID();
+            return cliente.getID() != 0;
+        });
+    });
+}
+
+// Definición de corrutina para depositar en una cuenta
+Tarea<ResultadoOperacion> BancoAsincrono::depositar(int idCuenta, double monto) {
+    return ejecutarEn(escritor, [idCuenta, monto](sqlite3* db) {
+        return operarCuenta(db, idCuenta, [&](Cuenta& cuenta) { return cuenta.depositar(db, monto); });
+    });
+}
+
+// Definición de corrutina para retirar de una cuenta
+Tarea<ResultadoOperacion> BancoAsincrono::retirar(int idCuenta, double monto) {
+    return ejecutarEn(escritor, [idCuenta, monto](sqlite3* db) {
+        return operarCuenta(db, idCuenta, [&](Cuenta& cuenta) { return cuenta.retirar(db, monto); });
+    });
+}
+
+// Definición de corrutina para transferir entre cuentas
+Tarea<ResultadoOperacion> BancoAsincrono::transferir(int idCuenta, int idCuentaDestino, double monto) {
+    return ejecutarEn(escritor, [idCuenta, idCuentaDestino, monto](sqlite3* db) {
+        return operarCuenta(db, idCuenta, [&](Cuenta& cuenta) { return cuenta.transferir(db, idCuentaDestino, monto); });
+    });
+}
+
+// Definición de corrutina para abonar una cuota de un préstamo
+Tarea<ResultadoOperacion> BancoAsincrono::abonarCuota(int idPrestamo, int idCuenta) {
+    return abonarCuotas(idPrestamo, idCuenta, 1);
+}
+
+// Definición de corrutina para abonar varias cuotas de un préstamo
+Tarea<ResultadoOperacion> BancoAsincrono::abonarCuotas(int idPrestamo, int idCuenta, int cantidadCuotas) {
+    return ejecutarEn(escritor, [idPrestamo, idCuenta, cantidadCuotas](sqlite3* db) {
+        return operarCuenta(db, idCuenta, [&](Cuenta& cuenta) {
+            Prestamo prestamo = Prestamo::obtener(db, idPrestamo);
+            return prestamo.getID() != 0 && prestamo.abonarCuotas(db, cuenta, cantidadCuotas);
+        });
+    });
+}
+
+// Definición de corrutina para solicitar un CDP
+Tarea<ResultadoOperacion> BancoAsincrono::solicitarCDP(int idCuenta, double monto, int plazoMeses, double tasaInteres) {
+    return ejecutarEn(escritor, [idCuenta, monto, plazoMeses, tasaInteres](sqlite3* db) {
+        return operarCuenta(db, idCuenta, [&](Cuenta& cuenta) {
+            return cuenta.solicitarCDP(db, cuenta.getMoneda(), monto, plazoMeses, tasaInteres);
+        });
+    });
+}
+
+
+// Definición de método para cerrar los pools
+void BancoAsincrono::cerrar() {
+    escritor.cerrar();
+    lectores.cerrar();
+}
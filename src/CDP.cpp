@@ -12,11 +12,13 @@
  */
 
 #include "CDP.hpp"
+#include "Consultas.hpp"
+#include "CapturaSalida.hpp"
 #include <iostream>
 #include <string>
 
 // Definición del constructor de la clase CDP
-CDP::CDP(int idCuenta, const std::string &moneda, double deposito, int plazoMeses, double tasaInteres)
+CDP::CDP(int idCuenta, Moneda moneda, double deposito, int plazoMeses, double tasaInteres)
     : idCuenta(idCuenta), moneda(moneda), deposito(deposito), plazoMeses(plazoMeses), tasaInteres(tasaInteres) {}
 
 
@@ -27,17 +29,14 @@ double CDP::interesGanado() const {
 
 // Definición de método para crear el CDP
 bool CDP::crear(sqlite3* db) {
-    std::string sql = R"(
-        INSERT INTO CDP (idCuenta, moneda, deposito, plazoMeses, tasaInteres)
-        VALUES (?, ?, ?, ?, ?);
-    )";
+    std::string sql = SQL_CREAR_CDP;
 
     try {
         SQLiteStatement statement(db, sql);
 
         // Asociar los valores a la consulta preparada
         sqlite3_bind_int(statement.get(), 1, idCuenta);
-        sqlite3_bind_text(statement.get(), 2, moneda.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, valor(moneda));
         sqlite3_bind_double(statement.get(), 3, deposito);
         sqlite3_bind_int(statement.get(), 4, plazoMeses);
         sqlite3_bind_double(statement.get(), 5, tasaInteres);
@@ -48,11 +47,11 @@ bool CDP::crear(sqlite3* db) {
         }
 
         idCDP = sqlite3_last_insert_rowid(db);
-        std::cout << "CDP creado con éxito. ID: " << idCDP << std::endl;
+        flujoSalida() << "CDP creado con éxito. ID: " << idCDP << std::endl;
 
         return true; // Creación exitosa
     } catch (const std::exception& e) {
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false; // Creación fallida
     }
 }
@@ -61,10 +60,10 @@ bool CDP::crear(sqlite3* db) {
 // Definición de método para obtener un CDP de la base de datos
 CDP CDP::obtener(sqlite3* db, int idCDP) {
     // Consulta SQL para obtener los datos del CDP
-    std::string sql = "SELECT idCuenta, moneda, deposito, plazoMeses, tasaInteres FROM CDP WHERE idCDP = ?;";
+    std::string sql = SQL_OBTENER_CDP;
 
     // Crear instancia vacía de CDP
-    CDP cdp(0, "", 0.0, 0, 0.0);
+    CDP cdp(0, Moneda::CRC, 0.0, 0, 0.0);
 
     try {
         // Crear instancia de SQLiteStatement para manejar el statement
@@ -78,7 +77,7 @@ CDP CDP::obtener(sqlite3* db, int idCDP) {
             // Asignar los valores obtenidos a la instancia de CDP
             cdp.idCDP = idCDP;
             cdp.idCuenta = sqlite3_column_int(statement.get(), 0);
-            cdp.moneda = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 1));
+            cdp.moneda = monedaSegunValor(sqlite3_column_int(statement.get(), 1));
             cdp.deposito = sqlite3_column_double(statement.get(), 2);
             cdp.plazoMeses = sqlite3_column_int(statement.get(), 3);
             cdp.tasaInteres = sqlite3_column_double(statement.get(), 4);
@@ -88,12 +87,46 @@ CDP CDP::obtener(sqlite3* db, int idCDP) {
         }
     } catch (const std::exception& e) {
         // Manejar errores y reportar en consola
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
     }
 
     return cdp;
 }
 
+// Definición de método estático para obtener varios CDP en una sola consulta
+std::vector<CDP> CDP::obtenerVarios(sqlite3* db, std::span<const int> idsCDP) {
+    // Consulta SQL que recorre la lista de IDs con json_each; j.key conserva el orden de la lista
+    std::string sql = SQL_OBTENER_CDPS;
+
+    std::vector<CDP> cdps;
+
+    try {
+        SQLiteStatement statement(db, sql);
+        statement.bindLista(1, idsCDP);
+        cdps.reserve(idsCDP.size());
+
+        // Crear un CDP por cada fila obtenida
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            CDP& cdp = cdps.emplace_back(sqlite3_column_int(statement.get(), 1),
+                                         monedaSegunValor(sqlite3_column_int(statement.get(), 2)),
+                                         sqlite3_column_double(statement.get(), 3),
+                                         sqlite3_column_int(statement.get(), 4),
+                                         sqlite3_column_double(statement.get(), 5));
+            cdp.idCDP = sqlite3_column_int(statement.get(), 0);
+        }
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al obtener los CDP: " + std::string(sqlite3_errmsg(db)));
+        }
+    } catch (const std::exception& e) {
+        // Manejar errores y reportar en consola
+        flujoErrores() << e.what() << std::endl;
+        cdps.clear();
+    }
+
+    return cdps;
+}
+
 
 int CDP::getID() const {
     return idCDP;
@@ -102,11 +135,11 @@ int CDP::getID() const {
 // Función para mostrar la información básica del CDP en el menú al consultar su estado
 void CDP::mostrarInformacion() const {
     // Imprime los datos del CDP con formato tabular
-    std::cout << "\n=== Estado del CDP ===" << std::endl;
-    std::cout << std::left << std::setw(20) << "ID del CDP:" << idCDP << std::endl;
-    std::cout << std::left << std::setw(20) << "ID de la Cuenta:" << idCuenta << std::endl;
-    std::cout << std::left << std::setw(20) << "Moneda:" << moneda << std::endl;
-    std::cout << std::left << std::setw(20) << "Monto:" << deposito << std::endl;
-    std::cout << std::left << std::setw(20) << "Plazo en Meses:" << plazoMeses << std::endl;
-    std::cout << std::left << std::setw(20) << "Tasa de Interés:" << tasaInteres << std::endl;
+    flujoSalida() << "\n=== Estado del CDP ===" << std::endl;
+    flujoSalida() << std::left << std::setw(20) << "ID del CDP:" << idCDP << std::endl;
+    flujoSalida() << std::left << std::setw(20) << "ID de la Cuenta:" << idCuenta << std::endl;
+    flujoSalida() << std::left << std::setw(20) << "Moneda:" << codigo(moneda) << std::endl;
+    flujoSalida() << std::left << std::setw(20) << "Monto:" << deposito << std::endl;
+    flujoSalida() << std::left << std::setw(20) << "Plazo en Meses:" << plazoMeses << std::endl;
+    flujoSalida() << std::left << std::setw(20) << "Tasa de Interés:" << tasaInteres << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+ * @file CapturaSalida.cpp
+ * @brief Implementación de la clase CapturaSalida para capturar los mensajes de las operaciones.
+ * @details Este archivo contiene la definición de los métodos de CapturaSalida y de las funciones
+ *          flujoSalida y flujoErrores.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "CapturaSalida.hpp"
+#include <iostream>
+#include <utility>
+
+// Flujos de la captura activa de cada hilo (nulos si no hay ninguna)
+static thread_local std::ostream* salidaHilo = nullptr;
+static thread_local std::ostream* erroresHilo = nullptr;
+
+
+// Definición del constructor de la clase CapturaSalida
+CapturaSalida::CapturaSalida()
+    : descarte(nullptr), salidaAnterior(std::exchange(salidaHilo, &descarte)),
+      erroresAnterior(std::exchange(erroresHilo, &errores)) {}
+
+// Definición del destructor de la clase CapturaSalida
+CapturaSalida::~CapturaSalida() {
+    salidaHilo = salidaAnterior;
+    erroresHilo = erroresAnterior;
+}
+
+// Definición de método para recuperar los mensajes de error de la captura
+std::string CapturaSalida::tomarErrores() {
+    std::string mensajes = errores.str();
+    errores.str(std::string());
+    while (!mensajes.empty() && mensajes.back() == '\n') {
+        mensajes.pop_back();
+    }
+    return mensajes;
+}
+
+
+// Definición de función para obtener el flujo de salida del hilo actual
+std::ostream& flujoSalida() {
+    return salidaHilo ? *salidaHilo : std::cout;
+}
+
+// Definición de función para obtener el flujo de errores del hilo actual
+std::ostream& flujoErrores() {
+    return erroresHilo ? *erroresHilo : std::cerr;
+}
@@ -11,7 +11,12 @@
  */
 
 #include "Cliente.hpp"
+#include "Consultas.hpp"
 #include "SQLiteStatement.hpp"
+#include "FiltrosExistencia.hpp"
+#include "CapturaSalida.hpp"
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 
 // Constructor para inicializar un cliente con los datos proporcionados.
@@ -24,12 +29,12 @@ Cliente::Cliente(int cedula, const std::string &nombre, const std::string &prime
 bool Cliente::crear(sqlite3* db) {
     // Verificar que no exista un cliente con el mismo número de cédula
     if (Cliente::existe(db, this->cedula)) {
-        std::cerr << "Error: Ya existe un cliente con el número de cédula" << std::endl;
+        flujoErrores() << "Error: Ya existe un cliente con el número de cédula" << std::endl;
         return false;
     }
 
     // Consulta SQL para insertar un nuevo cliente en la base de datos
-    const std::string sql = "INSERT INTO Clientes (cedula, nombre, primerApellido, segundoApellido, telefono) VALUES (?, ?, ?, ?, ?);";
+    const std::string sql = SQL_CREAR_CLIENTE;
 
     try {
         SQLiteStatement statement(db, sql);
@@ -48,20 +53,26 @@ bool Cliente::crear(sqlite3* db) {
 
         // Obtener el ID del cliente recién insertado y asignarlo al atributo idCliente
         idCliente = sqlite3_last_insert_rowid(db);
-        std::cout << "Cliente creado con ID: " << idCliente << std::endl;
+        flujoSalida() << "Cliente creado con ID: " << idCliente << std::endl;
         return true;
 
     } catch (const std::exception& e) {
         // Manejar errores y reportar mensajes en consola
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
 
+// Función auxiliar para leer una columna de texto que puede ser nula
+static std::string columnaTexto(sqlite3_stmt* statement, int columna) {
+    const unsigned char* valor = sqlite3_column_text(statement, columna);
+    return valor != nullptr ? std::string(reinterpret_cast<const char*>(valor)) : std::string();
+}
+
 // Función para obtener un cliente desde la base de datos por medio de su cédula
 Cliente Cliente::obtener(sqlite3* db, int cedula) {
     // Consulta SQL para seleccionar datos del cliente a partir de su cédula
-    std::string sql = "SELECT idCliente, nombre, primerApellido, segundoApellido, telefono FROM Clientes WHERE cedula = ?;";
+    std::string sql = SQL_OBTENER_CLIENTE;
 
     // Crear un cliente vacío que se retornará si no se encuentra el cliente en la base de datos
     Cliente cliente(0, "", "", "", "");
@@ -73,28 +84,67 @@ Cliente Cliente::obtener(sqlite3* db, int cedula) {
         sqlite3_bind_int(statement.get(), 1, cedula);
 
         // Ejecutar la consulta y verificar si se encontró un registro
-        if (sqlite3_step(statement.get()) == SQLITE_ROW) {
+        int resultado = sqlite3_step(statement.get());
+        if (resultado == SQLITE_ROW) {
             // Asignar los valores obtenidos de la base de datos al objeto cliente
             cliente.idCliente = sqlite3_column_int(statement.get(), 0);
             cliente.cedula = cedula;
             cliente.nombre = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 1));
             cliente.primerApellido = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 2));
-            cliente.segundoApellido = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 3));
-            cliente.telefono = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 4));
-        } else {
+            cliente.segundoApellido = columnaTexto(statement.get(), 3);
+            cliente.telefono = columnaTexto(statement.get(), 4);
+        } else if (resultado == SQLITE_DONE) {
             throw std::runtime_error("Error: Cliente no encontrado con la cédula ingresada.");
+        } else {
+            throw std::runtime_error("Error al consultar el cliente: " + std::string(sqlite3_errmsg(db)));
         }
     } catch(const std::exception& e) {
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
     }
 
     return cliente;
 }
 
+// Función para obtener varios clientes en una sola consulta a partir de sus cédulas
+std::vector<Cliente> Cliente::obtenerVarios(sqlite3* db, std::span<const int> cedulas) {
+    // La lista de cédulas se recorre con json_each; j.key conserva el orden de la lista
+    std::string sql = SQL_OBTENER_CLIENTES;
+
+    std::vector<Cliente> clientes;
+
+    try {
+        SQLiteStatement statement(db, sql);
+        statement.bindLista(1, cedulas);
+        clientes.reserve(cedulas.size());
+
+        // Crear un cliente por cada fila obtenida
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            Cliente& cliente = clientes.emplace_back(sqlite3_column_int(statement.get(), 1), columnaTexto(statement.get(), 2),
+                                                     columnaTexto(statement.get(), 3), columnaTexto(statement.get(), 4),
+                                                     columnaTexto(statement.get(), 5));
+            cliente.idCliente = sqlite3_column_int(statement.get(), 0);
+        }
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al obtener los clientes: " + std::string(sqlite3_errmsg(db)));
+        }
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        clientes.clear();
+    }
+
+    return clientes;
+}
+
 // Función para verificar si existe un cliente en la base de datos con la cédula
 bool Cliente::existe(sqlite3* db, int cedula) {
+    // Si el filtro de Bloom descarta la cédula, no es necesario consultar la base de datos
+    if (!FiltrosExistencia::puedeExistir(db, FiltroExistencia::CLIENTES, cedula)) {
+        return false;
+    }
+
     // Consulta SQL para verificar la existencia de un cliente mediante su cédula
-    const std::string sql = "SELECT COUNT(1) FROM Clientes WHERE cedula = ?;";
+    const std::string sql = SQL_EXISTE_CLIENTE;
 
     try {
         // Utilizar SQLiteStatement para manejar el ciclo de vida del statement
@@ -113,11 +163,99 @@ bool Cliente::existe(sqlite3* db, int cedula) {
 
     } catch (const std::exception& e) {
         // Manejar errores y reportar mensajes en consola
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false; // Retornar false en caso de error
     }
 }
 
+// Función auxiliar para convertir el texto ingresado en una consulta de FTS5
+static std::string consultaBusqueda(const std::string& texto) {
+    std::string consulta;
+    size_t i = 0;
+
+    while (i < texto.size()) {
+        // Cada palabra separada por espacios se busca como una frase con el último término como prefijo,
+        // de modo que "8888-12" coincida con los teléfonos que empiezan con esos dígitos
+        std::vector<std::string> terminos;
+        std::string termino;
+
+        auto agregarTermino = [&]() {
+            // Un número de teléfono sin guion se separa como lo hace el tokenizador con "####-####"
+            bool soloDigitos = !termino.empty() && std::all_of(termino.begin(), termino.end(), [](unsigned char c) { return std::isdigit(c); });
+            if (soloDigitos && termino.size() > 4) {
+                terminos.push_back(termino.substr(0, 4));
+                termino.erase(0, 4);
+            }
+            if (!termino.empty()) {
+                terminos.push_back(termino);
+                termino.clear();
+            }
+        };
+
+        for (; i < texto.size() && !std::isspace(static_cast<unsigned char>(texto[i])); i++) {
+            unsigned char c = static_cast<unsigned char>(texto[i]);
+            if (std::isalnum(c) || c >= 0x80) {
+                termino += static_cast<char>(c);
+            } else {
+                agregarTermino();
+            }
+        }
+        agregarTermino();
+
+        if (!terminos.empty()) {
+            consulta += consulta.empty() ? "\"" : " \"";
+            for (size_t t = 0; t < terminos.size(); t++) {
+                consulta += (t > 0 ? " " : "") + terminos[t];
+            }
+            consulta += "\"*";
+        }
+
+        while (i < texto.size() && std::isspace(static_cast<unsigned char>(texto[i]))) {
+            i++;
+        }
+    }
+
+    return consulta;
+}
+
+// Función para buscar clientes por nombre, apellidos o teléfono
+std::vector<Cliente> Cliente::buscar(sqlite3* db, const std::string& texto, int limite) {
+    // Consulta SQL que ordena las coincidencias del índice de texto completo por relevancia
+    const std::string sql = SQL_BUSCAR_CLIENTES;
+
+    std::vector<Cliente> clientes;
+    std::string consulta = consultaBusqueda(texto);
+    if (consulta.empty()) {
+        return clientes;
+    }
+
+    try {
+        SQLiteStatement statement(db, sql);
+
+        // Asignar la consulta y el límite de resultados
+        sqlite3_bind_text(statement.get(), 1, consulta.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, limite);
+
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            Cliente cliente(sqlite3_column_int(statement.get(), 1), columnaTexto(statement.get(), 2), columnaTexto(statement.get(), 3),
+                            columnaTexto(statement.get(), 4), columnaTexto(statement.get(), 5));
+            cliente.idCliente = sqlite3_column_int(statement.get(), 0);
+            clientes.push_back(std::move(cliente));
+        }
+
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al buscar clientes: " + std::string(sqlite3_errmsg(db)));
+        }
+
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        clientes.clear();
+    }
+
+    return clientes;
+}
+
 // Función que retorna la cédula del cliente
 int Cliente::getCedula() const {
     return cedula;
@@ -127,3 +265,17 @@ int Cliente::getCedula() const {
 int Cliente::getID() const {
     return idCliente;
 }
+
+// Función que retorna el nombre completo del cliente
+std::string Cliente::getNombreCompleto() const {
+    std::string nombreCompleto = nombre + " " + primerApellido;
+    if (!segundoApellido.empty()) {
+        nombreCompleto += " " + segundoApellido;
+    }
+    return nombreCompleto;
+}
+
+// Función que retorna el número de teléfono del cliente
+std::string Cliente::getTelefono() const {
+    return telefono;
+}
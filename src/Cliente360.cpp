@@ -0,0 +1,226 @@
+/**
+ * @file Cliente360.cpp
+ * @brief Implementación de la clase Cliente360 para obtener la vista completa de un cliente.
+ * @details Este archivo contiene la definición de los métodos de la clase Cliente360.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Cliente360.hpp"
+#include "SQLiteStatement.hpp"
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+// El cliente con sus cuentas; un cliente sin cuentas retorna una fila con las columnas de la cuenta nulas
+static const char* const CONSULTA_CLIENTE = R"(
+    SELECT c.idCliente, c.nombre, c.primerApellido, c.segundoApellido, c.telefono,
+           cu.idCuenta, cu.moneda, cu.saldo, cu.tasaInteres
+    FROM Clientes c LEFT JOIN Cuentas cu ON cu.idCliente = c.idCliente
+    WHERE c.cedula = ?1
+    ORDER BY cu.idCuenta;
+)";
+
+// Los CDP y préstamos de las cuentas del cliente, con una columna que indica el tipo de fila
+static const char* const CONSULTA_PRODUCTOS = R"(
+    SELECT 'CDP', idCDP, idCuenta, NULL, moneda, deposito, tasaInteres, plazoMeses,
+           NULL, NULL, NULL, NULL, NULL, NULL, NULL
+    FROM CDP
+    WHERE idCuenta IN (SELECT idCuenta FROM Cuentas WHERE idCliente = ?1)
+    UNION ALL
+    SELECT 'PRE', idPrestamo, idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses,
+           cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, activo, fechaProximoPago, diasAtraso
+    FROM Prestamos
+    WHERE idCuenta IN (SELECT idCuenta FROM Cuentas WHERE idCliente = ?1)
+    ORDER BY 1, 2;
+)";
+
+// Los movimientos más recientes: para cada cuenta se toman los últimos ?2 débitos y créditos con los
+// índices (idRemitente, fecha) e (idDestinatario, fecha), sin recorrer todo el historial
+static const char* const CONSULTA_MOVIMIENTOS = R"(
+    SELECT t.idTransaccion, t.fecha, c.idCuenta, t.tipo, t.idDestinatario, -t.monto
+    FROM Cuentas c JOIN Transacciones t ON t.idTransaccion IN (
+        SELECT x.idTransaccion FROM Transacciones x
+        WHERE x.idRemitente = c.idCuenta
+        ORDER BY x.fecha DESC LIMIT ?2)
+    WHERE c.idCliente = ?1
+    UNION ALL
+    SELECT t.idTransaccion, t.fecha, c.idCuenta, t.tipo, t.idRemitente, t.monto
+    FROM Cuentas c JOIN Transacciones t ON t.idTransaccion IN (
+        SELECT x.idTransaccion FROM Transacciones x
+        WHERE x.idDestinatario = c.idCuenta AND x.idRemitente IS NOT c.idCuenta
+        ORDER BY x.fecha DESC LIMIT ?2)
+    WHERE c.idCliente = ?1
+    ORDER BY 2 DESC, 1 DESC
+    LIMIT ?2;
+)";
+
+// Función auxiliar para leer una columna de texto que puede ser nula
+static std::string columnaTexto(sqlite3_stmt* statement, int columna) {
+    const unsigned char* texto = sqlite3_column_text(statement, columna);
+    return texto != nullptr ? std::string(reinterpret_cast<const char*>(texto)) : std::string();
+}
+
+// Función auxiliar para ejecutar una consulta y procesar cada fila
+template <typename Procesar>
+static void recorrer(sqlite3* db, sqlite3_stmt* statement, Procesar procesar) {
+    int resultado;
+    while ((resultado = sqlite3_step(statement)) == SQLITE_ROW) {
+        procesar(statement);
+    }
+    if (resultado != SQLITE_DONE) {
+        throw std::runtime_error("Error al cargar la vista del cliente: " + std::string(sqlite3_errmsg(db)));
+    }
+}
+
+
+// Definición de método estático para cargar la vista completa de un cliente
+bool Cliente360::cargar(sqlite3* db, int cedula, VistaCliente360& vista, int movimientos) {
+    vista = VistaCliente360();
+
+    // Un savepoint mantiene la misma lectura de la base de datos en las tres consultas
+    if (sqlite3_exec(db, "SAVEPOINT cliente360;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        std::cerr << "Error al iniciar la lectura: " << sqlite3_errmsg(db) << std::endl;
+        return false;
+    }
+
+    try {
+        // Cliente y cuentas
+        SQLiteStatement cliente(db, CONSULTA_CLIENTE);
+        sqlite3_bind_int(cliente.get(), 1, cedula);
+        recorrer(db, cliente.get(), [&](sqlite3_stmt* fila) {
+            if (vista.idCliente == 0) {
+                vista.idCliente = sqlite3_column_int(fila, 0);
+                vista.cedula = cedula;
+                vista.nombre = columnaTexto(fila, 1);
+                vista.primerApellido = columnaTexto(fila, 2);
+                vista.segundoApellido = columnaTexto(fila, 3);
+                vista.telefono = columnaTexto(fila, 4);
+            }
+            if (sqlite3_column_type(fila, 5) != SQLITE_NULL) {
+                vista.cuentas.push_back({sqlite3_column_int(fila, 5), monedaSegunValor(sqlite3_column_int(fila, 6)),
+                                         sqlite3_column_double(fila, 7), sqlite3_column_double(fila, 8)});
+            }
+        });
+
+        if (vista.idCliente == 0) {
+            throw std::runtime_error("Error: Cliente no encontrado con la cédula ingresada.");
+        }
+
+        // CDP y préstamos, solo si el cliente tiene cuentas
+        if (!vista.cuentas.empty()) {
+            SQLiteStatement productos(db, CONSULTA_PRODUCTOS);
+            sqlite3_bind_int(productos.get(), 1, vista.idCliente);
+            recorrer(db, productos.get(), [&](sqlite3_stmt* fila) {
+                if (columnaTexto(fila, 0) == "CDP") {
+                    vista.cdps.push_back({sqlite3_column_int(fila, 1), sqlite3_column_int(fila, 2), monedaSegunValor(sqlite3_column_int(fila, 4)),
+                                          sqlite3_column_double(fila, 5), sqlite3_column_int(fila, 7), sqlite3_column_double(fila, 6)});
+                } else {
+                    PrestamoCliente360 prestamo;
+                    prestamo.idPrestamo = sqlite3_column_int(fila, 1);
+                    prestamo.idCuenta = sqlite3_column_int(fila, 2);
+                    prestamo.tipo = tipoPrestamoSegunValor(sqlite3_column_int(fila, 3));
+                    prestamo.moneda = monedaSegunValor(sqlite3_column_int(fila, 4));
+                    prestamo.monto = sqlite3_column_double(fila, 5);
+                    prestamo.tasaInteres = sqlite3_column_double(fila, 6);
+                    prestamo.plazoMeses = sqlite3_column_int(fila, 7);
+                    prestamo.cuotaMensual = sqlite3_column_double(fila, 8);
+                    prestamo.cuotasPagadas = sqlite3_column_int(fila, 9);
+                    prestamo.capitalPagado = sqlite3_column_double(fila, 10);
+                    prestamo.interesesPagados = sqlite3_column_double(fila, 11);
+                    prestamo.activo = sqlite3_column_int(fila, 12) == 1;
+                    prestamo.fechaProximoPago = columnaTexto(fila, 13);
+                    prestamo.diasAtraso = sqlite3_column_int(fila, 14);
+                    vista.prestamos.push_back(std::move(prestamo));
+                }
+            });
+
+            // Movimientos recientes
+            if (movimientos > 0) {
+                SQLiteStatement recientes(db, CONSULTA_MOVIMIENTOS);
+                sqlite3_bind_int(recientes.get(), 1, vista.idCliente);
+                sqlite3_bind_int(recientes.get(), 2, movimientos);
+                recorrer(db, recientes.get(), [&](sqlite3_stmt* fila) {
+                    // Los depósitos y retiros no tienen contraparte: la columna nula se lee como 0
+                    vista.movimientos.push_back({sqlite3_column_int64(fila, 0), columnaTexto(fila, 1), sqlite3_column_int(fila, 2),
+                                                 tipoTransaccionSegunValor(sqlite3_column_int(fila, 3)), sqlite3_column_int(fila, 4),
+                                                 sqlite3_column_double(fila, 5)});
+                });
+            }
+        }
+
+        sqlite3_exec(db, "RELEASE cliente360;", nullptr, nullptr, nullptr);
+        return true;
+
+    } catch (const std::exception& e) {
+        sqlite3_exec(db, "ROLLBACK TO cliente360; RELEASE cliente360;", nullptr, nullptr, nullptr);
+        std::cerr << e.what() << std::endl;
+        vista = VistaCliente360();
+        return false;
+    }
+}
+
+// Definición de método estático para mostrar la vista de un cliente
+void Cliente360::mostrar(const VistaCliente360& vista) {
+    std::cout << "\n=== Cliente " << vista.cedula << ": " << vista.nombre << " " << vista.primerApellido;
+    if (!vista.segundoApellido.empty()) {
+        std::cout << " " << vista.segundoApellido;
+    }
+    std::cout << " ===" << std::endl;
+    if (!vista.telefono.empty()) {
+        std::cout << "Teléfono: " << vista.telefono << std::endl;
+    }
+
+    // Cuentas
+    std::cout << "\nCuentas:" << std::endl;
+    if (vista.cuentas.empty()) {
+        std::cout << "  (sin cuentas)" << std::endl;
+    }
+    for (const CuentaCliente360& cuenta : vista.cuentas) {
+        std::cout << "  Cuenta " << std::setw(8) << cuenta.idCuenta << "  " << codigo(cuenta.moneda)
+                  << "  Saldo: " << std::setw(16) << cuenta.saldo << "  Tasa: " << cuenta.tasaInteres << "%" << std::endl;
+    }
+
+    // CDP
+    if (!vista.cdps.empty()) {
+        std::cout << "\nCDP:" << std::endl;
+        for (const CDPCliente360& cdp : vista.cdps) {
+            std::cout << "  CDP " << std::setw(8) << cdp.idCDP << "  Cuenta " << cdp.idCuenta << "  " << codigo(cdp.moneda)
+                      << "  Depósito: " << cdp.deposito << "  Plazo: " << cdp.plazoMeses << " meses  Tasa: " << cdp.tasaInteres << "%" << std::endl;
+        }
+    }
+
+    // Préstamos
+    if (!vista.prestamos.empty()) {
+        std::cout << "\nPréstamos:" << std::endl;
+        for (const PrestamoCliente360& prestamo : vista.prestamos) {
+            std::cout << "  Préstamo " << std::setw(8) << prestamo.idPrestamo << "  " << codigo(prestamo.tipo) << "  " << codigo(prestamo.moneda)
+                      << "  Monto: " << prestamo.monto << "  Cuotas: " << prestamo.cuotasPagadas << "/" << prestamo.plazoMeses;
+            if (prestamo.activo) {
+                std::cout << "  Saldo: " << prestamo.monto - prestamo.capitalPagado << "  Próximo pago: " << prestamo.fechaProximoPago;
+                if (prestamo.diasAtraso > 0) {
+                    std::cout << "  Atraso: " << prestamo.diasAtraso << " días";
+                }
+            } else {
+                std::cout << "  (cancelado)";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    // Movimientos recientes
+    if (!vista.movimientos.empty()) {
+        std::cout << "\nMovimientos recientes:" << std::endl;
+        for (const MovimientoCliente360& movimiento : vista.movimientos) {
+            std::cout << "  " << movimiento.fecha << "  Cuenta " << std::setw(8) << movimiento.idCuenta << "  " << codigo(movimiento.tipo)
+                      << std::setw(16) << movimiento.monto;
+            if (movimiento.contraparte != 0) {
+                std::cout << "  Contraparte: " << movimiento.contraparte;
+            }
+            std::cout << std::endl;
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ * @file ColeccionesCartera.cpp
+ * @brief Implementación de las colecciones en memoria de cuentas y préstamos en formato columnar.
+ * @details Este archivo contiene la definición de los métodos de carga, búsqueda y recorrido de
+ *          ColeccionCuentas y ColeccionPrestamos.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "ColeccionesCartera.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+// Función auxiliar para obtener la cantidad de filas de una tabla y reservar las columnas
+static size_t contarFilas(sqlite3* db, const char* sql) {
+    SQLiteStatement statement(db, sql);
+    return sqlite3_step(statement.get()) == SQLITE_ROW ? static_cast<size_t>(sqlite3_column_int64(statement.get(), 0)) : 0;
+}
+
+// Función auxiliar para obtener los bytes reservados por una columna
+template <typename T>
+static size_t bytes(const std::vector<T>& columna) {
+    return columna.capacity() * sizeof(T);
+}
+
+
+// Definición de método para cargar todas las cuentas
+bool ColeccionCuentas::cargar(sqlite3* db) {
+    *this = ColeccionCuentas();
+
+    try {
+        size_t filas = contarFilas(db, "SELECT COUNT(*) FROM Cuentas;");
+        idCuenta.reserve(filas);
+        idCliente.reserve(filas);
+        moneda.reserve(filas);
+        saldo.reserve(filas);
+        tasaInteres.reserve(filas);
+
+        SQLiteStatement statement(db, "SELECT idCuenta, idCliente, moneda, saldo, tasaInteres FROM Cuentas ORDER BY idCuenta;");
+
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            idCuenta.push_back(sqlite3_column_int(statement.get(), 0));
+            idCliente.push_back(sqlite3_column_int(statement.get(), 1));
+            moneda.push_back(monedaSegunValor(sqlite3_column_int(statement.get(), 2)));
+            saldo.push_back(sqlite3_column_double(statement.get(), 3));
+            tasaInteres.push_back(sqlite3_column_double(statement.get(), 4));
+        }
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al cargar las cuentas: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        *this = ColeccionCuentas();
+        return false;
+    }
+}
+
+// Definición de método para obtener la cantidad de cuentas
+size_t ColeccionCuentas::cantidad() const {
+    return idCuenta.size();
+}
+
+// Definición de método para buscar una cuenta por su ID (las cuentas se cargan ordenadas por ID)
+size_t ColeccionCuentas::buscar(int id) const {
+    auto it = std::lower_bound(idCuenta.begin(), idCuenta.end(), id);
+    return (it != idCuenta.end() && *it == id) ? static_cast<size_t>(it - idCuenta.begin()) : cantidad();
+}
+
+// Definición de método para sumar los saldos de una moneda
+double ColeccionCuentas::saldoTotal(Moneda monedaSaldo) const {
+    // Solo se recorren las columnas de moneda y saldo
+    double total = 0.0;
+    for (size_t i = 0; i < saldo.size(); i++) {
+        total += moneda[i] == monedaSaldo ? saldo[i] : 0.0;
+    }
+    return total;
+}
+
+// Definición de método para obtener la memoria reservada por las columnas
+size_t ColeccionCuentas::memoria() const {
+    return bytes(idCuenta) + bytes(idCliente) + bytes(moneda) + bytes(saldo) + bytes(tasaInteres);
+}
+
+
+// Definición de método para cargar los préstamos
+bool ColeccionPrestamos::cargar(sqlite3* db, bool soloActivos) {
+    *this = ColeccionPrestamos();
+
+    try {
+        size_t filas = contarFilas(db, soloActivos ? "SELECT COUNT(*) FROM Prestamos WHERE activo = 1;" : "SELECT COUNT(*) FROM Prestamos;");
+        idPrestamo.reserve(filas);
+        idCuenta.reserve(filas);
+        tipo.reserve(filas);
+        moneda.reserve(filas);
+        activo.reserve(filas);
+        monto.reserve(filas);
+        tasaInteres.reserve(filas);
+        cuotaMensual.reserve(filas);
+        capitalPagado.reserve(filas);
+        interesesPagados.reserve(filas);
+        plazoMeses.reserve(filas);
+        cuotasPagadas.reserve(filas);
+        diasAtraso.reserve(filas);
+
+        SQLiteStatement statement(db, std::string(
+            "SELECT idPrestamo, idCuenta, tipo, moneda, activo, monto, tasaInteres, cuotaMensual, capitalPagado, "
+            "interesesPagados, plazoMeses, cuotasPagadas, diasAtraso FROM Prestamos ") +
+            (soloActivos ? "WHERE activo = 1 " : "") + "ORDER BY idPrestamo;");
+
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            idPrestamo.push_back(sqlite3_column_int(statement.get(), 0));
+            idCuenta.push_back(sqlite3_column_int(statement.get(), 1));
+            tipo.push_back(tipoPrestamoSegunValor(sqlite3_column_int(statement.get(), 2)));
+            moneda.push_back(monedaSegunValor(sqlite3_column_int(statement.get(), 3)));
+            activo.push_back(sqlite3_column_int(statement.get(), 4) == 1 ? 1 : 0);
+            monto.push_back(sqlite3_column_double(statement.get(), 5));
+            tasaInteres.push_back(sqlite3_column_double(statement.get(), 6));
+            cuotaMensual.push_back(sqlite3_column_double(statement.get(), 7));
+            capitalPagado.push_back(sqlite3_column_double(statement.get(), 8));
+            interesesPagados.push_back(sqlite3_column_double(statement.get(), 9));
+            plazoMeses.push_back(sqlite3_column_int(statement.get(), 10));
+            cuotasPagadas.push_back(sqlite3_column_int(statement.get(), 11));
+            diasAtraso.push_back(sqlite3_column_int(statement.get(), 12));
+        }
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al cargar los préstamos: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        *this = ColeccionPrestamos();
+        return false;
+    }
+}
+
+// Definición de método para obtener la cantidad de préstamos
+size_t ColeccionPrestamos::cantidad() const {
+    return idPrestamo.size();
+}
+
+// Definición de método para buscar un préstamo por su ID (los préstamos se cargan ordenados por ID)
+size_t ColeccionPrestamos::buscar(int id) const {
+    auto it = std::lower_bound(idPrestamo.begin(), idPrestamo.end(), id);
+    return (it != idPrestamo.end() && *it == id) ? static_cast<size_t>(it - idPrestamo.begin()) : cantidad();
+}
+
+// Definición de método para sumar el saldo pendiente de los préstamos activos de una moneda
+double ColeccionPrestamos::saldoPendiente(Moneda monedaSaldo) const {
+    double total = 0.0;
+    for (size_t i = 0; i < monto.size(); i++) {
+        total += (activo[i] && moneda[i] == monedaSaldo) ? monto[i] - capitalPagado[i] : 0.0;
+    }
+    return total;
+}
+
+// Definición de método para obtener la memoria reservada por las columnas
+size_t ColeccionPrestamos::memoria() const {
+    return bytes(idPrestamo) + bytes(idCuenta) + bytes(tipo) + bytes(moneda) + bytes(activo) + bytes(monto) +
+           bytes(tasaInteres) + bytes(cuotaMensual) + bytes(capitalPagado) + bytes(interesesPagados) +
+           bytes(plazoMeses) + bytes(cuotasPagadas) + bytes(diasAtraso);
+}
@@ -13,25 +13,29 @@
  */
 
 #include "Cuenta.hpp"
+#include "Consultas.hpp"
 #include "Transaccion.hpp"
 #include "SQLiteStatement.hpp"
+#include "FiltrosExistencia.hpp"
 #include "CDP.hpp"
+#include "Concurrencia.hpp"
+#include "CapturaSalida.hpp"
 #include <iostream>
 
 // Definición del constructor
-Cuenta::Cuenta(int idCliente, const std::string &moneda, double saldo, double tasaInteres)
-    : idCliente(idCliente), moneda(moneda), saldo(saldo), tasaInteres(tasaInteres) {}
+Cuenta::Cuenta(int idCliente, Moneda moneda, double saldo, double tasaInteres)
+    : idCliente(idCliente), saldo(saldo), tasaInteres(tasaInteres), moneda(moneda) {}
 
 // Definición de función para crear una cuenta bancaria en la base de datos
 bool Cuenta::crear(sqlite3* db) {
     // Verifica si ya existe una cuenta en la misma moneda para el cliente
     if (this->existeSegunMoneda(db)) {
-        std::cerr << "Error: Ya existe una cuenta con la moneda ingresada." << std::endl;
+        flujoErrores() << "Error: Ya existe una cuenta con la moneda ingresada." << std::endl;
         return false;
     }
 
     // Consulta SQL para insertar una nueva cuenta
-    const std::string sql = "INSERT INTO Cuentas (idCliente, moneda, saldo, tasaInteres) VALUES (?, ?, ?, ?);";
+    const std::string sql = SQL_CREAR_CUENTA;
 
     try {
         // Utiliza SQLiteStatement para manejar el ciclo de vida del statement
@@ -39,7 +43,7 @@ bool Cuenta::crear(sqlite3* db) {
 
         // Asigna los valores de la cuenta a la consulta preparada
         sqlite3_bind_int(statement.get(), 1, idCliente);
-        sqlite3_bind_text(statement.get(), 2, moneda.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, valor(moneda));
         sqlite3_bind_double(statement.get(), 3, saldo);
         sqlite3_bind_double(statement.get(), 4, tasaInteres);
 
@@ -50,13 +54,13 @@ bool Cuenta::crear(sqlite3* db) {
 
         // Obtiene el ID de la cuenta creada
         idCuenta = sqlite3_last_insert_rowid(db);
-        std::cout << "Cuenta creada con ID: " << idCuenta << std::endl;
+        flujoSalida() << "Cuenta creada con ID: " << idCuenta << std::endl;
 
         return true;
 
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
@@ -64,10 +68,10 @@ bool Cuenta::crear(sqlite3* db) {
 // Definición de función para buscar una cuenta bancaria según su identificador
 Cuenta Cuenta::obtener(sqlite3* db, int idCuenta) {
     // Prepara la consulta SQL para obtener una cuenta por ID
-    std::string sql = "SELECT idCliente, moneda, saldo, tasaInteres FROM Cuentas WHERE idCuenta = ?;";
+    std::string sql = SQL_OBTENER_CUENTA;
     
     // Inicializa una cuenta vacía en caso de que la consulta falle
-    Cuenta cuenta(0, "", 0.0, 0.0); 
+    Cuenta cuenta(0, Moneda::CRC, 0.0, 0.0); 
 
     try {
         SQLiteStatement statement(db, sql);
@@ -76,28 +80,71 @@ Cuenta Cuenta::obtener(sqlite3* db, int idCuenta) {
         sqlite3_bind_int(statement.get(), 1, idCuenta);
 
         // Ejecuta la consulta y verifica si se encuentra la cuenta
-        if (sqlite3_step(statement.get()) == SQLITE_ROW) {
+        int resultado = sqlite3_step(statement.get());
+        if (resultado == SQLITE_ROW) {
             // Asigna los valores obtenidos de la consulta a la instancia de cuenta
             cuenta.idCuenta = idCuenta;
             cuenta.idCliente = sqlite3_column_int(statement.get(), 0);
-            cuenta.moneda = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 1));
+            cuenta.moneda = monedaSegunValor(sqlite3_column_int(statement.get(), 1));
             cuenta.saldo = sqlite3_column_double(statement.get(), 2);
             cuenta.tasaInteres = sqlite3_column_double(statement.get(), 3);
-        } else {
+            cuenta.version = sqlite3_column_int(statement.get(), 4);
+        } else if (resultado == SQLITE_DONE) {
             throw std::runtime_error("Error: Cuenta no encontrada.");
+        } else {
+            // Una base de datos ocupada o un error de lectura no significan que el registro no exista
+            throw std::runtime_error("Error al consultar la cuenta: " + std::string(sqlite3_errmsg(db)));
         }
     } catch (const std::exception& e) {
         // Maneja errores y reporta mensajes en consola
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
     }
     
     return cuenta;
 }
 
+// Definición de función para obtener varias cuentas en una sola consulta
+std::vector<Cuenta> Cuenta::obtenerVarios(sqlite3* db, std::span<const int> idsCuenta) {
+    // La lista de IDs se recorre con json_each; j.key conserva el orden de la lista
+    std::string sql = SQL_OBTENER_CUENTAS;
+
+    std::vector<Cuenta> cuentas;
+
+    try {
+        SQLiteStatement statement(db, sql);
+        statement.bindLista(1, idsCuenta);
+        cuentas.reserve(idsCuenta.size());
+
+        // Asigna los valores de cada fila a una nueva cuenta
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            Cuenta& cuenta = cuentas.emplace_back(sqlite3_column_int(statement.get(), 1),
+                                                  monedaSegunValor(sqlite3_column_int(statement.get(), 2)),
+                                                  sqlite3_column_double(statement.get(), 3),
+                                                  sqlite3_column_double(statement.get(), 4));
+            cuenta.idCuenta = sqlite3_column_int(statement.get(), 0);
+            cuenta.version = sqlite3_column_int(statement.get(), 5);
+        }
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al obtener las cuentas: " + std::string(sqlite3_errmsg(db)));
+        }
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        cuentas.clear();
+    }
+
+    return cuentas;
+}
+
 // Definición de función que verifica la existencia de la cuenta
 bool Cuenta::existe(sqlite3* db, int idCuenta) {
+    // Si el filtro de Bloom descarta el ID, no es necesario consultar la base de datos
+    if (!FiltrosExistencia::puedeExistir(db, FiltroExistencia::CUENTAS, idCuenta)) {
+        return false;
+    }
+
     // Consulta SQL para verificar la existencia de la cuenta
-    const std::string sql = "SELECT COUNT(1) FROM Cuentas WHERE idCuenta = ?;";
+    const std::string sql = SQL_EXISTE_CUENTA;
 
     try {
         SQLiteStatement statement(db, sql);
@@ -114,50 +161,77 @@ bool Cuenta::existe(sqlite3* db, int idCuenta) {
 
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
 
 
 bool Cuenta::actualizarSaldo(sqlite3* db) {
-    // Consulta SQL para actualizar el saldo
-    const std::string sql = "UPDATE Cuentas SET saldo = ? WHERE idCuenta = ?;";
+    // Consulta SQL para actualizar el saldo si la versión no cambió
+    const std::string sql = SQL_ACTUALIZAR_SALDO;
 
     try {
         SQLiteStatement statement(db, sql);
 
-        // Asigna el nuevo saldo y el ID de la cuenta a actualizar
+        // Asigna el nuevo saldo, el ID de la cuenta y la versión leída
         sqlite3_bind_double(statement.get(), 1, saldo);
         sqlite3_bind_int(statement.get(), 2, idCuenta);
+        sqlite3_bind_int(statement.get(), 3, version);
 
         // Ejecuta la actualización
         if (sqlite3_step(statement.get()) != SQLITE_DONE) {
             throw std::runtime_error("Error: No se pudo ejecutar la actualización de saldo.");
         }
 
+        // Si ninguna fila cambió, otra sesión actualizó la cuenta después de leerla
+        if (sqlite3_changes(db) == 0) {
+            throw ConflictoVersion("La cuenta " + std::to_string(idCuenta) + " fue modificada por otra sesión.");
+        }
+        version++;
+
         // Actualización exitosa
-        std::cout << "Saldo actualizado correctamente para la cuenta: " << idCuenta << std::endl;
+        flujoSalida() << "Saldo actualizado correctamente para la cuenta: " << idCuenta << std::endl;
         return true;
 
+    } catch (const ConflictoVersion&) {
+        // La operación que llamó deshace la transacción y se reintenta
+        throw;
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Definición de método privado para recargar la cuenta después de un conflicto de versión
+bool Cuenta::recargar(sqlite3* db) {
+    Cuenta actual = Cuenta::obtener(db, idCuenta);
+    if (actual.idCuenta == 0) {
         return false;
     }
+
+    saldo = actual.saldo;
+    version = actual.version;
+    return true;
 }
 
 // Función para verificar si ya existe una cuenta para el cliente en la moneda especificada
 bool Cuenta::existeSegunMoneda(sqlite3* db) {
+    // Si el filtro de Bloom descarta la combinación de cliente y moneda, no es necesario consultar la base de datos
+    if (!FiltrosExistencia::puedeExistir(db, FiltroExistencia::CUENTAS_MONEDA, FiltrosExistencia::claveCuentaMoneda(idCliente, moneda))) {
+        return false;
+    }
+
     // Consulta SQL para verificar si el cliente tiene otra cuenta en la misma moneda
-    const std::string checkSQL = "SELECT COUNT(*) FROM Cuentas WHERE idCliente = ? AND moneda = ?;";
+    const std::string checkSQL = SQL_CUENTAS_SEGUN_MONEDA;
 
     try {
         SQLiteStatement statement(db, checkSQL);
 
         // Asigna el ID del cliente y la moneda a verificar
         sqlite3_bind_int(statement.get(), 1, idCliente);
-        sqlite3_bind_text(statement.get(), 2, moneda.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, valor(moneda));
 
         // Ejecuta la consulta y verifica si existe una cuenta en la misma moneda
         if (sqlite3_step(statement.get()) == SQLITE_ROW) {
@@ -168,7 +242,7 @@ bool Cuenta::existeSegunMoneda(sqlite3* db) {
 
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
@@ -188,156 +262,196 @@ int Cuenta::getIDCliente() const {
     return idCliente;
 }
 
-std::string Cuenta::getMoneda() const {
+// Método para obtener la moneda de la cuenta
+Moneda Cuenta::getMoneda() const {
     return moneda;
 }
 
 
 // Método para realizar un depósito a la cuenta
 bool Cuenta::depositar(sqlite3* db, double monto) {
-    try {
-        // Comenzar una transacción
-        if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("Error: No se pudo iniciar la transacción.");
-        }
+    for (int intento = 1; ; intento++) {
+        const int versionAnterior = version;
 
-        // Aumentar el saldo en la instancia
-        saldo += monto;
+        try {
+            // Comenzar una transacción
+            if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                throw std::runtime_error("Error: No se pudo iniciar la transacción.");
+            }
 
-        // Actualizar el saldo en la base de datos
-        if (!actualizarSaldo(db)) {
-            saldo -= monto; // Revertir el saldo en la instancia
-            throw std::runtime_error("Error: No se pudo actualizar el saldo en la base de datos.");
-        }
+            // Aumentar el saldo en la instancia
+            saldo += monto;
 
-        // Registrar la transacción como depósito
-        if (!crearTransaccion(db, -1, idCuenta, "DEP", monto)) {
-            saldo -= monto; // Revertir el saldo en la instancia
-            throw std::runtime_error("Error: No se pudo registrar la transacción de depósito.");
-        }
+            // Actualizar el saldo en la base de datos
+            if (!actualizarSaldo(db)) {
+                saldo -= monto; // Revertir el saldo en la instancia
+                throw std::runtime_error("Error: No se pudo actualizar el saldo en la base de datos.");
+            }
 
-        // Confirmar la transacción
-        if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            saldo -= monto; // Revertir el saldo en la instancia
-            throw std::runtime_error("Error: No se pudo confirmar la transacción.");
-        }
+            // Registrar la transacción como depósito
+            if (!crearTransaccion(db, -1, idCuenta, TipoTransaccion::DEPOSITO, monto)) {
+                saldo -= monto; // Revertir el saldo en la instancia
+                throw std::runtime_error("Error: No se pudo registrar la transacción de depósito.");
+            }
 
-        return true; // Depósito exitoso
+            // Confirmar la transacción
+            if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                saldo -= monto; // Revertir el saldo en la instancia
+                throw std::runtime_error("Error: No se pudo confirmar la transacción.");
+            }
 
-    } catch (const std::exception& e) {
-        // Realizar rollback en caso de error
-        std::cerr << e.what() << std::endl;
-        if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            std::cerr << "Error: No se pudo realizar el rollback." << std::endl;
+            return true; // Depósito exitoso
+
+        } catch (const ConflictoVersion& e) {
+            // Otra sesión modificó la cuenta: recargarla y reintentar sobre el saldo actual
+            bool reintentar = reintentarConflicto(db, e, intento);
+            if (!recargar(db) || !reintentar) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            // Realizar rollback en caso de error
+            flujoErrores() << e.what() << std::endl;
+            if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                flujoErrores() << "Error: No se pudo realizar el rollback." << std::endl;
+            }
+            version = versionAnterior; // La actualización deshecha no incrementó la versión en la base de datos
+            return false; // Depósito fallido
         }
-        return false; // Depósito fallido
     }
 }
 
 
 // Método para retirar fondos de la cuenta
 bool Cuenta::retirar(sqlite3* db, double monto) {
-    try {
-        // Comenzar una transacción
-        if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("Error: No se pudo iniciar la transacción.");
-        }
+    for (int intento = 1; ; intento++) {
+        const int versionAnterior = version;
 
-        // Verificar si hay fondos suficientes
-        if (!verificarFondos(monto)) {
-            throw std::runtime_error("Error: Fondos insuficientes para retiro.");
-        }
+        try {
+            // Comenzar una transacción
+            if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                throw std::runtime_error("Error: No se pudo iniciar la transacción.");
+            }
 
-        // Reducir saldo en la instancia
-        saldo -= monto;
+            // Verificar si hay fondos suficientes
+            if (!verificarFondos(monto)) {
+                throw std::runtime_error("Error: Fondos insuficientes para retiro.");
+            }
 
-        // Actualizar el saldo en la base de datos
-        if (!actualizarSaldo(db)) {
-            saldo += monto; // Revertir el saldo en la instancia
-            throw std::runtime_error("Error: No se pudo actualizar el saldo en la base de datos.");
-        }
+            // Reducir saldo en la instancia
+            saldo -= monto;
 
-        // Registrar la transacción como retiro
-        if (!crearTransaccion(db, idCuenta, -1, "RET", monto)) {
-            saldo += monto; // Revertir el saldo en la instancia
-            throw std::runtime_error("Error: No se pudo registrar la transacción de retiro.");
-        }
+            // Actualizar el saldo en la base de datos
+            if (!actualizarSaldo(db)) {
+                saldo += monto; // Revertir el saldo en la instancia
+                throw std::runtime_error("Error: No se pudo actualizar el saldo en la base de datos.");
+            }
 
-        // Confirmar la transacción
-        if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            saldo += monto; // Revertir el saldo en la instancia
-            throw std::runtime_error("Error: No se pudo confirmar la transacción.");
-        }
+            // Registrar la transacción como retiro
+            if (!crearTransaccion(db, idCuenta, -1, TipoTransaccion::RETIRO, monto)) {
+                saldo += monto; // Revertir el saldo en la instancia
+                throw std::runtime_error("Error: No se pudo registrar la transacción de retiro.");
+            }
 
-        return true; // Retiro exitoso
-        
-    } catch (const std::exception& e) {
-        // Realizar rollback en caso de error
-        std::cerr << e.what() << std::endl;
-        if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            std::cerr << "Error: No se pudo realizar el rollback." << std::endl;
+            // Confirmar la transacción
+            if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                saldo += monto; // Revertir el saldo en la instancia
+                throw std::runtime_error("Error: No se pudo confirmar la transacción.");
+            }
+
+            return true; // Retiro exitoso
+
+        } catch (const ConflictoVersion& e) {
+            // Otra sesión modificó la cuenta: los fondos se verifican de nuevo con el saldo actual
+            bool reintentar = reintentarConflicto(db, e, intento);
+            if (!recargar(db) || !reintentar) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            // Realizar rollback en caso de error
+            flujoErrores() << e.what() << std::endl;
+            if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                flujoErrores() << "Error: No se pudo realizar el rollback." << std::endl;
+            }
+            version = versionAnterior; // La actualización deshecha no incrementó la versión en la base de datos
+            return false; // Retiro fallido
         }
-        return false; // Retiro fallido
     }
 }
 
 
 // Método para transferir fondos desde la instancia de Cuenta a otra
 bool Cuenta::transferir(sqlite3* db, int idCuentaDestino, double monto) {
-    int saldoOriginal = saldo;
-    
-    try {
-        // Verificar fondos de la cuenta actual
-        if (!verificarFondos(monto)) {
-            throw std::runtime_error("Error: Fondos insuficientes para transferencia.");
-        }
+    // Con la misma cuenta, la primera actualización cambia la versión que leyó la cuenta destino
+    if (idCuentaDestino == idCuenta) {
+        flujoErrores() << "Error: La cuenta destino debe ser distinta de la cuenta de origen." << std::endl;
+        return false;
+    }
 
-        // Obtener cuenta destino
-        Cuenta cuentaDestino = Cuenta::obtener(db, idCuentaDestino);
-        if (cuentaDestino.getID() == 0) {
-            throw std::runtime_error("Error: No se pudo encontrar la cuenta destino.");
-        }
+    for (int intento = 1; ; intento++) {
+        double saldoOriginal = saldo;
+        const int versionAnterior = version;
 
-        // Iniciar transacción SQL
-        if (sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("Error: No se pudo iniciar la transacción.");
-        }
+        try {
+            // Verificar fondos de la cuenta actual
+            if (!verificarFondos(monto)) {
+                throw std::runtime_error("Error: Fondos insuficientes para transferencia.");
+            }
 
-        // Reducir saldo en la cuenta de origen
-        saldo -= monto;
-        if (!actualizarSaldo(db)) {
-            throw std::runtime_error("Error: No se pudo actualizar el saldo de la cuenta remitente.");
-        }
+            // Obtener cuenta destino, leída de nuevo en cada intento
+            Cuenta cuentaDestino = Cuenta::obtener(db, idCuentaDestino);
+            if (cuentaDestino.getID() == 0) {
+                throw std::runtime_error("Error: No se pudo encontrar la cuenta destino.");
+            }
 
-        // Aumentar saldo en la cuenta destino
-        cuentaDestino.saldo += monto;
-        if (!cuentaDestino.actualizarSaldo(db)) {
-            throw std::runtime_error("Error: No se pudo actualizar el saldo de la cuenta destino.");
-        }
+            // Iniciar transacción SQL
+            if (sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                throw std::runtime_error("Error: No se pudo iniciar la transacción.");
+            }
 
-        // Registrar la transacción
-        if (!crearTransaccion(db, idCuenta, idCuentaDestino, "TRA", monto)) {
-            throw std::runtime_error("Error: No se pudo registrar la transacción.");
-        }
+            // Reducir saldo en la cuenta de origen
+            saldo -= monto;
+            if (!actualizarSaldo(db)) {
+                throw std::runtime_error("Error: No se pudo actualizar el saldo de la cuenta remitente.");
+            }
 
-        // Confirmar transacción SQL
-        if (sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("Error: No se pudo confirmar la transacción.");
-        }
+            // Aumentar saldo en la cuenta destino
+            cuentaDestino.saldo += monto;
+            if (!cuentaDestino.actualizarSaldo(db)) {
+                throw std::runtime_error("Error: No se pudo actualizar el saldo de la cuenta destino.");
+            }
 
-        return true; // Transferencia exitosa
+            // Registrar la transacción
+            if (!crearTransaccion(db, idCuenta, idCuentaDestino, TipoTransaccion::TRANSFERENCIA, monto)) {
+                throw std::runtime_error("Error: No se pudo registrar la transacción.");
+            }
 
-    } catch (const std::exception& e) {
-        // Manejo de errores
-        std::cerr << e.what() << std::endl;
+            // Confirmar transacción SQL
+            if (sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                throw std::runtime_error("Error: No se pudo confirmar la transacción.");
+            }
+
+            return true; // Transferencia exitosa
+
+        } catch (const ConflictoVersion& e) {
+            // Otra sesión modificó alguna de las cuentas: la versión de la cuenta de origen pudo haber
+            // avanzado en la transacción deshecha, por lo que se recarga junto con el saldo
+            bool reintentar = reintentarConflicto(db, e, intento);
+            if (!recargar(db) || !reintentar) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            // Manejo de errores
+            flujoErrores() << e.what() << std::endl;
 
-        // Revertir transacción SQL en caso de fallo
-        sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+            // Revertir transacción SQL en caso de fallo
+            sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
 
-        // Revertir saldo en el objeto
-        saldo = saldoOriginal;
+            // Revertir saldo y versión en el objeto
+            saldo = saldoOriginal;
+            version = versionAnterior;
 
-        return false; // Transferencia fallida
+            return false; // Transferencia fallida
+        }
     }
 }
 
@@ -354,29 +468,26 @@ bool Cuenta::abonarPrestamo(sqlite3* db, double monto) {
         saldo -= monto;
 
         // Registrar la transacción de tipo "ABO"
-        Transaccion transaccion(idCuenta, -1, "ABO", monto);
+        Transaccion transaccion(idCuenta, -1, TipoTransaccion::ABONO, monto);
         if (!transaccion.procesar(db)) {
             saldo += monto; // Revertir el saldo
             throw std::runtime_error("Error: No se pudo procesar la transacción de abono.");
         }
 
         // Actualizar el saldo en la base de datos
-        const std::string sql = "UPDATE Cuentas SET saldo = ? WHERE idCuenta = ?;";
-        SQLiteStatement statement(db, sql);
-
-        sqlite3_bind_double(statement.get(), 1, saldo);
-        sqlite3_bind_int(statement.get(), 2, idCuenta);
-
-        if (sqlite3_step(statement.get()) != SQLITE_DONE) {
+        if (!actualizarSaldo(db)) {
             saldo += monto; // Revertir el saldo en memoria
             throw std::runtime_error("Error: No se pudo actualizar el saldo en la base de datos.");
         }
 
         return true; // Abono exitoso
 
+    } catch (const ConflictoVersion&) {
+        // El abono del préstamo deshace su transacción, recarga la cuenta y se reintenta
+        throw;
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
 
         return false; // Abono fallido
     }
@@ -384,65 +495,68 @@ bool Cuenta::abonarPrestamo(sqlite3* db, double monto) {
 
 
 // Método para solicitar un CDP
-bool Cuenta::solicitarCDP(sqlite3* db, std::string &moneda, double monto, int plazoMeses, double tasaInteres) {
-    try {
-        // Iniciar transacción
-        if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("Error: No se pudo iniciar la transacción.");
-        }
+bool Cuenta::solicitarCDP(sqlite3* db, Moneda moneda, double monto, int plazoMeses, double tasaInteres) {
+    for (int intento = 1; ; intento++) {
+        const int versionAnterior = version;
+
+        try {
+            // Iniciar transacción
+            if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                throw std::runtime_error("Error: No se pudo iniciar la transacción.");
+            }
 
-        // Verificar fondos suficientes
-        if (!verificarFondos(monto)) {
-            throw std::runtime_error("Error: Fondos insuficientes para solicitar el CDP.");
-        }
+            // Verificar fondos suficientes
+            if (!verificarFondos(monto)) {
+                throw std::runtime_error("Error: Fondos insuficientes para solicitar el CDP.");
+            }
 
-        // Reducir el saldo de la cuenta en el objeto de Cuenta
-        saldo -= monto;
+            // Reducir el saldo de la cuenta en el objeto de Cuenta
+            saldo -= monto;
 
-        // Actualizar el saldo en la base de datos
-        std::string actualizarSaldoSQL = "UPDATE Cuentas SET saldo = ? WHERE idCuenta = ?;";
-        {
-            // Bloque de código para liberar el statement cuando salga
-            SQLiteStatement statement(db, actualizarSaldoSQL);
-            sqlite3_bind_double(statement.get(), 1, saldo);
-            sqlite3_bind_int(statement.get(), 2, idCuenta);
-
-            if (sqlite3_step(statement.get()) != SQLITE_DONE) {
+            // Actualizar el saldo en la base de datos
+            if (!actualizarSaldo(db)) {
                 saldo += monto; // Reintegrar los fondos al saldo de la cuenta
                 throw std::runtime_error("Error: No se pudo actualizar el saldo en la base de datos.");
             }
-        }
 
-        // Crear el CDP en la base de datos
-        CDP cdp(idCuenta, moneda, monto, plazoMeses, tasaInteres);
-        if (!cdp.crear(db)) {
-            saldo += monto; // Reintegrar los fondos al saldo de la cuenta
-            throw std::runtime_error("Error: No se pudo crear el CDP en la base de datos.");
-        }
+            // Crear el CDP en la base de datos
+            CDP cdp(idCuenta, moneda, monto, plazoMeses, tasaInteres);
+            if (!cdp.crear(db)) {
+                saldo += monto; // Reintegrar los fondos al saldo de la cuenta
+                throw std::runtime_error("Error: No se pudo crear el CDP en la base de datos.");
+            }
 
-        // Registrar la transacción del CDP
-        Transaccion transaccion(idCuenta, -1, "CDP", monto);
-        if (!transaccion.procesar(db)) {
-            saldo += monto; // Reintegrar los fondos al saldo de la cuenta
-            throw std::runtime_error("Error: No se pudo registrar la transacción del CDP.");
-        }
+            // Registrar la transacción del CDP
+            Transaccion transaccion(idCuenta, -1, TipoTransaccion::CDP, monto);
+            if (!transaccion.procesar(db)) {
+                saldo += monto; // Reintegrar los fondos al saldo de la cuenta
+                throw std::runtime_error("Error: No se pudo registrar la transacción del CDP.");
+            }
 
-        // Confirmar transacción
-        if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            saldo += monto; // Reintegrar los fondos al saldo de la cuenta
-            throw std::runtime_error("Error: No se pudo confirmar la transacción.");
-        }
-        
-        return true; // Abono exitoso
+            // Confirmar transacción
+            if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                saldo += monto; // Reintegrar los fondos al saldo de la cuenta
+                throw std::runtime_error("Error: No se pudo confirmar la transacción.");
+            }
 
-    } catch (const std::exception& e) {
-        // Realizar rollback en caso de error
-        std::cerr << e.what() << std::endl;
-        if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            std::cerr << "Error: No se pudo realizar el rollback." << std::endl;
-        }
+            return true; // Abono exitoso
 
-        return false; // Abono fallido
+        } catch (const ConflictoVersion& e) {
+            // Otra sesión modificó la cuenta: los fondos se verifican de nuevo con el saldo actual
+            bool reintentar = reintentarConflicto(db, e, intento);
+            if (!recargar(db) || !reintentar) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            // Realizar rollback en caso de error
+            flujoErrores() << e.what() << std::endl;
+            if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                flujoErrores() << "Error: No se pudo realizar el rollback." << std::endl;
+            }
+            version = versionAnterior; // La actualización deshecha no incrementó la versión en la base de datos
+
+            return false; // Abono fallido
+        }
     }
 }
 
@@ -450,14 +564,14 @@ bool Cuenta::solicitarCDP(sqlite3* db, std::string &moneda, double monto, int pl
 // Método para verificar la compatibilidad de moneda para transferencias entre cuentas
 bool Cuenta::verificarCompatibilidadMoneda(sqlite3* db, int idCuentaDestino) const {
     // Consulta SQL para verificar si la cuenta destino tiene la misma moneda
-    const std::string checkSQL = "SELECT COUNT(*) FROM Cuentas WHERE idCuenta = ? AND moneda = ?;";
+    const std::string checkSQL = SQL_COMPATIBILIDAD_MONEDA;
 
     try {
         SQLiteStatement statement(db, checkSQL);
 
         // Asigna el ID de la cuenta destino y la moneda a verificar
         sqlite3_bind_int(statement.get(), 1, idCuentaDestino);
-        sqlite3_bind_text(statement.get(), 2, moneda.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, valor(moneda));
 
         // Ejecuta la consulta y verifica si existe compatibilidad de moneda
         if (sqlite3_step(statement.get()) == SQLITE_ROW) {
@@ -468,7 +582,7 @@ bool Cuenta::verificarCompatibilidadMoneda(sqlite3* db, int idCuentaDestino) con
 
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
@@ -480,7 +594,7 @@ bool Cuenta::verificarFondos(double monto) const {
 
 
 // Método para crear una transacción a partir de un movimiento ingresado
-bool Cuenta::crearTransaccion(sqlite3* db, int idRemitente, int idDestinatario, const std::string& tipo, double monto) {
+bool Cuenta::crearTransaccion(sqlite3* db, int idRemitente, int idDestinatario, TipoTransaccion tipo, double monto) {
     // Crea una nueva instancia de Transaccion con los detalles
     Transaccion transaccion(idRemitente, idDestinatario, tipo, monto);
     
@@ -492,7 +606,7 @@ bool Cuenta::crearTransaccion(sqlite3* db, int idRemitente, int idDestinatario,
 // Método para consultar el historial de movimientos de la cuenta
 void Cuenta::consultarHistorial(sqlite3* db) const {
     // Consulta SQL para obtener el historial de transacciones
-    const std::string sql = "SELECT * FROM Transacciones WHERE idRemitente = ? OR idDestinatario = ?;";
+    const std::string sql = SQL_HISTORIAL_CUENTA;
 
     try {
         // Utiliza SQLiteStatement para manejar el ciclo de vida del statement
@@ -502,7 +616,7 @@ void Cuenta::consultarHistorial(sqlite3* db) const {
         sqlite3_bind_int(statement.get(), 1, idCuenta);
         sqlite3_bind_int(statement.get(), 2, idCuenta);
 
-        std::cout << "----- Historial de transacciones de la cuenta -----" << std::endl;
+        flujoSalida() << "----- Historial de transacciones de la cuenta -----" << std::endl;
 
         // Itera sobre los resultados de la consulta y muestra cada transacción
         while (sqlite3_step(statement.get()) == SQLITE_ROW) {
@@ -510,17 +624,18 @@ void Cuenta::consultarHistorial(sqlite3* db) const {
             int idTransaccion = sqlite3_column_int(statement.get(), 0);
             int remitente = sqlite3_column_int(statement.get(), 1);
             int destinatario = sqlite3_column_int(statement.get(), 2);
-            const char* tipo = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 3));
+            const char* tipo = codigo(tipoTransaccionSegunValor(sqlite3_column_int(statement.get(), 3)));
             double monto = sqlite3_column_double(statement.get(), 4);
 
             // Imprime los detalles de la transacción en la consola
-            std::cout << "ID: " << idTransaccion << " Remitente: " << remitente
+            flujoSalida() << "ID: " << idTransaccion << " Remitente: " << remitente
                       << " Destinatario: " << destinatario << " Tipo: " << tipo
-                      << " Monto: " << monto << std::endl;
+                      << " Monto: " << monto << '\n';
         }
+        flujoSalida().flush();
 
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
     }
 }
\ No newline at end of file
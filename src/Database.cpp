@@ -11,22 +11,54 @@
  */
 
 #include "Database.hpp"
+#include "EsquemaBD.hpp"
+#include "FiltrosExistencia.hpp"
+#include "SQLiteStatement.hpp"
 #include <iostream>
+#include <stdexcept>
+
+// Función auxiliar para obtener el primer valor entero de una consulta
+static int consultarEntero(sqlite3* db, const char* sql) {
+    SQLiteStatement statement(db, sql);
+    return sqlite3_step(statement.get()) == SQLITE_ROW ? sqlite3_column_int(statement.get(), 0) : 0;
+}
 
 // Definición del constructor de la clase Database
-Database::Database(const std::string &nombreDB) {
+Database::Database(const std::string &nombreDB, bool soloLectura) {
     // Abrir la base de datos a partir de su nombre
-    if (sqlite3_open(nombreDB.c_str(), &db) != SQLITE_OK) {
+    int flags = soloLectura ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+    if (sqlite3_open_v2(nombreDB.c_str(), &db, flags, nullptr) != SQLITE_OK) {
         std::string error = "Error al abrir la base de datos: " + std::string(sqlite3_errmsg(db));
         sqlite3_close(db);  // Asegurarse de liberar recursos
         throw std::runtime_error(error);
     }
+
+    // Varias sesiones comparten el archivo: esperar a que se libere antes de reportar SQLITE_BUSY
+    sqlite3_busy_timeout(db, ESPERA_OCUPADA_DB_MS);
+
+    // Una base de datos vacía se acepta (la crea inicio_db); una con tablas debe tener el esquema actual
+    int version = VERSION_ESQUEMA;
+    int tablas = 0;
+    try {
+        version = consultarEntero(db, "PRAGMA user_version;");
+        tablas = consultarEntero(db, "SELECT COUNT(*) FROM sqlite_schema;");
+    } catch (const std::exception&) {
+        sqlite3_close(db);
+        throw;
+    }
+
+    if (tablas > 0 && version != VERSION_ESQUEMA) {
+        sqlite3_close(db);
+        throw std::runtime_error("La base de datos " + nombreDB + " no está en la versión " + std::to_string(VERSION_ESQUEMA) +
+                                 " del esquema. Ejecute migrar_db para actualizarla.");
+    }
 }
 
 // Definición de destructor de la clase Database
 Database::~Database() {
-    // Cerrar la base de datos
+    // Cerrar la base de datos, guardando antes los filtros de existencia si están activos
     if (db) {
+        FiltrosExistencia::desactivar(db);
         sqlite3_close(db);
     }
 }
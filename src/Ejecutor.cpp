@@ -0,0 +1,163 @@
+/**
+ * @file Ejecutor.cpp
+ * @brief Implementación de las clases Ejecutor y PoolTrabajo para ejecutar corrutinas.
+ * @details Este archivo contiene la definición de los métodos de Ejecutor, que reanuda las corrutinas
+ *          listas, y de PoolTrabajo, que atiende los trabajos con sus propios hilos y conexiones.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Ejecutor.hpp"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+/// @brief Tiempo máximo de espera de cada conexión a la base de datos cuando está ocupada (ms).
+constexpr int ESPERA_OCUPADA_MS = 5000;
+
+/**
+ * @class TareaLanzada
+ * @brief Corrutina sin dueño que espera una Tarea y libera su marco al terminar.
+ */
+class TareaLanzada {
+    public:
+        struct promise_type {
+            TareaLanzada get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept {
+                try {
+                    throw;
+                } catch (const std::exception& e) {
+                    std::clog << "Error en una tarea lanzada: " << e.what() << std::endl;
+                } catch (...) {
+                    std::clog << "Error desconocido en una tarea lanzada." << std::endl;
+                }
+            }
+        };
+};
+
+// Corrutina que mantiene viva la tarea mientras se ejecuta
+static TareaLanzada envolver(Tarea<void> tarea) {
+    co_await tarea;
+}
+
+
+// Definición del constructor de la clase Ejecutor
+Ejecutor::Ejecutor(std::function<void()> despertar) : despertar(std::move(despertar)) {}
+
+// Definición de método para programar una corrutina
+void Ejecutor::programar(std::coroutine_handle<> corrutina) {
+    bool avisar;
+    {
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        avisar = listas.empty(); // Un solo aviso por grupo de corrutinas listas
+        listas.push_back(corrutina);
+    }
+
+    if (avisar && despertar) {
+        despertar();
+    }
+}
+
+// Definición de método para reanudar las corrutinas listas
+size_t Ejecutor::ejecutarListas() {
+    std::vector<std::coroutine_handle<>> lote;
+    size_t reanudadas = 0;
+
+    while (true) {
+        {
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            if (listas.empty()) break;
+            lote.swap(listas);
+        }
+
+        for (std::coroutine_handle<> corrutina : lote) {
+            corrutina.resume();
+        }
+        reanudadas += lote.size();
+        lote.clear();
+    }
+
+    return reanudadas;
+}
+
+// Definición de método para iniciar una tarea sin esperar su resultado
+void Ejecutor::lanzar(Tarea<void> tarea) {
+    envolver(std::move(tarea));
+}
+
+
+// Definición del constructor de la clase PoolTrabajo
+PoolTrabajo::PoolTrabajo(Ejecutor& ejecutor, const std::string& nombreDB, unsigned int cantidadHilos, bool soloLectura)
+    : ejecutor(ejecutor) {
+
+    for (unsigned int i = 0; i < std::max(1u, cantidadHilos); i++) {
+        conexiones.push_back(std::make_unique<Database>(nombreDB));
+        sqlite3* db = conexiones.back()->get();
+        sqlite3_busy_timeout(db, ESPERA_OCUPADA_MS);
+
+        // Modo WAL para que las lecturas no se bloqueen durante las escrituras
+        const char* configuracion = soloLectura ? "PRAGMA query_only = 1;" : "PRAGMA journal_mode = WAL;";
+        if (sqlite3_exec(db, configuracion, nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error al configurar la conexión: " + std::string(sqlite3_errmsg(db)));
+        }
+    }
+
+    for (const std::unique_ptr<Database>& conexion : conexiones) {
+        hilos.emplace_back(&PoolTrabajo::trabajar, this, conexion->get());
+    }
+}
+
+// Definición del destructor de la clase PoolTrabajo
+PoolTrabajo::~PoolTrabajo() {
+    cerrar();
+}
+
+// Definición de método para agregar un trabajo a la cola
+bool PoolTrabajo::enviar(std::function<void(sqlite3*)> trabajo) {
+    std::lock_guard<std::mutex> bloqueo(mutex);
+    if (cerrado) {
+        return false;
+    }
+
+    trabajos.push_back(std::move(trabajo));
+    condicion.notify_one();
+    return true;
+}
+
+// Definición de método para cerrar el pool
+void PoolTrabajo::cerrar() {
+    {
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        cerrado = true;
+    }
+    condicion.notify_all();
+
+    for (std::thread& hilo : hilos) {
+        hilo.join();
+    }
+    hilos.clear();
+}
+
+// Definición de método para el ciclo de cada hilo del pool
+void PoolTrabajo::trabajar(sqlite3* db) {
+    while (true) {
+        std::function<void(sqlite3*)> trabajo;
+        {
+            std::unique_lock<std::mutex> bloqueo(mutex);
+            condicion.wait(bloqueo, [this] { return cerrado || !trabajos.empty(); });
+            if (trabajos.empty()) {
+                return; // Pool cerrado y sin trabajos pendientes
+            }
+            trabajo = std::move(trabajos.front());
+            trabajos.pop_front();
+        }
+
+        trabajo(db);
+    }
+}
@@ -0,0 +1,128 @@
+/**
+ * @file EscritorCSV.cpp
+ * @brief Implementación de la clase EscritorCSV para escribir archivos `.csv` grandes.
+ * @details Este archivo contiene la definición de los métodos de la clase EscritorCSV.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "EscritorCSV.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+/// @brief Espacio suficiente para cualquier número con formato.
+constexpr size_t MAXIMO_NUMERO = 352;
+
+
+// Definición del constructor de la clase EscritorCSV
+EscritorCSV::EscritorCSV(const std::string& nombreArchivo, size_t capacidad)
+    : archivo(std::fopen(nombreArchivo.c_str(), "wb")),
+      buffer(new char[std::max(capacidad, MAXIMO_NUMERO)]),
+      capacidad(std::max(capacidad, MAXIMO_NUMERO)) {
+
+    if (archivo != nullptr) {
+        std::setvbuf(archivo, nullptr, _IONBF, 0); // El buffer propio reemplaza al de la biblioteca
+    }
+}
+
+// Definición del destructor de la clase EscritorCSV
+EscritorCSV::~EscritorCSV() {
+    cerrar();
+}
+
+
+bool EscritorCSV::abierto() const {
+    return archivo != nullptr;
+}
+
+// Definición de método privado para escribir el contenido del buffer en el archivo
+void EscritorCSV::vaciar() {
+    if (usado > 0 && archivo != nullptr && std::fwrite(buffer.get(), 1, usado, archivo) != usado) {
+        error = true;
+    }
+    usado = 0;
+}
+
+
+// Definición de método para agregar un campo entero
+void EscritorCSV::campo(long long valor) {
+    reservar(MAXIMO_NUMERO);
+    separador();
+    usado = std::to_chars(buffer.get() + usado, buffer.get() + capacidad, valor).ptr - buffer.get();
+}
+
+// Definición de método para agregar un campo decimal
+void EscritorCSV::campo(double valor, int decimales) {
+    reservar(MAXIMO_NUMERO);
+    separador();
+    std::to_chars_result resultado = std::to_chars(buffer.get() + usado, buffer.get() + capacidad,
+                                                   valor, std::chars_format::fixed, decimales);
+    if (resultado.ec == std::errc()) {
+        usado = resultado.ptr - buffer.get();
+    } else {
+        error = true;
+    }
+}
+
+// Definición de método para agregar un campo de texto
+void EscritorCSV::campo(std::string_view texto) {
+    reservar(1);
+    separador();
+
+    if (texto.find_first_of(",\"\r\n") == std::string_view::npos) {
+        // Texto sin caracteres especiales: copia directa o escritura sin pasar por el buffer
+        if (texto.size() > capacidad) {
+            vaciar();
+            if (archivo != nullptr && std::fwrite(texto.data(), 1, texto.size(), archivo) != texto.size()) {
+                error = true;
+            }
+            return;
+        }
+        reservar(texto.size());
+        std::memcpy(buffer.get() + usado, texto.data(), texto.size());
+        usado += texto.size();
+        return;
+    }
+
+    // Texto entre comillas, duplicando las comillas internas
+    reservar(1);
+    buffer[usado++] = '"';
+    for (char caracter : texto) {
+        reservar(2);
+        if (caracter == '"') buffer[usado++] = '"';
+        buffer[usado++] = caracter;
+    }
+    reservar(1);
+    buffer[usado++] = '"';
+}
+
+// Definición de método para agregar un campo vacío
+void EscritorCSV::campoVacio() {
+    reservar(1);
+    separador();
+}
+
+// Definición de método para terminar la fila actual
+void EscritorCSV::finFila() {
+    reservar(1);
+    buffer[usado++] = '\n';
+    inicioFila = true;
+}
+
+// Definición de método para escribir lo pendiente y cerrar el archivo
+bool EscritorCSV::cerrar() {
+    if (archivo == nullptr) {
+        return false;
+    }
+
+    vaciar();
+    if (std::fclose(archivo) != 0) {
+        error = true;
+    }
+    archivo = nullptr;
+    return !error;
+}
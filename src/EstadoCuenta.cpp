@@ -0,0 +1,116 @@
+/**
+ * @file EstadoCuenta.cpp
+ * @brief Implementación de la clase EstadoCuenta para exportar el estado de cuenta a un archivo `.csv`.
+ * @details Este archivo contiene la definición del método que recorre los movimientos de una cuenta y
+ *          los escribe en un archivo `.csv` a medida que se obtienen de la consulta.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "EstadoCuenta.hpp"
+#include "Codigos.hpp"
+#include "Consultas.hpp"
+#include "EscritorCSV.hpp"
+#include "SQLiteStatement.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+// Función auxiliar para leer una columna de texto sin copiarla
+static std::string_view columnaTexto(sqlite3_stmt* statement, int columna) {
+    const char* texto = reinterpret_cast<const char*>(sqlite3_column_text(statement, columna));
+    return texto != nullptr ? std::string_view(texto, sqlite3_column_bytes(statement, columna)) : std::string_view();
+}
+
+
+// Movimientos como remitente y como destinatario, cada uno en orden por su índice (cuenta, fecha)
+const char* const EstadoCuenta::CONSULTA_MOVIMIENTOS = SQL_MOVIMIENTOS_CUENTA;
+
+
+// Definición de método estático para exportar los movimientos de una cuenta
+long long EstadoCuenta::exportarCSV(sqlite3* db, int idCuenta, const std::string& nombreArchivo,
+                                    const std::string& desde, const std::string& hasta) {
+    try {
+        SQLiteStatement statement(db, CONSULTA_MOVIMIENTOS);
+        return exportarCSV(statement.get(), idCuenta, nombreArchivo, desde, hasta);
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+}
+
+// Definición de método estático para exportar los movimientos de una cuenta con una consulta preparada
+long long EstadoCuenta::exportarCSV(sqlite3_stmt* consulta, int idCuenta, const std::string& nombreArchivo,
+                                    const std::string& desde, const std::string& hasta) {
+    // Límites del rango: la fecha final incluye todo el día indicado
+    std::string limiteInferior = desde;
+    std::string limiteSuperior = hasta.empty() ? "9999-12-31" : hasta;
+    limiteSuperior += "\x7f"; // Mayor que cualquier hora del mismo día ("YYYY-MM-DD HH:MM:SS")
+
+    sqlite3_bind_int(consulta, 1, idCuenta);
+    sqlite3_bind_text(consulta, 2, limiteInferior.c_str(), -1, SQLITE_STATIC);
+    sqlite3_bind_text(consulta, 3, limiteSuperior.c_str(), -1, SQLITE_STATIC);
+
+    long long movimientos = 0;
+
+    try {
+        EscritorCSV escritor(nombreArchivo);
+        if (!escritor.abierto()) {
+            throw std::runtime_error("Error: No se pudo abrir el archivo " + nombreArchivo + " para guardar el estado de cuenta.");
+        }
+
+        escritor.campo(std::string_view("Fecha"));
+        escritor.campo(std::string_view("ID Transaccion"));
+        escritor.campo(std::string_view("Tipo"));
+        escritor.campo(std::string_view("Contraparte"));
+        escritor.campo(std::string_view("Debito"));
+        escritor.campo(std::string_view("Credito"));
+        escritor.finFila();
+
+        int resultado;
+        while ((resultado = sqlite3_step(consulta)) == SQLITE_ROW) {
+            escritor.campo(columnaTexto(consulta, 0));
+            escritor.campo(static_cast<long long>(sqlite3_column_int64(consulta, 1)));
+            escritor.campo(std::string_view(codigo(tipoTransaccionSegunValor(sqlite3_column_int(consulta, 2)))));
+
+            // Los depósitos y retiros no tienen contraparte (-1)
+            int contraparte = sqlite3_column_int(consulta, 3);
+            if (sqlite3_column_type(consulta, 3) == SQLITE_NULL || contraparte <= 0) {
+                escritor.campoVacio();
+            } else {
+                escritor.campo(static_cast<long long>(contraparte));
+            }
+
+            double monto = sqlite3_column_double(consulta, 4);
+            if (sqlite3_column_int(consulta, 5) != 0) {
+                escritor.campo(monto);
+                escritor.campoVacio();
+            } else {
+                escritor.campoVacio();
+                escritor.campo(monto);
+            }
+            escritor.finFila();
+            movimientos++;
+        }
+
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al leer los movimientos: " + std::string(sqlite3_errmsg(sqlite3_db_handle(consulta))));
+        }
+        if (!escritor.cerrar()) {
+            throw std::runtime_error("Error: No se pudo escribir el archivo " + nombreArchivo + " del estado de cuenta.");
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        movimientos = -1;
+    }
+
+    // Reiniciar la consulta antes de que los límites dejen de existir
+    sqlite3_reset(consulta);
+    sqlite3_clear_bindings(consulta);
+    return movimientos;
+}
@@ -0,0 +1,254 @@
+/**
+ * @file EstadosMensuales.cpp
+ * @brief Implementación de la clase EstadosMensuales para generar los estados de cuenta de cierre de mes.
+ * @details Este archivo contiene la definición de los métodos que reparten las cuentas en lotes entre
+ *          varios hilos, generan el estado de cuenta de cada cuenta y registran los lotes completados.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "EstadosMensuales.hpp"
+#include "Database.hpp"
+#include "EstadoCuenta.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/**
+ * @struct LoteEstados
+ * @brief Cuentas de un lote, como rango del arreglo ordenado de IDs.
+ */
+struct LoteEstados {
+    int numero;
+    size_t inicio;
+    size_t fin;
+};
+
+
+// Definición de método estático para obtener las fechas de un periodo mensual
+bool EstadosMensuales::limitesPeriodo(const std::string& periodo, std::string& desde, std::string& hasta) {
+    if (periodo.size() != 7 || periodo[4] != '-') {
+        return false;
+    }
+    for (size_t i = 0; i < periodo.size(); i++) {
+        if (i != 4 && !std::isdigit(static_cast<unsigned char>(periodo[i]))) {
+            return false;
+        }
+    }
+
+    int año = std::stoi(periodo.substr(0, 4));
+    int mes = std::stoi(periodo.substr(5, 2));
+    if (mes < 1 || mes > 12) {
+        return false;
+    }
+
+    // Último día del mes, considerando los años bisiestos
+    static const int DIAS_MES[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool bisiesto = año % 4 == 0 && (año % 100 != 0 || año % 400 == 0);
+    int ultimoDia = DIAS_MES[mes - 1] + (mes == 2 && bisiesto ? 1 : 0);
+
+    desde = periodo + "-01";
+    hasta = periodo + "-" + std::to_string(ultimoDia);
+    return true;
+}
+
+// Definición de método estático para generar los estados de cuenta del periodo
+ResultadoEstados EstadosMensuales::generar(const std::string& nombreDB, const std::string& periodo,
+                                           const std::string& directorio, unsigned int hilos) {
+    std::string desde, hasta;
+    if (!limitesPeriodo(periodo, desde, hasta)) {
+        throw std::runtime_error("El periodo debe tener el formato YYYY-MM.");
+    }
+
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    ResultadoEstados resultado;
+    resultado.hilos = hilos;
+
+    // IDs de todas las cuentas en orden
+    std::vector<int> cuentas;
+    {
+        Database conexion(nombreDB, true);
+        SQLiteStatement statement(conexion.get(), "SELECT idCuenta FROM Cuentas ORDER BY idCuenta;");
+        while (sqlite3_step(statement.get()) == SQLITE_ROW) {
+            cuentas.push_back(sqlite3_column_int(statement.get(), 0));
+        }
+    }
+
+    // Lotes completados en ejecuciones anteriores
+    fs::path salida = fs::path(directorio) / periodo;
+    fs::create_directories(salida);
+    fs::path rutaProgreso = salida / "progreso.txt";
+
+    // Cada línea tiene el número del lote y el ID más alto que se generó en él; una línea sin ese ID
+    // (formato anterior) no permite saber qué cuentas se crearon después, por lo que el lote se repite
+    std::unordered_map<int, int> completados;
+    {
+        std::ifstream progreso(rutaProgreso);
+        std::string linea;
+        while (std::getline(progreso, linea)) {
+            std::istringstream campos(linea);
+            int numero, ultimo;
+            if (!(campos >> numero) || !(campos >> ultimo)) {
+                continue;
+            }
+            auto [it, nuevo] = completados.emplace(numero, ultimo);
+            if (!nuevo) {
+                it->second = std::max(it->second, ultimo);
+            }
+        }
+    }
+
+    // Agrupar las cuentas pendientes en lotes por rango de ID
+    std::vector<LoteEstados> lotes;
+    for (size_t i = 0; i < cuentas.size();) {
+        int numero = cuentas[i] / CUENTAS_POR_LOTE;
+        size_t fin = i;
+        while (fin < cuentas.size() && cuentas[fin] / CUENTAS_POR_LOTE == numero) {
+            fin++;
+        }
+
+        // Las cuentas creadas después de completar el lote tienen un ID mayor al registrado
+        size_t primera = i;
+        auto completado = completados.find(numero);
+        if (completado != completados.end()) {
+            while (primera < fin && cuentas[primera] <= completado->second) {
+                primera++;
+            }
+        }
+
+        if (primera == fin) {
+            resultado.lotesReanudados++;
+        } else {
+            lotes.push_back({numero, primera, fin});
+        }
+        i = fin;
+    }
+
+    std::ofstream progreso(rutaProgreso, std::ios::app);
+    if (!progreso.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo de progreso " + rutaProgreso.string() + ".");
+    }
+
+    std::mutex mutexProgreso;
+    std::atomic<size_t> siguiente{0};
+    std::vector<ResultadoEstados> parciales(hilos);
+
+    auto trabajo = [&](unsigned int h) {
+        ResultadoEstados& parcial = parciales[h];
+
+        try {
+            // Conexión de solo lectura y una sola consulta preparada por hilo
+            Database conexion(nombreDB, true);
+            SQLiteStatement consulta(conexion.get(), EstadoCuenta::CONSULTA_MOVIMIENTOS);
+
+            size_t indice;
+            while ((indice = siguiente.fetch_add(1)) < lotes.size()) {
+                const LoteEstados& lote = lotes[indice];
+                fs::path carpeta = salida / std::to_string(lote.numero);
+                std::error_code error;
+                fs::create_directories(carpeta, error);
+
+                bool exito = !error;
+                size_t cuentasLote = 0;
+                long long movimientosLote = 0;
+
+                for (size_t i = lote.inicio; exito && i < lote.fin; i++) {
+                    fs::path archivo = carpeta / ("cuenta_" + std::to_string(cuentas[i]) + ".csv");
+                    fs::path temporal = archivo;
+                    temporal += ".tmp";
+
+                    long long movimientos = EstadoCuenta::exportarCSV(consulta.get(), cuentas[i], temporal.string(), desde, hasta);
+                    if (movimientos < 0) {
+                        fs::remove(temporal, error);
+                        exito = false;
+                        break;
+                    }
+
+                    // El archivo final solo aparece completo
+                    fs::rename(temporal, archivo, error);
+                    if (error) {
+                        exito = false;
+                        break;
+                    }
+                    cuentasLote++;
+                    movimientosLote += movimientos;
+                }
+
+                parcial.cuentas += cuentasLote;
+                parcial.movimientos += movimientosLote;
+
+                if (!exito) {
+                    std::cerr << "Error: No se completó el lote " << lote.numero << "." << std::endl;
+                    parcial.lotesFallidos++;
+                    continue;
+                }
+
+                // Registrar el lote completado con el ID más alto generado
+                std::lock_guard<std::mutex> bloqueo(mutexProgreso);
+                progreso << lote.numero << ' ' << cuentas[lote.fin - 1] << '\n';
+                progreso.flush();
+                parcial.lotes++;
+            }
+
+        } catch (const std::exception& e) {
+            std::cerr << "Error en el hilo " << h << ": " << e.what() << std::endl;
+        }
+    };
+
+    std::vector<std::thread> trabajadores;
+    for (unsigned int h = 1; h < hilos; h++) {
+        trabajadores.emplace_back(trabajo, h);
+    }
+    trabajo(0); // El hilo actual también procesa lotes
+    for (std::thread& t : trabajadores) {
+        t.join();
+    }
+
+    // Lotes que ningún hilo alcanzó a tomar (por ejemplo, si no se pudo abrir la base de datos)
+    size_t tomados = std::min(siguiente.load(), lotes.size());
+
+    for (const ResultadoEstados& parcial : parciales) {
+        resultado.cuentas += parcial.cuentas;
+        resultado.movimientos += parcial.movimientos;
+        resultado.lotes += parcial.lotes;
+        resultado.lotesFallidos += parcial.lotesFallidos;
+    }
+    resultado.lotesFallidos += lotes.size() - tomados;
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    return resultado;
+}
+
+// Definición de método estático para mostrar el resultado de una generación
+void EstadosMensuales::mostrarResultado(const ResultadoEstados& resultado) {
+    std::cout << "Estados de cuenta generados: " << resultado.cuentas
+              << " (" << resultado.movimientos << " movimientos)" << std::endl;
+    std::cout << "Lotes completados: " << resultado.lotes
+              << ", reanudados: " << resultado.lotesReanudados
+              << ", fallidos: " << resultado.lotesFallidos << std::endl;
+    std::cout << "Tiempo: " << resultado.segundos << " s con " << resultado.hilos << " hilos";
+    if (resultado.segundos > 0) {
+        std::cout << " (" << static_cast<long long>(resultado.cuentas / resultado.segundos) << " cuentas/s)";
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,413 @@
+/**
+ * @file FiltrosExistencia.cpp
+ * @brief Implementación de los filtros de Bloom que evitan consultas de existencia a la base de datos.
+ * @details Este archivo contiene la definición de los métodos de las clases FiltroBloom y FiltrosExistencia.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "FiltrosExistencia.hpp"
+#include "CapturaSalida.hpp"
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+/// @brief Identificador y versión del formato del archivo de filtros.
+static const char MAGICO_FILTROS[4] = {'B', 'L', 'O', 'M'};
+static const uint32_t VERSION_FILTROS = 1;
+
+// Función auxiliar para mezclar los bits de una clave (splitmix64)
+static uint64_t mezclar(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Definición del constructor de la clase FiltroBloom
+FiltroBloom::FiltroBloom(size_t capacidad) {
+    // Cantidad de bits en potencia de 2 para reemplazar el módulo por una máscara
+    cantidadBits = BITS_MINIMOS_FILTRO;
+    while (cantidadBits < capacidad * BITS_POR_CLAVE_FILTRO) {
+        cantidadBits *= 2;
+    }
+    bits.assign(cantidadBits / 64, 0);
+}
+
+// Definición de método para agregar una clave al filtro
+void FiltroBloom::agregar(int64_t clave) {
+    uint64_t h1 = mezclar(static_cast<uint64_t>(clave));
+    uint64_t h2 = mezclar(h1) | 1;
+    uint64_t mascara = cantidadBits - 1;
+
+    for (uint32_t i = 0; i < funcionesHash; i++) {
+        uint64_t bit = (h1 + i * h2) & mascara;
+        bits[bit >> 6] |= 1ULL << (bit & 63);
+    }
+    claves++;
+}
+
+// Definición de método para verificar si una clave puede estar en el filtro
+bool FiltroBloom::puedeContener(int64_t clave) const {
+    uint64_t h1 = mezclar(static_cast<uint64_t>(clave));
+    uint64_t h2 = mezclar(h1) | 1;
+    uint64_t mascara = cantidadBits - 1;
+
+    for (uint32_t i = 0; i < funcionesHash; i++) {
+        uint64_t bit = (h1 + i * h2) & mascara;
+        if ((bits[bit >> 6] & (1ULL << (bit & 63))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FiltroBloom::lleno() const {
+    return claves * BITS_POR_CLAVE_FILTRO > cantidadBits;
+}
+
+size_t FiltroBloom::getClaves() const {
+    return claves;
+}
+
+// Definición de método para escribir el filtro en un archivo
+bool FiltroBloom::escribir(std::FILE* archivo) const {
+    uint64_t encabezado[3] = {cantidadBits, funcionesHash, claves};
+    return std::fwrite(encabezado, sizeof(encabezado), 1, archivo) == 1
+        && std::fwrite(bits.data(), sizeof(uint64_t), bits.size(), archivo) == bits.size();
+}
+
+// Definición de método para leer el filtro de un archivo
+bool FiltroBloom::leer(std::FILE* archivo) {
+    uint64_t encabezado[3];
+    if (std::fread(encabezado, sizeof(encabezado), 1, archivo) != 1) {
+        return false;
+    }
+
+    // La cantidad de bits debe ser una potencia de 2 razonable
+    uint64_t cantidad = encabezado[0];
+    if (cantidad < BITS_MINIMOS_FILTRO || cantidad > (1ULL << 40) || (cantidad & (cantidad - 1)) != 0
+        || encabezado[1] == 0 || encabezado[1] > 32) {
+        return false;
+    }
+
+    std::vector<uint64_t> leidos(cantidad / 64);
+    if (std::fread(leidos.data(), sizeof(uint64_t), leidos.size(), archivo) != leidos.size()) {
+        return false;
+    }
+
+    cantidadBits = cantidad;
+    funcionesHash = static_cast<uint32_t>(encabezado[1]);
+    claves = encabezado[2];
+    bits = std::move(leidos);
+    return true;
+}
+
+
+/**
+ * @struct EstadoFiltros
+ * @brief Filtros de una conexión y lo necesario para mantenerlos sincronizados.
+ */
+struct EstadoFiltros {
+    sqlite3* db = nullptr;
+    std::string nombreArchivo;
+    FiltroBloom filtros[CANTIDAD_FILTROS_EXISTENCIA];
+
+    // Último ID confirmado agregado a los filtros de cada tabla
+    int64_t ultimoCliente = 0;
+    int64_t ultimaCuenta = 0;
+    int64_t ultimoPrestamo = 0;
+
+    // Estado de la base de datos en la última sincronización
+    int64_t versionDatos = -1;
+    sqlite3_int64 cambios = -1;
+
+    // Sentencias preparadas una sola vez
+    sqlite3_stmt* version = nullptr;
+    sqlite3_stmt* nuevosClientes = nullptr;
+    sqlite3_stmt* nuevasCuentas = nullptr;
+    sqlite3_stmt* nuevosPrestamos = nullptr;
+
+    ~EstadoFiltros() {
+        sqlite3_finalize(version);
+        sqlite3_finalize(nuevosClientes);
+        sqlite3_finalize(nuevasCuentas);
+        sqlite3_finalize(nuevosPrestamos);
+    }
+
+    FiltroBloom& filtro(FiltroExistencia tipo) {
+        return filtros[static_cast<size_t>(tipo)];
+    }
+};
+
+/// @brief Filtros activos por conexión.
+static std::mutex mutexRegistro;
+static std::unordered_map<sqlite3*, std::unique_ptr<EstadoFiltros>> registro;
+
+// Función auxiliar para preparar una sentencia que se conserva mientras los filtros estén activos
+static sqlite3_stmt* preparar(sqlite3* db, const char* sql) {
+    sqlite3_stmt* statement = nullptr;
+    if (sqlite3_prepare_v2(db, sql, -1, &statement, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Error al preparar la consulta de los filtros: " + std::string(sqlite3_errmsg(db)));
+    }
+    return statement;
+}
+
+// Función auxiliar para obtener el mayor ID de una tabla
+static int64_t obtenerMaximo(sqlite3* db, const char* sql) {
+    sqlite3_stmt* statement = preparar(db, sql);
+    int64_t maximo = sqlite3_step(statement) == SQLITE_ROW ? sqlite3_column_int64(statement, 0) : 0;
+    sqlite3_finalize(statement);
+    return maximo;
+}
+
+// Función auxiliar para recorrer las filas con un ID mayor a `desde` y retornar el mayor ID recorrido
+template <typename Agregar>
+static int64_t recorrerNuevos(sqlite3* db, sqlite3_stmt* statement, int64_t desde, Agregar agregar) {
+    int64_t ultimo = desde;
+    sqlite3_bind_int64(statement, 1, desde);
+
+    int resultado;
+    while ((resultado = sqlite3_step(statement)) == SQLITE_ROW) {
+        ultimo = sqlite3_column_int64(statement, 0);
+        agregar(statement);
+    }
+    sqlite3_reset(statement);
+
+    if (resultado != SQLITE_DONE) {
+        throw std::runtime_error("Error al sincronizar los filtros: " + std::string(sqlite3_errmsg(db)));
+    }
+    return ultimo;
+}
+
+// Función auxiliar para construir los filtros de una tabla desde cero, con espacio para crecer
+static void construir(EstadoFiltros& estado, FiltroExistencia tabla) {
+    switch (tabla) {
+        case FiltroExistencia::CLIENTES:
+            estado.filtro(FiltroExistencia::CLIENTES) = FiltroBloom(2 * obtenerMaximo(estado.db, "SELECT MAX(idCliente) FROM Clientes;"));
+            estado.ultimoCliente = 0;
+            break;
+        case FiltroExistencia::CUENTAS:
+        case FiltroExistencia::CUENTAS_MONEDA: {
+            size_t capacidad = 2 * obtenerMaximo(estado.db, "SELECT MAX(idCuenta) FROM Cuentas;");
+            estado.filtro(FiltroExistencia::CUENTAS) = FiltroBloom(capacidad);
+            estado.filtro(FiltroExistencia::CUENTAS_MONEDA) = FiltroBloom(capacidad);
+            estado.ultimaCuenta = 0;
+            break;
+        }
+        case FiltroExistencia::PRESTAMOS:
+            estado.filtro(FiltroExistencia::PRESTAMOS) = FiltroBloom(2 * obtenerMaximo(estado.db, "SELECT MAX(idPrestamo) FROM Prestamos;"));
+            estado.ultimoPrestamo = 0;
+            break;
+    }
+}
+
+// Función auxiliar para agregar a los filtros las filas insertadas desde la última sincronización
+static void sincronizar(EstadoFiltros& estado, bool forzar) {
+    if (sqlite3_step(estado.version) != SQLITE_ROW) {
+        sqlite3_reset(estado.version);
+        throw std::runtime_error("Error al consultar la versión de la base de datos: " + std::string(sqlite3_errmsg(estado.db)));
+    }
+    int64_t versionDatos = sqlite3_column_int64(estado.version, 0);
+    sqlite3_reset(estado.version);
+    sqlite3_int64 cambios = sqlite3_total_changes64(estado.db);
+
+    if (!forzar && versionDatos == estado.versionDatos && cambios == estado.cambios) {
+        return;
+    }
+
+    // Dentro de una transacción las filas nuevas se agregan, pero el último ID no avanza: si se
+    // revierte, los IDs se reutilizan y se deben volver a recorrer
+    bool confirmado = sqlite3_get_autocommit(estado.db) != 0;
+
+    int64_t ultimoCliente = recorrerNuevos(estado.db, estado.nuevosClientes, estado.ultimoCliente, [&](sqlite3_stmt* fila) {
+        estado.filtro(FiltroExistencia::CLIENTES).agregar(sqlite3_column_int64(fila, 1));
+    });
+    int64_t ultimaCuenta = recorrerNuevos(estado.db, estado.nuevasCuentas, estado.ultimaCuenta, [&](sqlite3_stmt* fila) {
+        estado.filtro(FiltroExistencia::CUENTAS).agregar(sqlite3_column_int64(fila, 0));
+        estado.filtro(FiltroExistencia::CUENTAS_MONEDA).agregar(FiltrosExistencia::claveCuentaMoneda(
+            sqlite3_column_int(fila, 1), monedaSegunValor(sqlite3_column_int(fila, 2))));
+    });
+    int64_t ultimoPrestamo = recorrerNuevos(estado.db, estado.nuevosPrestamos, estado.ultimoPrestamo, [&](sqlite3_stmt* fila) {
+        estado.filtro(FiltroExistencia::PRESTAMOS).agregar(sqlite3_column_int64(fila, 0));
+    });
+
+    if (confirmado) {
+        estado.ultimoCliente = ultimoCliente;
+        estado.ultimaCuenta = ultimaCuenta;
+        estado.ultimoPrestamo = ultimoPrestamo;
+    }
+    estado.versionDatos = versionDatos;
+    estado.cambios = cambios;
+
+    // Un filtro con más claves de las previstas pierde precisión y se reconstruye con el doble de bits
+    bool reconstruir = false;
+    for (FiltroExistencia tabla : {FiltroExistencia::CLIENTES, FiltroExistencia::CUENTAS, FiltroExistencia::PRESTAMOS}) {
+        if (estado.filtro(tabla).lleno()) {
+            construir(estado, tabla);
+            reconstruir = true;
+        }
+    }
+    if (reconstruir) {
+        sincronizar(estado, true);
+    }
+}
+
+// Función auxiliar para leer los filtros guardados, si corresponden a la misma base de datos
+static bool cargar(EstadoFiltros& estado, const struct stat& infoDB) {
+    std::FILE* archivo = std::fopen(estado.nombreArchivo.c_str(), "rb");
+    if (archivo == nullptr) {
+        return false;
+    }
+
+    char magico[4];
+    uint32_t version;
+    uint64_t identificacion[2];
+    int64_t ultimos[3];
+
+    bool valido = std::fread(magico, sizeof(magico), 1, archivo) == 1 && std::memcmp(magico, MAGICO_FILTROS, 4) == 0
+        && std::fread(&version, sizeof(version), 1, archivo) == 1 && version == VERSION_FILTROS
+        && std::fread(identificacion, sizeof(identificacion), 1, archivo) == 1
+        && identificacion[0] == static_cast<uint64_t>(infoDB.st_dev) && identificacion[1] == static_cast<uint64_t>(infoDB.st_ino)
+        && std::fread(ultimos, sizeof(ultimos), 1, archivo) == 1;
+
+    for (size_t f = 0; valido && f < CANTIDAD_FILTROS_EXISTENCIA; f++) {
+        valido = estado.filtros[f].leer(archivo);
+    }
+    std::fclose(archivo);
+
+    if (valido) {
+        estado.ultimoCliente = ultimos[0];
+        estado.ultimaCuenta = ultimos[1];
+        estado.ultimoPrestamo = ultimos[2];
+    }
+    return valido;
+}
+
+// Función auxiliar para escribir los filtros en su archivo
+static bool escribir(const EstadoFiltros& estado) {
+    struct stat infoDB;
+    const char* nombreDB = sqlite3_db_filename(estado.db, "main");
+    if (estado.nombreArchivo.empty() || nombreDB == nullptr || stat(nombreDB, &infoDB) != 0) {
+        return false;
+    }
+
+    // Escribir en un archivo temporal y renombrarlo, para no dejar un archivo incompleto
+    std::string temporal = estado.nombreArchivo + ".tmp";
+    std::FILE* archivo = std::fopen(temporal.c_str(), "wb");
+    if (archivo == nullptr) {
+        return false;
+    }
+
+    uint64_t identificacion[2] = {static_cast<uint64_t>(infoDB.st_dev), static_cast<uint64_t>(infoDB.st_ino)};
+    int64_t ultimos[3] = {estado.ultimoCliente, estado.ultimaCuenta, estado.ultimoPrestamo};
+
+    bool escrito = std::fwrite(MAGICO_FILTROS, sizeof(MAGICO_FILTROS), 1, archivo) == 1
+        && std::fwrite(&VERSION_FILTROS, sizeof(VERSION_FILTROS), 1, archivo) == 1
+        && std::fwrite(identificacion, sizeof(identificacion), 1, archivo) == 1
+        && std::fwrite(ultimos, sizeof(ultimos), 1, archivo) == 1;
+    for (size_t f = 0; escrito && f < CANTIDAD_FILTROS_EXISTENCIA; f++) {
+        escrito = estado.filtros[f].escribir(archivo);
+    }
+
+    escrito = std::fclose(archivo) == 0 && escrito;
+    if (!escrito || std::rename(temporal.c_str(), estado.nombreArchivo.c_str()) != 0) {
+        std::remove(temporal.c_str());
+        return false;
+    }
+    return true;
+}
+
+
+// Definición de método estático para activar los filtros de una conexión
+bool FiltrosExistencia::activar(sqlite3* db, const std::string& nombreArchivo) {
+    try {
+        auto estado = std::make_unique<EstadoFiltros>();
+        estado->db = db;
+        estado->nombreArchivo = nombreArchivo;
+        estado->version = preparar(db, "PRAGMA data_version;");
+        estado->nuevosClientes = preparar(db, "SELECT idCliente, cedula FROM Clientes WHERE idCliente > ? ORDER BY idCliente;");
+        estado->nuevasCuentas = preparar(db, "SELECT idCuenta, idCliente, moneda FROM Cuentas WHERE idCuenta > ? ORDER BY idCuenta;");
+        estado->nuevosPrestamos = preparar(db, "SELECT idPrestamo FROM Prestamos WHERE idPrestamo > ? ORDER BY idPrestamo;");
+
+        // Cargar los filtros guardados o construirlos recorriendo las tablas
+        struct stat infoDB;
+        const char* nombreDB = sqlite3_db_filename(db, "main");
+        bool cargados = !nombreArchivo.empty() && nombreDB != nullptr && stat(nombreDB, &infoDB) == 0 && cargar(*estado, infoDB);
+        if (!cargados) {
+            construir(*estado, FiltroExistencia::CLIENTES);
+            construir(*estado, FiltroExistencia::CUENTAS);
+            construir(*estado, FiltroExistencia::PRESTAMOS);
+        }
+        sincronizar(*estado, true);
+
+        std::lock_guard<std::mutex> lock(mutexRegistro);
+        registro[db] = std::move(estado);
+        return true;
+
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Definición de método estático para guardar los filtros de una conexión
+bool FiltrosExistencia::guardar(sqlite3* db) {
+    std::lock_guard<std::mutex> lock(mutexRegistro);
+    auto encontrado = registro.find(db);
+    return encontrado != registro.end() && escribir(*encontrado->second);
+}
+
+// Definición de método estático para guardar y desactivar los filtros de una conexión
+void FiltrosExistencia::desactivar(sqlite3* db) {
+    std::unique_ptr<EstadoFiltros> estado;
+    {
+        std::lock_guard<std::mutex> lock(mutexRegistro);
+        auto encontrado = registro.find(db);
+        if (encontrado == registro.end()) {
+            return;
+        }
+        estado = std::move(encontrado->second);
+        registro.erase(encontrado);
+    }
+
+    if (!estado->nombreArchivo.empty() && !escribir(*estado)) {
+        flujoErrores() << "Error: No se pudieron guardar los filtros en " << estado->nombreArchivo << "." << std::endl;
+    }
+}
+
+// Definición de método estático para verificar si una clave puede existir
+bool FiltrosExistencia::puedeExistir(sqlite3* db, FiltroExistencia filtro, int64_t clave) {
+    EstadoFiltros* estado;
+    {
+        std::lock_guard<std::mutex> lock(mutexRegistro);
+        auto encontrado = registro.find(db);
+        if (encontrado == registro.end()) {
+            return true;
+        }
+        estado = encontrado->second.get();
+    }
+
+    try {
+        sincronizar(*estado, false);
+        return estado->filtro(filtro).puedeContener(clave);
+
+    } catch (const std::exception& e) {
+        // Ante un error, se deja la decisión a la consulta en SQLite
+        flujoErrores() << e.what() << std::endl;
+        return true;
+    }
+}
+
+// Definición de método estático para obtener la clave de una cuenta por cliente y moneda
+int64_t FiltrosExistencia::claveCuentaMoneda(int idCliente, Moneda moneda) {
+    return static_cast<int64_t>(idCliente) * CANTIDAD_MONEDAS + static_cast<int>(moneda);
+}
@@ -0,0 +1,397 @@
+/**
+ * @file GeneradorCarga.cpp
+ * @brief Implementación de la clase GeneradorCarga para simular sesiones concurrentes de ventanilla.
+ * @details Este archivo contiene la definición de los métodos de la clase GeneradorCarga: la carga de
+ *          las cuentas y préstamos, el ciclo de cada sesión simulada, el histograma de latencias y la
+ *          combinación y presentación de los resultados.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "GeneradorCarga.hpp"
+#include "Cliente.hpp"
+#include "Cuenta.hpp"
+#include "Database.hpp"
+#include "Prestamo.hpp"
+#include "CapturaSalida.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+
+// Función auxiliar para obtener el intervalo del histograma de una latencia en microsegundos
+static int indiceLatencia(uint64_t microsegundos) {
+    if (microsegundos < 32) {
+        return static_cast<int>(microsegundos);
+    }
+    int bits = std::bit_width(microsegundos) - 1; // Posición del bit más significativo
+    int indice = (bits - 4) * 32 + static_cast<int>((microsegundos >> (bits - 5)) & 31);
+    return std::min(indice, INTERVALOS_LATENCIA - 1);
+}
+
+// Función auxiliar para obtener el límite inferior de un intervalo del histograma
+static double limiteLatencia(int indice) {
+    if (indice < 32) {
+        return indice;
+    }
+    int bits = indice / 32 + 4;
+    return std::ldexp(32.0 + indice % 32, bits - 5);
+}
+
+/**
+ * @struct EstadoSesion
+ * @brief Estadísticas que acumula cada sesión sin compartir memoria con las demás.
+ */
+struct EstadoSesion {
+    uint64_t ejecutadas[CANTIDAD_OPERACIONES_CARGA] = {};
+    uint64_t errores[CANTIDAD_OPERACIONES_CARGA] = {};
+    uint64_t ocupadas[CANTIDAD_OPERACIONES_CARGA] = {};
+    double sumaUs[CANTIDAD_OPERACIONES_CARGA] = {};
+    double maximoUs[CANTIDAD_OPERACIONES_CARGA] = {};
+    std::vector<uint32_t> histograma = std::vector<uint32_t>(CANTIDAD_OPERACIONES_CARGA * INTERVALOS_LATENCIA, 0);
+    std::vector<IntervaloCarga> intervalos;
+
+    /// @brief Cantidad de veces que la conexión encontró la base de datos bloqueada.
+    uint64_t bloqueos = 0;
+
+    /// @brief Tiempo máximo de espera ante un bloqueo (ms).
+    int esperaOcupadaMs = 0;
+};
+
+// Manejador de bloqueos de SQLite: cuenta cada bloqueo y espera hasta el tiempo configurado
+static int manejarBloqueo(void* datos, int intentos) {
+    EstadoSesion* estado = static_cast<EstadoSesion*>(datos);
+    if (intentos == 0) {
+        estado->bloqueos++;
+    }
+    if (intentos >= estado->esperaOcupadaMs) {
+        return 0; // Abandonar: la operación falla con SQLITE_BUSY
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return 1;
+}
+
+// Función auxiliar para obtener un percentil del histograma de una operación
+static double percentil(const std::vector<uint64_t>& histograma, uint64_t total, double fraccion) {
+    if (total == 0) {
+        return 0.0;
+    }
+    uint64_t objetivo = static_cast<uint64_t>(std::ceil(fraccion * total));
+    uint64_t acumulado = 0;
+    for (int i = 0; i < INTERVALOS_LATENCIA; i++) {
+        acumulado += histograma[i];
+        if (acumulado >= objetivo) {
+            return limiteLatencia(i);
+        }
+    }
+    return limiteLatencia(INTERVALOS_LATENCIA - 1);
+}
+
+
+// Definición del constructor de la clase GeneradorCarga
+GeneradorCarga::GeneradorCarga(const std::string& nombreDB) : nombreDB(nombreDB) {}
+
+
+// Definición de método para cargar las cuentas y los préstamos activos
+bool GeneradorCarga::cargar(sqlite3* db) {
+    cuentas.clear();
+    monedas.clear();
+    cedulas.clear();
+    prestamos.clear();
+    cuentasPrestamo.clear();
+
+    try {
+        SQLiteStatement consultaCuentas(db, "SELECT c.idCuenta, c.moneda, cl.cedula FROM Cuentas c "
+                                            "JOIN Clientes cl ON cl.idCliente = c.idCliente ORDER BY c.idCuenta;");
+        while (sqlite3_step(consultaCuentas.get()) == SQLITE_ROW) {
+            cuentas.push_back(sqlite3_column_int(consultaCuentas.get(), 0));
+            monedas.push_back(monedaSegunValor(sqlite3_column_int(consultaCuentas.get(), 1)));
+            cedulas.push_back(sqlite3_column_int(consultaCuentas.get(), 2));
+        }
+
+        SQLiteStatement consultaPrestamos(db, "SELECT idPrestamo, idCuenta FROM Prestamos WHERE activo = 1;");
+        while (sqlite3_step(consultaPrestamos.get()) == SQLITE_ROW) {
+            prestamos.push_back(sqlite3_column_int(consultaPrestamos.get(), 0));
+            cuentasPrestamo.push_back(sqlite3_column_int(consultaPrestamos.get(), 1));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+
+    if (cuentas.empty()) {
+        std::cerr << "Error: No hay cuentas sobre las cuales generar carga." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+// Definición de método para ejecutar las sesiones simuladas
+ResultadoCarga GeneradorCarga::ejecutar(const ParametrosCarga& parametros) const {
+    ResultadoCarga resultado;
+    resultado.intervalo = parametros.intervalo > 0 ? parametros.intervalo : 1.0;
+    resultado.sesiones = std::max(1u, parametros.sesiones);
+
+    // Distribución Zipf de las cuentas: el rango de cada cuenta se asigna al azar con la semilla
+    std::vector<size_t> orden(cuentas.size());
+    std::iota(orden.begin(), orden.end(), 0);
+    std::shuffle(orden.begin(), orden.end(), std::mt19937_64(parametros.semilla));
+
+    std::vector<double> acumulada(cuentas.size());
+    double suma = 0.0;
+    for (size_t r = 0; r < cuentas.size(); r++) {
+        suma += 1.0 / std::pow(static_cast<double>(r + 1), parametros.exponenteZipf);
+        acumulada[r] = suma;
+    }
+
+    std::vector<EstadoSesion> estados(resultado.sesiones);
+
+    auto inicio = std::chrono::steady_clock::now();
+    auto fin = inicio + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(parametros.segundos));
+
+    auto sesion = [&](unsigned int numero) {
+        EstadoSesion& estado = estados[numero];
+        estado.esperaOcupadaMs = parametros.esperaOcupadaMs;
+
+        // Los métodos de las clases muestran mensajes por cada operación: se descartan en flujos propios
+        // de la sesión, sin compartir el estado de std::cout y std::cerr con las demás
+        CapturaSalida captura;
+
+        std::mt19937_64 generador(parametros.semilla + numero + 1);
+        std::discrete_distribution<int> mezcla(std::begin(parametros.pesos), std::end(parametros.pesos));
+        std::uniform_real_distribution<double> uniforme(0.0, suma);
+        std::uniform_int_distribution<int> montos(1, 100);
+        std::exponential_distribution<double> espera(parametros.esperaMediaMs > 0 ? 1.0 / parametros.esperaMediaMs : 1.0);
+
+        // Cuenta elegida según la distribución Zipf
+        auto elegirCuenta = [&]() {
+            size_t rango = std::upper_bound(acumulada.begin(), acumulada.end(), uniforme(generador)) - acumulada.begin();
+            return orden[std::min(rango, orden.size() - 1)];
+        };
+
+        try {
+            Database conexion(nombreDB);
+            sqlite3* db = conexion.get();
+            sqlite3_busy_handler(db, manejarBloqueo, &estado);
+
+            while (std::chrono::steady_clock::now() < fin) {
+                int operacion = mezcla(generador);
+                size_t i = elegirCuenta();
+                double monto = montos(generador);
+                uint64_t bloqueosPrevios = estado.bloqueos;
+                bool exito = false;
+
+                auto inicioOperacion = std::chrono::steady_clock::now();
+                try {
+                    switch (operacion) {
+                        case 0: { // LOGIN
+                            exito = Cliente::obtener(db, cedulas[i]).getID() != 0;
+                            break;
+                        }
+                        case 1: { // SALDO
+                            Cuenta cuenta = Cuenta::obtener(db, cuentas[i]);
+                            exito = cuenta.getID() != 0;
+                            break;
+                        }
+                        case 2: { // DEP
+                            Cuenta cuenta = Cuenta::obtener(db, cuentas[i]);
+                            exito = cuenta.getID() != 0 && cuenta.depositar(db, monto);
+                            break;
+                        }
+                        case 3: { // RET
+                            Cuenta cuenta = Cuenta::obtener(db, cuentas[i]);
+                            exito = cuenta.getID() != 0 && cuenta.retirar(db, monto);
+                            break;
+                        }
+                        case 4: { // TRA
+                            Cuenta cuenta = Cuenta::obtener(db, cuentas[i]);
+                            exito = cuenta.getID() != 0 && cuenta.transferir(db, cuentas[elegirCuenta()], monto);
+                            break;
+                        }
+                        case 5: { // CDP
+                            Cuenta cuenta = Cuenta::obtener(db, cuentas[i]);
+                            exito = cuenta.getID() != 0 && cuenta.solicitarCDP(db, monedas[i], monto, 6, 4.0);
+                            break;
+                        }
+                        case 6: { // ABO
+                            if (prestamos.empty()) break;
+                            size_t p = generador() % prestamos.size();
+                            Prestamo prestamo = Prestamo::obtener(db, prestamos[p]);
+                            Cuenta cuenta = Cuenta::obtener(db, cuentasPrestamo[p]);
+                            exito = prestamo.getID() != 0 && cuenta.getID() != 0 && prestamo.abonarCuota(db, cuenta);
+                            break;
+                        }
+                    }
+                } catch (const std::exception&) {
+                    exito = false;
+                }
+                auto finOperacion = std::chrono::steady_clock::now();
+                captura.tomarErrores(); // Descartar los mensajes de error de la operación
+
+                // Registrar la operación en las estadísticas de la sesión
+                uint64_t microsegundos = std::chrono::duration_cast<std::chrono::microseconds>(finOperacion - inicioOperacion).count();
+                bool ocupada = !exito && estado.bloqueos != bloqueosPrevios;
+
+                estado.ejecutadas[operacion]++;
+                estado.errores[operacion] += !exito;
+                estado.ocupadas[operacion] += ocupada;
+                estado.sumaUs[operacion] += microsegundos;
+                estado.maximoUs[operacion] = std::max(estado.maximoUs[operacion], static_cast<double>(microsegundos));
+                estado.histograma[operacion * INTERVALOS_LATENCIA + indiceLatencia(microsegundos)]++;
+
+                size_t indiceIntervalo = static_cast<size_t>(
+                    std::chrono::duration<double>(inicioOperacion - inicio).count() / resultado.intervalo);
+                if (estado.intervalos.size() <= indiceIntervalo) {
+                    estado.intervalos.resize(indiceIntervalo + 1);
+                }
+                estado.intervalos[indiceIntervalo].ejecutadas++;
+                estado.intervalos[indiceIntervalo].errores += !exito;
+                estado.intervalos[indiceIntervalo].ocupadas += ocupada;
+
+                // Tiempo de atención antes de la siguiente operación
+                if (parametros.esperaMediaMs > 0) {
+                    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(espera(generador)));
+                }
+            }
+        } catch (const std::exception& e) {
+            std::clog << "Error en la sesión " << numero << ": " << e.what() << std::endl;
+        }
+    };
+
+    std::vector<std::thread> hilos;
+    for (unsigned int s = 0; s < resultado.sesiones; s++) {
+        hilos.emplace_back(sesion, s);
+    }
+    for (std::thread& hilo : hilos) {
+        hilo.join();
+    }
+
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    // Combinar las estadísticas de todas las sesiones
+    std::vector<uint64_t> histogramaTotal(INTERVALOS_LATENCIA, 0);
+    double sumaTotal = 0.0;
+
+    for (int o = 0; o < CANTIDAD_OPERACIONES_CARGA; o++) {
+        EstadisticasCarga& estadisticas = resultado.operaciones[o];
+        std::vector<uint64_t> histograma(INTERVALOS_LATENCIA, 0);
+        double sumaUs = 0.0;
+
+        for (const EstadoSesion& estado : estados) {
+            estadisticas.ejecutadas += estado.ejecutadas[o];
+            estadisticas.errores += estado.errores[o];
+            estadisticas.ocupadas += estado.ocupadas[o];
+            estadisticas.maximoUs = std::max(estadisticas.maximoUs, estado.maximoUs[o]);
+            sumaUs += estado.sumaUs[o];
+            for (int i = 0; i < INTERVALOS_LATENCIA; i++) {
+                histograma[i] += estado.histograma[o * INTERVALOS_LATENCIA + i];
+            }
+        }
+
+        if (estadisticas.ejecutadas > 0) {
+            estadisticas.promedioUs = sumaUs / estadisticas.ejecutadas;
+            estadisticas.p50Us = percentil(histograma, estadisticas.ejecutadas, 0.50);
+            estadisticas.p95Us = percentil(histograma, estadisticas.ejecutadas, 0.95);
+            estadisticas.p99Us = percentil(histograma, estadisticas.ejecutadas, 0.99);
+        }
+
+        resultado.total.ejecutadas += estadisticas.ejecutadas;
+        resultado.total.errores += estadisticas.errores;
+        resultado.total.ocupadas += estadisticas.ocupadas;
+        resultado.total.maximoUs = std::max(resultado.total.maximoUs, estadisticas.maximoUs);
+        sumaTotal += sumaUs;
+        for (int i = 0; i < INTERVALOS_LATENCIA; i++) {
+            histogramaTotal[i] += histograma[i];
+        }
+    }
+
+    if (resultado.total.ejecutadas > 0) {
+        resultado.total.promedioUs = sumaTotal / resultado.total.ejecutadas;
+        resultado.total.p50Us = percentil(histogramaTotal, resultado.total.ejecutadas, 0.50);
+        resultado.total.p95Us = percentil(histogramaTotal, resultado.total.ejecutadas, 0.95);
+        resultado.total.p99Us = percentil(histogramaTotal, resultado.total.ejecutadas, 0.99);
+    }
+
+    for (const EstadoSesion& estado : estados) {
+        if (resultado.intervalos.size() < estado.intervalos.size()) {
+            resultado.intervalos.resize(estado.intervalos.size());
+        }
+        for (size_t i = 0; i < estado.intervalos.size(); i++) {
+            resultado.intervalos[i].ejecutadas += estado.intervalos[i].ejecutadas;
+            resultado.intervalos[i].errores += estado.intervalos[i].errores;
+            resultado.intervalos[i].ocupadas += estado.intervalos[i].ocupadas;
+        }
+    }
+
+    return resultado;
+}
+
+
+// Definición de método estático para mostrar el resultado en la terminal
+void GeneradorCarga::mostrarResultado(const ResultadoCarga& resultado) {
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "\n=== Resultado del Generador de Carga ===" << std::endl;
+    std::cout << std::left << std::setw(8) << "Op" << std::right << std::setw(12) << "Ejecutadas"
+              << std::setw(10) << "Errores" << std::setw(10) << "Ocupadas" << std::setw(12) << "Prom (us)"
+              << std::setw(10) << "p50" << std::setw(10) << "p95" << std::setw(10) << "p99"
+              << std::setw(12) << "Máx" << std::endl;
+
+    auto mostrarFila = [](const char* nombre, const EstadisticasCarga& e) {
+        std::cout << std::left << std::setw(8) << nombre << std::right << std::setw(12) << e.ejecutadas
+                  << std::setw(10) << e.errores << std::setw(10) << e.ocupadas << std::setw(12) << e.promedioUs
+                  << std::setw(10) << e.p50Us << std::setw(10) << e.p95Us << std::setw(10) << e.p99Us
+                  << std::setw(11) << e.maximoUs << std::endl;
+    };
+
+    for (int o = 0; o < CANTIDAD_OPERACIONES_CARGA; o++) {
+        if (resultado.operaciones[o].ejecutadas > 0) {
+            mostrarFila(OPERACIONES_CARGA[o], resultado.operaciones[o]);
+        }
+    }
+    mostrarFila("TOTAL", resultado.total);
+
+    std::cout << "\nSesiones: " << resultado.sesiones << ", duración: " << resultado.segundos << " s, rendimiento: "
+              << (resultado.segundos > 0 ? resultado.total.ejecutadas / resultado.segundos : 0.0) << " op/s" << std::endl;
+
+    std::cout << "\n" << std::setw(10) << "Segundo" << std::setw(12) << "Op/s" << std::setw(10) << "Errores"
+              << std::setw(10) << "Ocupadas" << std::endl;
+    for (size_t i = 0; i < resultado.intervalos.size(); i++) {
+        const IntervaloCarga& intervalo = resultado.intervalos[i];
+        std::cout << std::setw(10) << i * resultado.intervalo << std::setw(12) << intervalo.ejecutadas / resultado.intervalo
+                  << std::setw(10) << intervalo.errores << std::setw(10) << intervalo.ocupadas << std::endl;
+    }
+    std::cout << std::setprecision(2);
+}
+
+// Definición de método estático para exportar la serie de tiempo en formato CSV
+bool GeneradorCarga::exportarCSV(const ResultadoCarga& resultado, const std::string& nombreArchivo) {
+    std::ofstream archivo(nombreArchivo);
+
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo para guardar el resultado de la carga." << std::endl;
+        return false;
+    }
+
+    archivo << std::fixed << std::setprecision(2);
+    archivo << "Segundo,Ejecutadas,Errores,Ocupadas,Operaciones por Segundo\n";
+    for (size_t i = 0; i < resultado.intervalos.size(); i++) {
+        const IntervaloCarga& intervalo = resultado.intervalos[i];
+        archivo << i * resultado.intervalo << "," << intervalo.ejecutadas << "," << intervalo.errores << ","
+                << intervalo.ocupadas << "," << intervalo.ejecutadas / resultado.intervalo << "\n";
+    }
+
+    archivo.close();
+    return !archivo.fail();
+}
@@ -0,0 +1,326 @@
+/**
+ * @file ImportadorCSV.cpp
+ * @brief Implementación de la clase ImportadorCSV para la carga masiva de clientes y cuentas.
+ * @details Este archivo contiene la definición de los métodos que leen los archivos `.csv` con LectorCSV,
+ *          validan cada fila y la insertan con sentencias preparadas en transacciones grandes.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "ImportadorCSV.hpp"
+#include "Codigos.hpp"
+#include "Consultas.hpp"
+#include "LectorCSV.hpp"
+#include "SQLiteStatement.hpp"
+#include "validaciones.hpp"
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @enum EstadoFila
+ * @brief Resultado del procesamiento de una fila.
+ */
+enum class EstadoFila {
+    IMPORTADA,
+    INVALIDA,
+    DUPLICADA
+};
+
+// Función auxiliar para convertir un campo completo a número
+template <typename T>
+static bool convertir(std::string_view campo, T& valor) {
+    const char* fin = campo.data() + campo.size();
+    std::from_chars_result resultado = std::from_chars(campo.data(), fin, valor);
+    return resultado.ec == std::errc() && resultado.ptr == fin;
+}
+
+// Función auxiliar para ejecutar una sentencia preparada y reiniciarla
+static void ejecutar(sqlite3* db, sqlite3_stmt* statement) {
+    int resultado = sqlite3_step(statement);
+    sqlite3_reset(statement);
+    if (resultado != SQLITE_DONE) {
+        throw std::runtime_error("Error al insertar en la base de datos: " + std::string(sqlite3_errmsg(db)));
+    }
+}
+
+/**
+ * @brief Recorre un archivo `.csv` y procesa cada fila dentro de transacciones grandes.
+ *
+ * La primera fila se omite si su primer campo no es un número (encabezado). Las filas con una cantidad
+ * de campos distinta a `columnas` se rechazan sin procesarlas.
+ *
+ * @param db Puntero a la base de datos SQLite.
+ * @param nombreArchivo Nombre del archivo a importar.
+ * @param columnas Cantidad de campos de cada fila.
+ * @param resultado Filas importadas y rechazadas.
+ * @param procesar Función que valida e inserta una fila; recibe los campos y el motivo de rechazo.
+ * @param antesDeConfirmar Función que se ejecuta dentro de cada transacción antes de confirmarla.
+ * @return `true` si se leyó todo el archivo, `false` en caso contrario.
+ */
+template <typename Procesar, typename AntesDeConfirmar>
+static bool importar(sqlite3* db, const std::string& nombreArchivo, size_t columnas,
+                     ResultadoImportacion& resultado, Procesar procesar, AntesDeConfirmar antesDeConfirmar) {
+    auto inicio = std::chrono::steady_clock::now();
+    resultado = ResultadoImportacion();
+    bool transaccionAbierta = false;
+
+    // Registra una fila rechazada
+    auto rechazar = [&](size_t fila, EstadoFila estado, std::string motivo) {
+        (estado == EstadoFila::DUPLICADA ? resultado.duplicadas : resultado.invalidas)++;
+        if (resultado.rechazos.size() < MAXIMO_DETALLE_RECHAZOS) {
+            resultado.rechazos.push_back({fila, std::move(motivo)});
+        }
+    };
+
+    try {
+        LectorCSV lector(nombreArchivo);
+        if (!lector.abierto()) {
+            throw std::runtime_error("Error: No se pudo abrir el archivo " + nombreArchivo + ".");
+        }
+
+        size_t pendientes = 0; // Filas insertadas en la transacción en curso
+        std::string motivo;
+        bool primeraFila = true;
+
+        // Confirma la transacción en curso
+        auto confirmar = [&]() {
+            antesDeConfirmar();
+            if (sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                throw std::runtime_error("Error al confirmar la transacción: " + std::string(sqlite3_errmsg(db)));
+            }
+            transaccionAbierta = false;
+            resultado.importadas += pendientes;
+            pendientes = 0;
+        };
+
+        while (lector.siguienteFila()) {
+            const std::vector<std::string_view>& campos = lector.getCampos();
+
+            // Omitir el encabezado
+            long long numero;
+            if (primeraFila && !convertir(campos[0], numero)) {
+                primeraFila = false;
+                continue;
+            }
+            primeraFila = false;
+            resultado.filas++;
+
+            if (campos.size() != columnas) {
+                rechazar(lector.getNumeroFila(), EstadoFila::INVALIDA,
+                         "Se esperaban " + std::to_string(columnas) + " campos y hay " + std::to_string(campos.size()) + ".");
+                continue;
+            }
+
+            if (!transaccionAbierta) {
+                if (sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+                    throw std::runtime_error("Error al iniciar la transacción: " + std::string(sqlite3_errmsg(db)));
+                }
+                transaccionAbierta = true;
+            }
+
+            motivo.clear();
+            EstadoFila estado = procesar(campos, motivo);
+            if (estado != EstadoFila::IMPORTADA) {
+                rechazar(lector.getNumeroFila(), estado, motivo);
+                continue;
+            }
+
+            if (++pendientes == FILAS_POR_TRANSACCION_IMPORTACION) {
+                confirmar();
+            }
+        }
+
+        if (transaccionAbierta) {
+            confirmar();
+        }
+
+        resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        return true;
+
+    } catch (const std::exception& e) {
+        if (transaccionAbierta) {
+            sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+        }
+        std::cerr << e.what() << std::endl;
+        resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        return false;
+    }
+}
+
+
+// Definición de método estático para importar clientes desde un archivo CSV
+bool ImportadorCSV::importarClientes(sqlite3* db, const std::string& nombreArchivo, ResultadoImportacion& resultado) {
+    try {
+        // Cédulas existentes, cargadas una sola vez
+        std::unordered_set<int> cedulas;
+        {
+            SQLiteStatement conteo(db, "SELECT COUNT(*) FROM Clientes;");
+            if (sqlite3_step(conteo.get()) == SQLITE_ROW) {
+                cedulas.reserve(static_cast<size_t>(sqlite3_column_int64(conteo.get(), 0)) * 2);
+            }
+            SQLiteStatement existentes(db, "SELECT cedula FROM Clientes;");
+            while (sqlite3_step(existentes.get()) == SQLITE_ROW) {
+                cedulas.insert(sqlite3_column_int(existentes.get(), 0));
+            }
+        }
+
+        // Las filas de cada transacción se guardan primero en una tabla temporal y se copian a Clientes con
+        // una sola sentencia: FTS5 escribe su índice en cada sentencia, por lo que los triggers de
+        // BusquedaClientes son mucho más lentos si cada cliente se inserta con su propia sentencia
+        if (sqlite3_exec(db, "CREATE TEMP TABLE IF NOT EXISTS ImportacionClientes (cedula INTEGER, nombre TEXT, "
+                             "primerApellido TEXT, segundoApellido TEXT, telefono TEXT); DELETE FROM temp.ImportacionClientes;",
+                         nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error al crear la tabla temporal: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        SQLiteStatement insercion(db, "INSERT INTO temp.ImportacionClientes VALUES (?, ?, ?, ?, ?);");
+        SQLiteStatement copia(db, "INSERT INTO Clientes (cedula, nombre, primerApellido, segundoApellido, telefono) "
+                                  "SELECT cedula, nombre, primerApellido, segundoApellido, telefono FROM temp.ImportacionClientes ORDER BY rowid;");
+        SQLiteStatement limpieza(db, "DELETE FROM temp.ImportacionClientes;");
+        sqlite3_stmt* statement = insercion.get();
+
+        return importar(db, nombreArchivo, 5, resultado, [&](const std::vector<std::string_view>& campos, std::string& motivo) {
+            int cedula;
+            if (!convertir(campos[0], cedula) || cedula <= 0) {
+                motivo = "Cédula inválida: " + std::string(campos[0]) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            if (campos[1].empty() || campos[2].empty()) {
+                motivo = "El nombre y el primer apellido son obligatorios.";
+                return EstadoFila::INVALIDA;
+            }
+            if (!campos[4].empty() && !esTelefonoValido(campos[4])) {
+                motivo = "Teléfono inválido: " + std::string(campos[4]) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            if (!cedulas.insert(cedula).second) {
+                motivo = "Ya existe un cliente con la cédula " + std::to_string(cedula) + ".";
+                return EstadoFila::DUPLICADA;
+            }
+
+            sqlite3_bind_int(statement, 1, cedula);
+            for (int c = 1; c < 5; c++) {
+                sqlite3_bind_text(statement, c + 1, campos[c].data(), static_cast<int>(campos[c].size()), SQLITE_STATIC);
+            }
+            ejecutar(db, statement);
+            return EstadoFila::IMPORTADA;
+        }, [&]() {
+            ejecutar(db, copia.get());
+            ejecutar(db, limpieza.get());
+        });
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Definición de método estático para importar cuentas desde un archivo CSV
+bool ImportadorCSV::importarCuentas(sqlite3* db, const std::string& nombreArchivo, ResultadoImportacion& resultado) {
+    try {
+        // Clientes por cédula y cuentas existentes por cliente y moneda, cargados una sola vez
+        std::unordered_map<int, int> clientes;
+        {
+            SQLiteStatement existentes(db, "SELECT cedula, idCliente FROM Clientes;");
+            while (sqlite3_step(existentes.get()) == SQLITE_ROW) {
+                clientes.emplace(sqlite3_column_int(existentes.get(), 0), sqlite3_column_int(existentes.get(), 1));
+            }
+        }
+
+        // Clave de una cuenta: ID del cliente y moneda
+        auto clave = [](int idCliente, Moneda moneda) {
+            return static_cast<long long>(idCliente) * CANTIDAD_MONEDAS + static_cast<int>(moneda);
+        };
+
+        std::unordered_set<long long> cuentas;
+        {
+            SQLiteStatement existentes(db, "SELECT idCliente, moneda FROM Cuentas;");
+            while (sqlite3_step(existentes.get()) == SQLITE_ROW) {
+                cuentas.insert(clave(sqlite3_column_int(existentes.get(), 0), monedaSegunValor(sqlite3_column_int(existentes.get(), 1))));
+            }
+        }
+
+        SQLiteStatement insercionCuenta(db, "INSERT INTO Cuentas (idCliente, moneda, saldo, tasaInteres) VALUES (?, ?, ?, ?);");
+        SQLiteStatement insercionDeposito(db, SQL_CREAR_TRANSACCION);
+
+        return importar(db, nombreArchivo, 4, resultado, [&](const std::vector<std::string_view>& campos, std::string& motivo) {
+            int cedula;
+            double saldo, tasaInteres;
+
+            if (!convertir(campos[0], cedula)) {
+                motivo = "Cédula inválida: " + std::string(campos[0]) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            auto cliente = clientes.find(cedula);
+            if (cliente == clientes.end()) {
+                motivo = "No existe un cliente con la cédula " + std::to_string(cedula) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            int indiceMoneda = indiceCodigo(campos[1], MONEDAS, CANTIDAD_MONEDAS);
+            if (indiceMoneda < 0) {
+                motivo = "Moneda inválida: " + std::string(campos[1]) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            Moneda moneda = static_cast<Moneda>(indiceMoneda);
+            if (!convertir(campos[2], saldo) || saldo < 0) {
+                motivo = "Saldo inválido: " + std::string(campos[2]) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            if (!convertir(campos[3], tasaInteres) || tasaInteres < 0) {
+                motivo = "Tasa de interés inválida: " + std::string(campos[3]) + ".";
+                return EstadoFila::INVALIDA;
+            }
+            if (!cuentas.insert(clave(cliente->second, moneda)).second) {
+                motivo = "El cliente " + std::to_string(cedula) + " ya tiene una cuenta en " + std::string(campos[1]) + ".";
+                return EstadoFila::DUPLICADA;
+            }
+
+            sqlite3_bind_int(insercionCuenta.get(), 1, cliente->second);
+            sqlite3_bind_int(insercionCuenta.get(), 2, valor(moneda));
+            sqlite3_bind_double(insercionCuenta.get(), 3, saldo);
+            sqlite3_bind_double(insercionCuenta.get(), 4, tasaInteres);
+            ejecutar(db, insercionCuenta.get());
+
+            // Depósito inicial, igual que al crear la cuenta desde el menú
+            if (saldo > 0) {
+                sqlite3_bind_null(insercionDeposito.get(), 1); // Un depósito no tiene remitente
+                sqlite3_bind_int64(insercionDeposito.get(), 2, sqlite3_last_insert_rowid(db));
+                sqlite3_bind_int(insercionDeposito.get(), 3, valor(TipoTransaccion::DEPOSITO));
+                sqlite3_bind_double(insercionDeposito.get(), 4, saldo);
+                ejecutar(db, insercionDeposito.get());
+            }
+            return EstadoFila::IMPORTADA;
+        }, []() {});
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Definición de método estático para mostrar el resultado de una importación
+void ImportadorCSV::mostrarResultado(const ResultadoImportacion& resultado) {
+    std::cout << "Filas leídas: " << resultado.filas << ", importadas: " << resultado.importadas
+              << ", inválidas: " << resultado.invalidas << ", duplicadas: " << resultado.duplicadas << std::endl;
+    std::cout << "Tiempo: " << resultado.segundos << " s";
+    if (resultado.segundos > 0) {
+        std::cout << " (" << static_cast<long long>(resultado.importadas / resultado.segundos) << " filas/s)";
+    }
+    std::cout << std::endl;
+
+    for (const RechazoImportacion& rechazo : resultado.rechazos) {
+        std::cout << "  Fila " << rechazo.fila << ": " << rechazo.motivo << std::endl;
+    }
+    size_t rechazadas = resultado.invalidas + resultado.duplicadas;
+    if (rechazadas > resultado.rechazos.size()) {
+        std::cout << "  ... y " << rechazadas - resultado.rechazos.size() << " filas rechazadas más." << std::endl;
+    }
+}
@@ -0,0 +1,162 @@
+/**
+ * @file LectorCSV.cpp
+ * @brief Implementación de la clase LectorCSV para leer archivos `.csv` grandes.
+ * @details Este archivo contiene la definición de los métodos de la clase LectorCSV.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "LectorCSV.hpp"
+#include <cstring>
+
+// Definición del constructor de la clase LectorCSV
+LectorCSV::LectorCSV(const std::string& nombreArchivo)
+    : archivo(std::fopen(nombreArchivo.c_str(), "rb")), buffer(TAMANO_BUFFER_LECTURA_CSV) {}
+
+// Definición del destructor de la clase LectorCSV
+LectorCSV::~LectorCSV() {
+    if (archivo != nullptr) {
+        std::fclose(archivo);
+    }
+}
+
+
+bool LectorCSV::abierto() const {
+    return archivo != nullptr;
+}
+
+const std::vector<std::string_view>& LectorCSV::getCampos() const {
+    return campos;
+}
+
+size_t LectorCSV::getNumeroFila() const {
+    return numeroFila;
+}
+
+// Definición de método privado para leer el siguiente bloque del archivo
+bool LectorCSV::leerBloque() {
+    if (archivo == nullptr || finArchivo) {
+        return false;
+    }
+
+    // Conservar la fila incompleta al inicio del buffer
+    if (inicio > 0) {
+        std::memmove(buffer.data(), buffer.data() + inicio, fin - inicio);
+        fin -= inicio;
+        inicio = 0;
+    }
+
+    // Una fila más grande que el buffer duplica su tamaño
+    if (fin == buffer.size()) {
+        buffer.resize(buffer.size() * 2);
+    }
+
+    size_t leidos = std::fread(buffer.data() + fin, 1, buffer.size() - fin, archivo);
+    fin += leidos;
+    if (leidos == 0) {
+        finArchivo = true;
+    }
+    return leidos > 0;
+}
+
+// Definición de método para leer la siguiente fila del archivo
+bool LectorCSV::siguienteFila() {
+    if (archivo == nullptr) {
+        return false;
+    }
+
+    while (true) {
+        // Buscar el final de la fila, ignorando los saltos de línea entre comillas
+        size_t finFila = inicio;
+        bool completa = false;
+
+        const char* datos = buffer.data();
+        const char* salto = static_cast<const char*>(std::memchr(datos + inicio, '\n', fin - inicio));
+        size_t limite = salto != nullptr ? static_cast<size_t>(salto - datos) : fin;
+
+        if (std::memchr(datos + inicio, '"', limite - inicio) == nullptr) {
+            finFila = limite;
+            completa = salto != nullptr;
+        } else {
+            bool entreComillas = false;
+            for (finFila = inicio; finFila < fin; finFila++) {
+                if (datos[finFila] == '"') {
+                    entreComillas = !entreComillas;
+                } else if (datos[finFila] == '\n' && !entreComillas) {
+                    completa = true;
+                    break;
+                }
+            }
+        }
+
+        if (!completa && !finArchivo) {
+            leerBloque();
+            continue;
+        }
+        if (!completa && finFila == inicio) {
+            return false; // Fin del archivo
+        }
+
+        size_t siguiente = completa ? finFila + 1 : finFila;
+        numeroFila++;
+
+        // Quitar el retorno de carro de los finales de línea "\r\n"
+        if (finFila > inicio && buffer[finFila - 1] == '\r') {
+            finFila--;
+        }
+
+        // Las líneas vacías se omiten
+        if (finFila == inicio) {
+            inicio = siguiente;
+            continue;
+        }
+
+        // Separar los campos, quitando las comillas en el mismo buffer
+        campos.clear();
+        char* actual = buffer.data() + inicio;
+        char* final = buffer.data() + finFila;
+
+        while (true) {
+            char* campo = actual;
+            char* escritura = actual;
+
+            if (actual < final && *actual == '"') {
+                actual++;
+                while (actual < final) {
+                    if (*actual == '"') {
+                        if (actual + 1 < final && actual[1] == '"') {
+                            *escritura++ = '"';
+                            actual += 2;
+                            continue;
+                        }
+                        actual++;
+                        break;
+                    }
+                    *escritura++ = *actual++;
+                }
+                // Ignorar lo que quede hasta la siguiente coma
+                while (actual < final && *actual != ',') {
+                    actual++;
+                }
+            } else {
+                while (actual < final && *actual != ',') {
+                    actual++;
+                }
+                escritura = actual;
+            }
+
+            campos.emplace_back(campo, static_cast<size_t>(escritura - campo));
+
+            if (actual == final) {
+                break;
+            }
+            actual++; // Saltar la coma
+        }
+
+        inicio = siguiente;
+        return true;
+    }
+}
@@ -0,0 +1,573 @@
+/**
+ * @file LibroMayor.cpp
+ * @brief Implementación de la clase LibroMayor, un libro de saldos en memoria con escritura diferida.
+ * @details Este archivo contiene la definición del cerrojo de giro, de las operaciones en memoria con
+ *          cerrojos por fragmento, del hilo escritor que guarda los registros ordenados por lotes y de
+ *          la prueba de transferencias concurrentes.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "LibroMayor.hpp"
+#include "ColeccionesCartera.hpp"
+#include "Consultas.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+/// @brief Tiempo de espera de la conexión del escritor cuando otra conexión tiene el bloqueo de escritura.
+constexpr int ESPERA_OCUPADA_LIBRO_MS = 5000;
+
+/// @brief Diferencia máxima entre el saldo en memoria y el de la base de datos para considerarlos iguales.
+constexpr double TOLERANCIA_LIBRO = 1e-6;
+
+// Función auxiliar para obtener los segundos transcurridos desde un instante
+static double segundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+// Definición de función para obtener el mensaje de un estado del libro
+const char* mensajeEstado(EstadoLibro estado) {
+    switch (estado) {
+        case EstadoLibro::OK: return "Operación realizada.";
+        case EstadoLibro::CUENTA_INEXISTENTE: return "Error: La cuenta no existe.";
+        case EstadoLibro::MONTO_INVALIDO: return "Error: El monto debe ser positivo.";
+        case EstadoLibro::FONDOS_INSUFICIENTES: return "Error: Fondos insuficientes.";
+        case EstadoLibro::MONEDA_DISTINTA: return "Error: Las cuentas no tienen la misma moneda.";
+        case EstadoLibro::ESCRITURA_FALLIDA: return "Error: El libro mayor no puede guardar sus movimientos; la operación no se aplicó.";
+    }
+    return "Error: Estado desconocido.";
+}
+
+// Definición de método para tomar el cerrojo de giro
+void CerrojoGiro::lock() noexcept {
+    while (ocupado.exchange(true, std::memory_order_acquire)) {
+        // Esperar solo leyendo la bandera, para no invalidar la línea de caché del dueño en cada intento
+        for (int giro = 0; ocupado.load(std::memory_order_relaxed); giro++) {
+            if (giro >= GIROS) {
+                std::this_thread::yield();
+                giro = 0;
+            } else {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
+            }
+        }
+    }
+}
+
+
+// Definición del constructor de la clase LibroMayor
+LibroMayor::LibroMayor(const std::string& nombreDB)
+    : fragmentos(std::make_unique<FragmentoLibro[]>(FRAGMENTOS_LIBRO)), db(nombreDB) {
+
+    sqlite3_busy_timeout(db.get(), ESPERA_OCUPADA_LIBRO_MS);
+    if (sqlite3_exec(db.get(), "PRAGMA journal_mode = WAL;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Error al configurar la conexión: " + std::string(sqlite3_errmsg(db.get())));
+    }
+
+    ColeccionCuentas cuentas;
+    if (!cuentas.cargar(db.get())) {
+        throw std::runtime_error("Error al cargar las cuentas del libro mayor.");
+    }
+
+    // Las cuentas están ordenadas por ID, por lo que la mayor define el tamaño de cada fragmento
+    if (cuentas.cantidad() > 0) {
+        size_t posiciones = static_cast<size_t>(cuentas.idCuenta.back()) / FRAGMENTOS_LIBRO + 1;
+        for (int f = 0; f < FRAGMENTOS_LIBRO; f++) {
+            fragmentos[f].cuentas.resize(posiciones);
+        }
+    }
+    for (size_t i = 0; i < cuentas.cantidad(); i++) {
+        int id = cuentas.idCuenta[i];
+        fragmentos[id % FRAGMENTOS_LIBRO].cuentas[id / FRAGMENTOS_LIBRO] = {cuentas.saldo[i], cuentas.moneda[i], true};
+    }
+
+    escritor = std::thread(&LibroMayor::escribir, this);
+}
+
+// Definición del destructor de la clase LibroMayor
+LibroMayor::~LibroMayor() {
+    cerrar();
+}
+
+
+// Definición de método privado para buscar una cuenta en su fragmento
+CuentaLibro* LibroMayor::buscar(int idCuenta) {
+    std::vector<CuentaLibro>& cuentas = fragmentos[idCuenta % FRAGMENTOS_LIBRO].cuentas;
+    size_t posicion = static_cast<size_t>(idCuenta / FRAGMENTOS_LIBRO);
+    if (posicion >= cuentas.size() || !cuentas[posicion].existe) {
+        return nullptr;
+    }
+    return &cuentas[posicion];
+}
+
+// Definición de método privado para anotar un movimiento en el registro de un fragmento
+void LibroMayor::registrar(FragmentoLibro& fragmento, int idRemitente, int idDestinatario, TipoTransaccion tipo, double monto) {
+    // La secuencia se toma con el cerrojo del fragmento, por lo que respeta el orden de cada cuenta
+    uint64_t numero = secuencia.fetch_add(1, std::memory_order_relaxed);
+    fragmento.registro.push_back({numero, idRemitente, idDestinatario, tipo, monto});
+    pendientes.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Definición de método privado para esperar al escritor si el registro creció demasiado
+bool LibroMayor::limitarPendientes() {
+    if (fallido.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (pendientes.load(std::memory_order_relaxed) < MAXIMO_PENDIENTES_LIBRO) {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> bloqueo(mutex);
+    urgente = true;
+    condicionEscritor.notify_one();
+    condicionGuardado.wait(bloqueo, [this] {
+        return cerrado || fallido.load(std::memory_order_relaxed) ||
+               pendientes.load(std::memory_order_relaxed) < MAXIMO_PENDIENTES_LIBRO / 2;
+    });
+    return !fallido.load(std::memory_order_relaxed);
+}
+
+
+// Definición de método para depositar un monto en una cuenta
+EstadoLibro LibroMayor::depositar(int idCuenta, double monto, double* saldo) {
+    if (!(monto > 0) || !std::isfinite(monto)) {
+        return EstadoLibro::MONTO_INVALIDO;
+    }
+    if (idCuenta <= 0) {
+        return EstadoLibro::CUENTA_INEXISTENTE;
+    }
+    // Se espera antes de aplicar la operación, para no modificar un saldo que no se podría guardar
+    if (!limitarPendientes()) {
+        return EstadoLibro::ESCRITURA_FALLIDA;
+    }
+
+    FragmentoLibro& fragmento = fragmentos[idCuenta % FRAGMENTOS_LIBRO];
+    {
+        std::lock_guard<CerrojoGiro> guardia(fragmento.cerrojo);
+        CuentaLibro* cuenta = buscar(idCuenta);
+        if (!cuenta) {
+            return EstadoLibro::CUENTA_INEXISTENTE;
+        }
+
+        cuenta->saldo += monto;
+        registrar(fragmento, -1, idCuenta, TipoTransaccion::DEPOSITO, monto);
+        if (saldo) *saldo = cuenta->saldo;
+    }
+
+    return EstadoLibro::OK;
+}
+
+// Definición de método para retirar un monto de una cuenta
+EstadoLibro LibroMayor::retirar(int idCuenta, double monto, double* saldo) {
+    if (!(monto > 0) || !std::isfinite(monto)) {
+        return EstadoLibro::MONTO_INVALIDO;
+    }
+    if (idCuenta <= 0) {
+        return EstadoLibro::CUENTA_INEXISTENTE;
+    }
+    // Se espera antes de aplicar la operación, para no modificar un saldo que no se podría guardar
+    if (!limitarPendientes()) {
+        return EstadoLibro::ESCRITURA_FALLIDA;
+    }
+
+    FragmentoLibro& fragmento = fragmentos[idCuenta % FRAGMENTOS_LIBRO];
+    {
+        std::lock_guard<CerrojoGiro> guardia(fragmento.cerrojo);
+        CuentaLibro* cuenta = buscar(idCuenta);
+        if (!cuenta) {
+            return EstadoLibro::CUENTA_INEXISTENTE;
+        }
+        if (cuenta->saldo < monto) {
+            return EstadoLibro::FONDOS_INSUFICIENTES;
+        }
+
+        cuenta->saldo -= monto;
+        registrar(fragmento, idCuenta, -1, TipoTransaccion::RETIRO, monto);
+        if (saldo) *saldo = cuenta->saldo;
+    }
+
+    return EstadoLibro::OK;
+}
+
+// Definición de método para transferir un monto entre dos cuentas
+EstadoLibro LibroMayor::transferir(int idCuenta, int idCuentaDestino, double monto, double* saldo) {
+    if (!(monto > 0) || !std::isfinite(monto)) {
+        return EstadoLibro::MONTO_INVALIDO;
+    }
+    if (idCuenta <= 0 || idCuentaDestino <= 0) {
+        return EstadoLibro::CUENTA_INEXISTENTE;
+    }
+    if (!limitarPendientes()) {
+        return EstadoLibro::ESCRITURA_FALLIDA;
+    }
+
+    // Los cerrojos se toman siempre en orden de fragmento, por lo que no puede haber un ciclo de espera
+    int origen = idCuenta % FRAGMENTOS_LIBRO;
+    int destino = idCuentaDestino % FRAGMENTOS_LIBRO;
+    {
+        std::lock_guard<CerrojoGiro> primero(fragmentos[std::min(origen, destino)].cerrojo);
+        std::unique_lock<CerrojoGiro> segundo(fragmentos[std::max(origen, destino)].cerrojo, std::defer_lock);
+        if (origen != destino) {
+            segundo.lock();
+        }
+
+        CuentaLibro* remitente = buscar(idCuenta);
+        CuentaLibro* destinatario = buscar(idCuentaDestino);
+        if (!remitente || !destinatario) {
+            return EstadoLibro::CUENTA_INEXISTENTE;
+        }
+        if (remitente->moneda != destinatario->moneda) {
+            return EstadoLibro::MONEDA_DISTINTA;
+        }
+        if (remitente->saldo < monto) {
+            return EstadoLibro::FONDOS_INSUFICIENTES;
+        }
+
+        remitente->saldo -= monto;
+        destinatario->saldo += monto;
+        registrar(fragmentos[origen], idCuenta, idCuentaDestino, TipoTransaccion::TRANSFERENCIA, monto);
+        if (saldo) *saldo = remitente->saldo;
+    }
+
+    return EstadoLibro::OK;
+}
+
+// Definición de método para consultar el saldo de una cuenta en memoria
+bool LibroMayor::verSaldo(int idCuenta, double& saldo) {
+    if (idCuenta <= 0) {
+        return false;
+    }
+
+    std::lock_guard<CerrojoGiro> guardia(fragmentos[idCuenta % FRAGMENTOS_LIBRO].cerrojo);
+    CuentaLibro* cuenta = buscar(idCuenta);
+    if (!cuenta) {
+        return false;
+    }
+    saldo = cuenta->saldo;
+    return true;
+}
+
+
+// Definición de método privado para vaciar los registros de todos los fragmentos
+std::vector<MovimientoLibro> LibroMayor::vaciarRegistros(std::vector<std::vector<MovimientoLibro>>& repuestos) {
+    // Con todos los cerrojos tomados ninguna operación está a medias, por lo que no falta ningún
+    // movimiento con un número de secuencia menor al último del lote
+    for (int f = 0; f < FRAGMENTOS_LIBRO; f++) {
+        fragmentos[f].cerrojo.lock();
+    }
+    for (int f = 0; f < FRAGMENTOS_LIBRO; f++) {
+        repuestos[f].swap(fragmentos[f].registro);
+    }
+    for (int f = FRAGMENTOS_LIBRO - 1; f >= 0; f--) {
+        fragmentos[f].cerrojo.unlock();
+    }
+
+    size_t total = 0;
+    for (const std::vector<MovimientoLibro>& registro : repuestos) {
+        total += registro.size();
+    }
+
+    std::vector<MovimientoLibro> movimientos;
+    movimientos.reserve(total);
+    for (std::vector<MovimientoLibro>& registro : repuestos) {
+        movimientos.insert(movimientos.end(), registro.begin(), registro.end());
+        registro.clear();
+    }
+
+    // Cada registro ya está ordenado; el orden global se obtiene al ordenar el lote completo
+    std::sort(movimientos.begin(), movimientos.end(), [](const MovimientoLibro& a, const MovimientoLibro& b) {
+        return a.secuencia < b.secuencia;
+    });
+    return movimientos;
+}
+
+// Definición de método privado para guardar un lote de movimientos
+bool LibroMayor::guardar(const std::vector<MovimientoLibro>& movimientos, uint64_t& cuentasActualizadas) {
+    sqlite3* conexion = db.get();
+
+    try {
+        // IMMEDIATE toma el bloqueo de escritura al inicio, en vez de fallar al actualizar la primera cuenta
+        if (sqlite3_exec(conexion, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error al iniciar la transacción del libro mayor: " + std::string(sqlite3_errmsg(conexion)));
+        }
+
+        std::unordered_map<int, double> cambios;
+        SQLiteStatement insertar(conexion, SQL_CREAR_TRANSACCION);
+        for (const MovimientoLibro& movimiento : movimientos) {
+            if (movimiento.idRemitente != -1) {
+                sqlite3_bind_int(insertar.get(), 1, movimiento.idRemitente);
+                cambios[movimiento.idRemitente] -= movimiento.monto;
+            } else {
+                sqlite3_bind_null(insertar.get(), 1);
+            }
+            if (movimiento.idDestinatario != -1) {
+                sqlite3_bind_int(insertar.get(), 2, movimiento.idDestinatario);
+                cambios[movimiento.idDestinatario] += movimiento.monto;
+            } else {
+                sqlite3_bind_null(insertar.get(), 2);
+            }
+            sqlite3_bind_int(insertar.get(), 3, valor(movimiento.tipo));
+            sqlite3_bind_double(insertar.get(), 4, movimiento.monto);
+
+            if (sqlite3_step(insertar.get()) != SQLITE_DONE) {
+                throw std::runtime_error("Error al registrar el movimiento: " + std::string(sqlite3_errmsg(conexion)));
+            }
+            sqlite3_reset(insertar.get());
+        }
+
+        // Una sola actualización por cuenta, aunque tenga muchos movimientos en el lote
+        SQLiteStatement sumar(conexion, SQL_SUMAR_SALDO);
+        for (const auto& [idCuenta, cambio] : cambios) {
+            sqlite3_bind_double(sumar.get(), 1, cambio);
+            sqlite3_bind_int(sumar.get(), 2, idCuenta);
+            if (sqlite3_step(sumar.get()) != SQLITE_DONE) {
+                throw std::runtime_error("Error al actualizar el saldo: " + std::string(sqlite3_errmsg(conexion)));
+            }
+            sqlite3_reset(sumar.get());
+        }
+
+        if (sqlite3_exec(conexion, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error al confirmar la transacción del libro mayor: " + std::string(sqlite3_errmsg(conexion)));
+        }
+        cuentasActualizadas = cambios.size();
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        if (!sqlite3_get_autocommit(conexion) && sqlite3_exec(conexion, "ROLLBACK;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            std::cerr << "Error: No se pudo realizar el rollback." << std::endl;
+        }
+        return false;
+    }
+}
+
+// Definición de método privado con el ciclo del hilo escritor
+void LibroMayor::escribir() {
+    std::vector<std::vector<MovimientoLibro>> repuestos(FRAGMENTOS_LIBRO);
+    std::vector<MovimientoLibro> lote;
+    int fallos = 0;
+
+    while (true) {
+        bool terminar;
+        {
+            std::unique_lock<std::mutex> bloqueo(mutex);
+            condicionEscritor.wait_for(bloqueo, std::chrono::milliseconds(ESPERA_ESCRITOR_LIBRO_MS),
+                                       [this] { return cerrado || urgente; });
+            terminar = cerrado;
+            urgente = false;
+        }
+
+        // Un lote que falló se conserva y se guarda junto con los movimientos nuevos
+        std::vector<MovimientoLibro> nuevos = vaciarRegistros(repuestos);
+        if (lote.empty()) {
+            lote.swap(nuevos);
+        } else {
+            lote.insert(lote.end(), nuevos.begin(), nuevos.end());
+        }
+        if (lote.empty()) {
+            if (terminar) {
+                break;
+            }
+            continue;
+        }
+
+        auto inicio = std::chrono::steady_clock::now();
+        uint64_t cuentasActualizadas = 0;
+        bool exito = guardar(lote, cuentasActualizadas);
+        double segundos = segundosDesde(inicio);
+
+        bool abandonar = false;
+        {
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            contadores.segundosEscritura += segundos;
+            if (exito) {
+                contadores.guardados += lote.size();
+                contadores.lotes++;
+                contadores.cuentasActualizadas += cuentasActualizadas;
+                pendientes.fetch_sub(lote.size(), std::memory_order_relaxed);
+                fallos = 0;
+                fallido.store(false, std::memory_order_relaxed);
+            } else {
+                contadores.errores++;
+                fallos++;
+                // Las operaciones y persistir dejan de esperar un lote que no se puede guardar
+                if (fallos >= REINTENTOS_ESCRITOR_LIBRO) {
+                    fallido.store(true, std::memory_order_relaxed);
+                    abandonar = terminar;
+                }
+                if (abandonar) {
+                    contadores.sinGuardar = lote.size();
+                }
+            }
+        }
+        condicionGuardado.notify_all();
+
+        if (exito) {
+            lote.clear();
+        } else if (abandonar) {
+            std::cerr << "Error: No se guardaron " << lote.size() << " movimientos del libro mayor después de "
+                      << fallos << " intentos." << std::endl;
+            break;
+        }
+    }
+}
+
+// Definición de método para esperar a que se guarden los movimientos aplicados
+bool LibroMayor::persistir() {
+    // Los movimientos con secuencia menor a `objetivo` ya están en algún registro, porque la secuencia se
+    // toma y el movimiento se anota bajo el mismo cerrojo
+    uint64_t objetivo = secuencia.load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> bloqueo(mutex);
+    urgente = true;
+    condicionEscritor.notify_one();
+    condicionGuardado.wait(bloqueo, [this, objetivo] {
+        return cerrado || fallido.load(std::memory_order_relaxed) || contadores.guardados >= objetivo;
+    });
+    return contadores.guardados >= objetivo;
+}
+
+// Definición de método para guardar los movimientos pendientes y detener el escritor
+bool LibroMayor::cerrar() {
+    {
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        cerrado = true;
+    }
+    condicionEscritor.notify_one();
+    if (escritor.joinable()) {
+        escritor.join();
+    }
+    condicionGuardado.notify_all();
+
+    std::lock_guard<std::mutex> bloqueo(mutex);
+    return contadores.sinGuardar == 0;
+}
+
+// Definición de método para contar las cuentas con saldo distinto en la base de datos
+long long LibroMayor::diferencias(sqlite3* conexion) {
+    ColeccionCuentas cuentas;
+    if (!cuentas.cargar(conexion)) {
+        return -1;
+    }
+
+    long long distintas = 0;
+    for (size_t i = 0; i < cuentas.cantidad(); i++) {
+        double saldo = 0;
+        if (!verSaldo(cuentas.idCuenta[i], saldo) || std::abs(saldo - cuentas.saldo[i]) > TOLERANCIA_LIBRO) {
+            distintas++;
+        }
+    }
+    return distintas;
+}
+
+// Definición de método para obtener los contadores del libro
+EstadisticasLibro LibroMayor::estadisticas() {
+    std::lock_guard<std::mutex> bloqueo(mutex);
+    EstadisticasLibro copia = contadores;
+    copia.aplicados = secuencia.load(std::memory_order_relaxed);
+    return copia;
+}
+
+
+// Definición de método estático para ejecutar la prueba de transferencias concurrentes
+ResultadoPruebaLibro LibroMayor::probar(LibroMayor& libro, const std::vector<int>& cuentas,
+                                        unsigned int hilos, long long transferencias) {
+    ResultadoPruebaLibro resultado;
+    resultado.hilos = std::max(1u, hilos);
+    resultado.transferencias = transferencias;
+    if (cuentas.size() < 2 || transferencias <= 0) {
+        return resultado;
+    }
+
+    std::atomic<bool> iniciar{false};
+    std::atomic<long long> exitosas{0};
+    std::atomic<long long> rechazadas{0};
+    std::vector<std::thread> trabajadores;
+
+    for (unsigned int h = 0; h < resultado.hilos; h++) {
+        long long cantidad = transferencias / resultado.hilos + (h < transferencias % resultado.hilos ? 1 : 0);
+        trabajadores.emplace_back([&, h, cantidad] {
+            std::mt19937 generador(h + 1);
+            std::uniform_int_distribution<size_t> elegir(0, cuentas.size() - 1);
+            long long propias = 0;
+            long long fallidas = 0;
+
+            // Todos los hilos comienzan a la vez, para no medir el tiempo de crearlos
+            while (!iniciar.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (long long i = 0; i < cantidad; i++) {
+                size_t origen = elegir(generador);
+                size_t destino = elegir(generador);
+                if (origen == destino) {
+                    destino = (destino + 1) % cuentas.size();
+                }
+                if (libro.transferir(cuentas[origen], cuentas[destino], 1.0) == EstadoLibro::OK) {
+                    propias++;
+                } else {
+                    fallidas++;
+                }
+            }
+            exitosas += propias;
+            rechazadas += fallidas;
+        });
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    iniciar.store(true, std::memory_order_release);
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    resultado.segundosMemoria = segundosDesde(inicio);
+
+    auto inicioGuardado = std::chrono::steady_clock::now();
+    if (!libro.persistir()) {
+        std::cerr << "Error: El libro mayor no pudo guardar las transferencias de la prueba." << std::endl;
+    }
+    resultado.segundosGuardado = segundosDesde(inicioGuardado);
+
+    resultado.exitosas = exitosas.load();
+    resultado.rechazadas = rechazadas.load();
+    return resultado;
+}
+
+// Definición de método estático para mostrar el resultado de las pruebas
+void LibroMayor::mostrarResultado(const std::vector<ResultadoPruebaLibro>& resultados, const EstadisticasLibro& estadisticas) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Resultado del Libro Mayor ===" << std::endl;
+    // setw cuenta bytes, por lo que la columna con tilde necesita uno más
+    std::cout << std::setw(6) << "Hilos" << std::setw(16) << "Transferencias" << std::setw(12) << "Rechazadas"
+              << std::setw(13) << "Memoria (s)" << std::setw(14) << "Op/s" << std::setw(14) << "Aceleración"
+              << std::setw(14) << "Guardado (s)" << std::endl;
+
+    double base = 0;
+    for (const ResultadoPruebaLibro& resultado : resultados) {
+        double porSegundo = resultado.segundosMemoria > 0 ? resultado.transferencias / resultado.segundosMemoria : 0;
+        if (base == 0) {
+            base = porSegundo;
+        }
+        std::cout << std::setw(6) << resultado.hilos << std::setw(16) << resultado.transferencias
+                  << std::setw(12) << resultado.rechazadas << std::setw(13) << resultado.segundosMemoria
+                  << std::setw(14) << porSegundo << std::setw(12) << (base > 0 ? porSegundo / base : 0) << "x"
+                  << std::setw(14) << resultado.segundosGuardado << std::endl;
+    }
+
+    std::cout << "\nMovimientos aplicados: " << estadisticas.aplicados << ", guardados: " << estadisticas.guardados << std::endl;
+    std::cout << "Lotes: " << estadisticas.lotes << ", cuentas actualizadas: " << estadisticas.cuentasActualizadas
+              << ", intentos fallidos: " << estadisticas.errores << std::endl;
+    if (estadisticas.segundosEscritura > 0) {
+        std::cout << "Escritura en la base de datos: " << estadisticas.guardados / estadisticas.segundosEscritura
+                  << " movimientos/s" << std::endl;
+    }
+}
@@ -0,0 +1,241 @@
+/**
+ * @file Lote.cpp
+ * @brief Implementación de la clase Lote para ejecutar scripts de operaciones sin interacción.
+ * @details Este archivo contiene la definición de los métodos de la clase Lote, que permiten leer
+ *          un script de operaciones, ejecutarlas directamente sobre la base de datos y mostrar el
+ *          resumen de tiempos y fallos de la ejecución.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Lote.hpp"
+#include "Cliente.hpp"
+#include "Cuenta.hpp"
+#include "Prestamo.hpp"
+#include "CapturaSalida.hpp"
+#include "constants.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+
+// Función auxiliar para leer un argumento obligatorio de la línea
+template <typename T>
+static T leerArgumento(std::istringstream& argumentos, const char* nombre) {
+    T valor;
+    if (!(argumentos >> valor)) {
+        throw std::invalid_argument(std::string("Error: Falta o es inválido el argumento '") + nombre + "'.");
+    }
+    return valor;
+}
+
+// Función auxiliar para leer un monto positivo de la línea
+static double leerMonto(std::istringstream& argumentos, const char* nombre) {
+    double monto = leerArgumento<double>(argumentos, nombre);
+    if (monto <= 0) {
+        throw std::invalid_argument(std::string("Error: El argumento '") + nombre + "' debe ser positivo.");
+    }
+    return monto;
+}
+
+// Función auxiliar para obtener una cuenta existente a partir de su ID
+static Cuenta leerCuenta(sqlite3* db, std::istringstream& argumentos, const char* nombre) {
+    Cuenta cuenta = Cuenta::obtener(db, leerArgumento<int>(argumentos, nombre));
+    if (cuenta.getID() == 0) {
+        throw std::invalid_argument("Error: La cuenta no existe.");
+    }
+    return cuenta;
+}
+
+
+// Definición del constructor de la clase Lote
+Lote::Lote(sqlite3* db) : db(db) {}
+
+
+// Definición de método privado para ejecutar una operación
+bool Lote::ejecutarOperacion(int indice, std::istringstream& argumentos) {
+    switch (indice) {
+        case 0: { // NEW_CLIENT
+            int cedula = leerArgumento<int>(argumentos, "cedula");
+            std::string nombre = leerArgumento<std::string>(argumentos, "nombre");
+            std::string primerApellido = leerArgumento<std::string>(argumentos, "primerApellido");
+            std::string segundoApellido = leerArgumento<std::string>(argumentos, "segundoApellido");
+            std::string telefono = leerArgumento<std::string>(argumentos, "telefono");
+
+            Cliente cliente(cedula, nombre, primerApellido,
+                            segundoApellido == "-" ? "" : segundoApellido, telefono == "-" ? "" : telefono);
+            return cliente.crear(db);
+        }
+        case 1: { // NEW_ACCOUNT
+            Cliente cliente = Cliente::obtener(db, leerArgumento<int>(argumentos, "cedula"));
+            Moneda moneda = monedaSegunCodigo(leerArgumento<std::string>(argumentos, "moneda"));
+            double saldoInicial = leerArgumento<double>(argumentos, "saldoInicial");
+            double tasaInteres = leerArgumento<double>(argumentos, "tasaInteres");
+
+            if (cliente.getID() == 0) {
+                throw std::invalid_argument("Error: El cliente no existe.");
+            }
+
+            // Igual que en el menú: la cuenta se crea sin saldo y luego se deposita el saldo inicial
+            Cuenta cuenta(cliente.getID(), moneda, 0, tasaInteres);
+            if (!cuenta.crear(db)) {
+                return false;
+            }
+            return saldoInicial <= 0 || cuenta.depositar(db, saldoInicial);
+        }
+        case 2: { // DEP
+            Cuenta cuenta = leerCuenta(db, argumentos, "idCuenta");
+            return cuenta.depositar(db, leerMonto(argumentos, "monto"));
+        }
+        case 3: { // RET
+            Cuenta cuenta = leerCuenta(db, argumentos, "idCuenta");
+            return cuenta.retirar(db, leerMonto(argumentos, "monto"));
+        }
+        case 4: { // TRA
+            Cuenta cuenta = leerCuenta(db, argumentos, "idCuentaOrigen");
+            int idCuentaDestino = leerArgumento<int>(argumentos, "idCuentaDestino");
+            return cuenta.transferir(db, idCuentaDestino, leerMonto(argumentos, "monto"));
+        }
+        case 5: { // ABO
+            Prestamo prestamo = Prestamo::obtener(db, leerArgumento<int>(argumentos, "idPrestamo"));
+            Cuenta cuenta = leerCuenta(db, argumentos, "idCuenta");
+
+            int cuotas = 1;
+            if (!(argumentos >> std::ws).eof()) {
+                cuotas = leerArgumento<int>(argumentos, "cuotas");
+            }
+
+            if (prestamo.getID() == 0) {
+                throw std::invalid_argument("Error: El préstamo no existe.");
+            }
+            return prestamo.abonarCuotas(db, cuenta, cuotas);
+        }
+        case 6: { // CDP
+            Cuenta cuenta = leerCuenta(db, argumentos, "idCuenta");
+            double monto = leerMonto(argumentos, "monto");
+            int plazoMeses = leerArgumento<int>(argumentos, "plazoMeses");
+            double tasaInteres = leerMonto(argumentos, "tasaInteres");
+
+            return cuenta.solicitarCDP(db, cuenta.getMoneda(), monto, plazoMeses, tasaInteres);
+        }
+        case 7: { // LOAN
+            Cuenta cuenta = leerCuenta(db, argumentos, "idCuenta");
+            TipoPrestamo tipo = tipoPrestamoSegunCodigo(leerArgumento<std::string>(argumentos, "tipo"));
+            ValoresPrestamo valores = Prestamo::obtenerValoresPredeterminados(tipo, cuenta.getMoneda());
+
+            // Monto, plazo y tasa opcionales: se indican los tres o ninguno
+            if (!(argumentos >> std::ws).eof()) {
+                valores.monto = leerMonto(argumentos, "monto");
+                valores.plazoMeses = leerArgumento<int>(argumentos, "plazoMeses");
+                valores.tasaInteres = leerMonto(argumentos, "tasaInteres");
+            }
+
+            Prestamo prestamo(cuenta.getID(), tipo, cuenta.getMoneda(),
+                              valores.monto, valores.tasaInteres, valores.plazoMeses);
+            return prestamo.crear(db);
+        }
+        default:
+            return false;
+    }
+}
+
+
+// Definición de método para ejecutar todas las operaciones de un flujo de entrada
+ResultadoLote Lote::ejecutar(std::istream& entrada) {
+    ResultadoLote resultado;
+    auto inicio = std::chrono::steady_clock::now();
+
+    // Descartar la salida de cada operación y guardar sus mensajes de error
+    CapturaSalida captura;
+
+    std::string linea;
+    int numeroLinea = 0;
+
+    while (std::getline(entrada, linea)) {
+        numeroLinea++;
+
+        // Ignorar comentarios y líneas vacías
+        size_t comentario = linea.find('#');
+        if (comentario != std::string::npos) {
+            linea.erase(comentario);
+        }
+
+        std::istringstream argumentos(linea);
+        std::string operacion;
+        if (!(argumentos >> operacion)) {
+            continue;
+        }
+
+        resultado.lineas++;
+
+        int indice = 0;
+        while (indice < CANTIDAD_OPERACIONES_LOTE && operacion != OPERACIONES_LOTE[indice]) {
+            indice++;
+        }
+
+        if (indice == CANTIDAD_OPERACIONES_LOTE) {
+            resultado.fallos.push_back({numeroLinea, "Error: Operación desconocida: " + operacion + "."});
+            continue;
+        }
+
+        captura.tomarErrores(); // Descartar mensajes anteriores a la operación
+        bool exito = false;
+        auto inicioOperacion = std::chrono::steady_clock::now();
+
+        try {
+            exito = ejecutarOperacion(indice, argumentos);
+        } catch (const std::exception& e) {
+            flujoErrores() << e.what() << std::endl;
+        }
+
+        EstadisticasOperacion& estadisticas = resultado.operaciones[indice];
+        estadisticas.ejecutadas++;
+        estadisticas.segundos += std::chrono::duration<double>(std::chrono::steady_clock::now() - inicioOperacion).count();
+
+        if (!exito) {
+            estadisticas.fallidas++;
+
+            // Unir los mensajes de error de la operación en una sola línea
+            std::string detalle = captura.tomarErrores();
+            for (size_t i = detalle.find('\n'); i != std::string::npos; i = detalle.find('\n', i)) {
+                detalle.replace(i, 1, " | ");
+            }
+            resultado.fallos.push_back({numeroLinea, detalle});
+        }
+    }
+
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
+
+
+// Definición de método estático para mostrar el resumen de un lote
+void Lote::mostrarResumen(const ResultadoLote& resultado) {
+    std::cout << "\n=== Resumen del Lote ===" << std::endl;
+    std::cout << std::left << std::setw(14) << "Operación" << std::right
+              << std::setw(12) << "Ejecutadas" << std::setw(10) << "Fallidas"
+              << std::setw(14) << "Tiempo (ms)" << std::setw(16) << "Promedio (us)" << std::endl;
+
+    for (int i = 0; i < CANTIDAD_OPERACIONES_LOTE; i++) {
+        const EstadisticasOperacion& estadisticas = resultado.operaciones[i];
+        if (estadisticas.ejecutadas == 0) {
+            continue;
+        }
+
+        std::cout << std::left << std::setw(13) << OPERACIONES_LOTE[i] << std::right
+                  << std::setw(12) << estadisticas.ejecutadas << std::setw(10) << estadisticas.fallidas
+                  << std::setw(14) << estadisticas.segundos * 1e3
+                  << std::setw(16) << estadisticas.segundos * 1e6 / estadisticas.ejecutadas << std::endl;
+    }
+
+    std::cout << "Líneas: " << resultado.lineas << ", fallidas: " << resultado.fallos.size()
+              << ", tiempo total: " << resultado.segundos * 1e3 << " ms" << std::endl;
+
+    for (const FalloLote& fallo : resultado.fallos) {
+        std::cout << "Línea " << fallo.linea << ": " << fallo.detalle << std::endl;
+    }
+}
@@ -14,12 +14,19 @@
 #include "Menu.hpp"
 #include "Prestamo.hpp"
 #include "Cliente.hpp"
+#include "Cliente360.hpp"
 #include "Cuenta.hpp"
 #include "auxiliares.hpp"
 #include "constants.hpp"
 #include "CDP.hpp"
+#include "TablaCuotas.hpp"
+#include "Mora.hpp"
+#include "EstadoCuenta.hpp"
+#include "ReporteCartera.hpp"
+#include <iomanip>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 // -------------------------------- Menú principal --------------------------------
 
@@ -74,6 +81,10 @@ void menuOperacionesCliente(sqlite3* db, Cuenta& cuenta) {
                 realizarRetiro(db, cuenta);
                 break;
             }
+            case OperacionesCliente::EXPORTAR_ESTADO_CUENTA: {
+                exportarEstadoCuenta(db, cuenta);
+                break;
+            }
             case OperacionesCliente::REGRESAR: {
                 std::cout << "Regresando al menú de atención al cliente." << std::endl;
                 break;
@@ -96,7 +107,8 @@ void mostrarMenuOperaciones() {
     std::cout << "5. Depósito" << std::endl;
     std::cout << "6. Transferencia" << std::endl;
     std::cout << "7. Retiro" << std::endl;
-    std::cout << "8. Regresar" << std::endl;
+    std::cout << "8. Exportar Estado de Cuenta" << std::endl;
+    std::cout << "9. Regresar" << std::endl;
     std::cout << "Seleccione una opción: ";
 }
 
@@ -113,10 +125,10 @@ void manejarCDP(sqlite3* db, Cuenta& cuenta) {
     switch (static_cast<OpcionesCDP>(opcionCDP)) {
         case OpcionesCDP::SOLICITAR: {
             // Solicitar un nuevo CDP
-            std::string moneda = cuenta.getMoneda();
-            const ValoresCDP& valoresPredeterminados = (moneda == "CRC") ? CDP_DEF::Colones : CDP_DEF::Dolares;
+            Moneda moneda = cuenta.getMoneda();
+            const ValoresCDP& valoresPredeterminados = (moneda == Moneda::CRC) ? CDP_DEF::Colones : CDP_DEF::Dolares;
 
-            std::cout << "\nValores predeterminados para " << (moneda == "CRC" ? "Colones" : "Dólares") << ":\n";
+            std::cout << "\nValores predeterminados para " << (moneda == Moneda::CRC ? "Colones" : "Dólares") << ":\n";
             std::cout << "Monto Total: " << valoresPredeterminados.monto << std::endl;
             std::cout << "Plazo en Meses: " << valoresPredeterminados.plazoMeses << std::endl;
             std::cout << "Tasa de Interés Anual: " << valoresPredeterminados.tasaInteres << "%" << std::endl;
@@ -209,18 +221,8 @@ void manejarAbonoPrestamo(sqlite3* db, Cuenta& cuenta) {
 
             prestamo.mostrarInformacionPago();
 
-            // Confirmar el abono
-            std::cout << "¿Desea realizar el abono de la cuota mensual? (s/n): ";
-            bool confirmar = validarRespuestaSN();
-
-            if (confirmar) {
-                if (prestamo.abonarCuota(db, cuenta)) {
-                    std::cout << "Abono realizado con éxito." << std::endl;
-                } else {
-                    std::cerr << "Error al realizar el abono." << std::endl;
-                }
-            } else {
-                std::cout << "Abono cancelado por el usuario." << std::endl;
+            if (realizarAbonoPrestamo(db, prestamo, cuenta)) {
+                std::cout << "Abono realizado con éxito." << std::endl;
             }
             break;
         }
@@ -238,18 +240,8 @@ void manejarAbonoPrestamo(sqlite3* db, Cuenta& cuenta) {
 
             prestamo.mostrarInformacionPago();
 
-            // Confirmar el abono
-            std::cout << "¿Desea realizar el abono de la cuota mensual al préstamo de terceros? (s/n): ";
-            bool confirmar = validarRespuestaSN();
-
-            if (confirmar) {
-                if (prestamo.abonarCuota(db, cuenta)) {
-                    std::cout << "Abono realizado con éxito al préstamo de terceros." << std::endl;
-                } else {
-                    std::cerr << "Error al realizar el abono." << std::endl;
-                }
-            } else {
-                std::cout << "Abono cancelado por el usuario." << std::endl;
+            if (realizarAbonoPrestamo(db, prestamo, cuenta)) {
+                std::cout << "Abono realizado con éxito al préstamo de terceros." << std::endl;
             }
             break;
         }
@@ -262,6 +254,47 @@ void manejarAbonoPrestamo(sqlite3* db, Cuenta& cuenta) {
     }
 }
 
+
+// Realizar un abono a un préstamo según el tipo elegido
+bool realizarAbonoPrestamo(sqlite3* db, Prestamo& prestamo, Cuenta& cuenta) {
+    std::cout << "\n=== Tipo de Abono ===" << std::endl;
+    std::cout << "1. Cuota mensual" << std::endl;
+    std::cout << "2. Varias cuotas" << std::endl;
+    std::cout << "3. Abono extraordinario al capital" << std::endl;
+    std::cout << "4. Cancelar" << std::endl;
+    std::cout << "Seleccione una opción: ";
+
+    bool resultado = false;
+    switch (static_cast<TipoAbono>(obtenerEntero())) {
+        case TipoAbono::CUOTA_MENSUAL:
+            resultado = prestamo.abonarCuota(db, cuenta);
+            break;
+        case TipoAbono::VARIAS_CUOTAS: {
+            std::cout << "Ingrese la cantidad de cuotas a pagar: ";
+            int cantidadCuotas = obtenerEntero();
+            resultado = prestamo.abonarCuotas(db, cuenta, cantidadCuotas);
+            break;
+        }
+        case TipoAbono::CAPITAL: {
+            std::cout << "Ingrese el monto a abonar al capital: ";
+            double montoCapital = obtenerDecimal();
+            resultado = prestamo.abonarCapital(db, cuenta, montoCapital);
+            break;
+        }
+        case TipoAbono::CANCELAR:
+            std::cout << "Abono cancelado por el usuario." << std::endl;
+            return false;
+        default:
+            std::cerr << "Opción inválida. Intente nuevamente." << std::endl;
+            return false;
+    }
+
+    if (!resultado) {
+        std::cerr << "Error al realizar el abono." << std::endl;
+    }
+    return resultado;
+}
+
 // Realizar un depósito
 void realizarDeposito(sqlite3* db, Cuenta& cuenta) {
     std::cout << "Ingrese monto a depositar: ";
@@ -329,6 +362,33 @@ void realizarRetiro(sqlite3* db, Cuenta& cuenta) {
     }
 }
 
+// Exportar el estado de cuenta a un archivo (.csv)
+void exportarEstadoCuenta(sqlite3* db, Cuenta& cuenta) {
+    std::string desde = "";
+    std::string hasta = "";
+
+    // Preguntar si desea limitar el rango de fechas
+    std::cout << "¿Desea limitar el estado de cuenta a un rango de fechas? (s/n): ";
+    if (validarRespuestaSN()) {
+        std::cout << "Ingrese la fecha inicial (YYYY-MM-DD): ";
+        desde = validarFecha();
+
+        std::cout << "Ingrese la fecha final (YYYY-MM-DD): ";
+        hasta = validarFecha();
+
+        // Limpieza del buffer antes de usar getline
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+
+    std::cout << "Ingrese el nombre del archivo: ";
+    std::string nombreArchivo = obtenerArchivoCSV();
+
+    long long movimientos = EstadoCuenta::exportarCSV(db, cuenta.getID(), nombreArchivo, desde, hasta);
+    if (movimientos >= 0) {
+        std::cout << "Estado de cuenta exportado en " << nombreArchivo << " (" << movimientos << " movimientos)." << std::endl;
+    }
+}
+
 // -------------------------------- Menú de atención al cliente --------------------------------
 
 // Función principal para gestionar el menú de atención al cliente
@@ -348,6 +408,9 @@ void menuAtencionCliente(sqlite3* db) {
             case MenuAtencionClienteOpciones::REGISTRAR_CLIENTE:
                 registrarCliente(db);
                 break;
+            case MenuAtencionClienteOpciones::BUSCAR_CLIENTE:
+                buscarCliente(db);
+                break;
             case MenuAtencionClienteOpciones::REGRESAR:
                 // Opción para salir del menú de atención al cliente
                 std::cout << "Regresando al menú principal." << std::endl;
@@ -366,7 +429,8 @@ void mostrarMenuAtencion() {
     std::cout << "\n=== Menú de Atención al Cliente ===" << std::endl;
     std::cout << "1. Iniciar Sesión" << std::endl;
     std::cout << "2. Registrar Cliente" << std::endl;
-    std::cout << "3. Regresar" << std::endl;
+    std::cout << "3. Buscar Cliente" << std::endl;
+    std::cout << "4. Regresar" << std::endl;
     std::cout << "Seleccione una opción: ";
 }
 
@@ -377,14 +441,15 @@ void iniciarSesionCliente(sqlite3* db) {
     std::cout << "Ingrese la cédula del cliente: ";
     int cedula = obtenerEntero();
 
-    // Verificar si existe un cliente con la cédula ingresada y obtener el ID de ese cliente
-    Cliente cliente = Cliente::obtener(db, cedula);
-    int idCliente = cliente.getID();
+    // Cargar el cliente con sus cuentas, CDP, préstamos y movimientos recientes
+    VistaCliente360 vista;
 
     // Si no existe, se sale y vuelve a mostrar el menú
-    if (idCliente == 0) {
+    if (!Cliente360::cargar(db, cedula, vista)) {
         return;
     }
+    int idCliente = vista.idCliente;
+    Cliente360::mostrar(vista);
 
     std::cout << "\n=== Ingreso a cuenta ===" << std::endl;
     std::cout << "1. Crear nueva cuenta" << std::endl;
@@ -400,7 +465,7 @@ void iniciarSesionCliente(sqlite3* db) {
             // Opción de crear cuenta
 
             // Ingreso del tipo de moneda de la cuenta
-            std::string moneda = validarMoneda();
+            Moneda moneda = validarMoneda();
 
             // Ingreso del saldo inicial de la cuenta
             std::cout << "Ingrese saldo inicial: ";
@@ -494,6 +559,29 @@ void registrarCliente(sqlite3* db) {
     }
 }
 
+// Buscar clientes por nombre, apellidos o teléfono
+void buscarCliente(sqlite3* db) {
+    // Limpieza del buffer antes de usar getline
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::cout << "Ingrese nombre, apellidos o teléfono: ";
+    std::string texto;
+    std::getline(std::cin, texto);
+
+    std::vector<Cliente> clientes = Cliente::buscar(db, texto);
+    if (clientes.empty()) {
+        std::cout << "No se encontraron clientes." << std::endl;
+        return;
+    }
+
+    // Mostrar los clientes encontrados
+    std::cout << std::left << std::setw(13) << "Cédula" << std::setw(45) << "Nombre" << "Teléfono" << std::endl;
+    for (const Cliente& cliente : clientes) {
+        std::cout << std::setw(12) << cliente.getCedula() << std::setw(45) << cliente.getNombreCompleto() << cliente.getTelefono() << std::endl;
+    }
+    std::cout << std::right;
+}
+
 // -------------------------------- Menú de préstamos --------------------------------
 
 // Función principal para gestionar el menú de préstamos
@@ -511,6 +599,15 @@ void menuPrestamos(sqlite3* db) {
             case MenuPrestamosOpciones::CONSULTAR_PRESTAMOS:
                 consultarPrestamos(db);
                 break;
+            case MenuPrestamosOpciones::TABLA_CUOTAS:
+                generarTablaCuotas();
+                break;
+            case MenuPrestamosOpciones::REPORTE_MORA:
+                reporteMora(db);
+                break;
+            case MenuPrestamosOpciones::REPORTE_CARTERA:
+                reporteCartera(db);
+                break;
             case MenuPrestamosOpciones::REGRESAR:
                 std::cout << "Regresando al menú principal.\n";
                 break;
@@ -526,7 +623,10 @@ void mostrarMenuPrestamos() {
     std::cout << "\n=== Menú de Préstamos ===" << std::endl;
     std::cout << "1. Solicitar préstamo" << std::endl;
     std::cout << "2. Consultar préstamos" << std::endl;
-    std::cout << "3. Regresar" << std::endl;
+    std::cout << "3. Tabla de cuotas" << std::endl;
+    std::cout << "4. Reporte de mora" << std::endl;
+    std::cout << "5. Reporte de cartera" << std::endl;
+    std::cout << "6. Regresar" << std::endl;
     std::cout << "Seleccione una opción: ";
 }
 
@@ -540,28 +640,21 @@ void solicitarPrestamo(sqlite3* db) {
     std::cout << "Opción: ";
 
     int tipoSeleccionado = obtenerEntero();
-    std::string tipoPrestamo;
-
-    if (tipoSeleccionado == static_cast<int>(TipoPrestamo::PERSONAL))
-        tipoPrestamo = "PER";
-    else if (tipoSeleccionado == static_cast<int>(TipoPrestamo::PRENDARIO))
-        tipoPrestamo = "PRE";
-    else if (tipoSeleccionado == static_cast<int>(TipoPrestamo::HIPOTECARIO))
-        tipoPrestamo = "HIP";
-    else {
+    if (tipoSeleccionado < static_cast<int>(TipoPrestamo::PERSONAL) || tipoSeleccionado > static_cast<int>(TipoPrestamo::HIPOTECARIO)) {
         std::cout << "Error: Tipo de préstamo inválido. Regresando al menú de préstamos." << std::endl;
         return;
     }
+    TipoPrestamo tipoPrestamo = static_cast<TipoPrestamo>(tipoSeleccionado);
 
     // Variables para almacenar los datos de creación del préstamo
     double monto, tasaInteres, cuotaMensual;
     int plazoMeses;
 
     // Selección de moneda
-    std::string moneda = validarMoneda();
+    Moneda moneda = validarMoneda();
 
     // Mostrar valores predeterminados
-    struct ValoresPrestamo valoresPrestamo = Prestamo::obtenerValoresPredeterminados(static_cast<TipoPrestamo>(tipoSeleccionado), moneda);
+    struct ValoresPrestamo valoresPrestamo = Prestamo::obtenerValoresPredeterminados(tipoPrestamo, moneda);
 
     // Verificar que sea un struct válido
     if (valoresPrestamo.monto == 0.0) {
@@ -659,4 +752,109 @@ void consultarPrestamos(sqlite3* db) {
     if (!Prestamo::consultarEstado(db, idPrestamo, nombreArchivo)) {
         std::cerr << "Error: No se pudo consultar el estado del préstamo.\n";
     }
-}
\ No newline at end of file
+}
+
+
+// Generar una tabla de cuotas por plazo y tasa
+void generarTablaCuotas() {
+    std::cout << "\n=== Tabla de Cuotas ===" << std::endl;
+    std::cout << "Seleccione el tipo de préstamo:" << std::endl;
+    std::cout << "1. Personal" << std::endl;
+    std::cout << "2. Prendario" << std::endl;
+    std::cout << "3. Hipotecario" << std::endl;
+    std::cout << "Opción: ";
+
+    int tipoSeleccionado = obtenerEntero();
+    if (tipoSeleccionado < static_cast<int>(TipoPrestamo::PERSONAL) || tipoSeleccionado > static_cast<int>(TipoPrestamo::HIPOTECARIO)) {
+        std::cout << "Error: Tipo de préstamo inválido. Regresando al menú de préstamos." << std::endl;
+        return;
+    }
+
+    // Selección de moneda
+    Moneda moneda = validarMoneda();
+
+    RangoTablaCuotas rango = TablaCuotasDef::RANGO;
+    std::cout << "\nRango predeterminado: plazos de " << rango.plazoMinimo << " a " << rango.plazoMaximo
+              << " meses, " << rango.cantidadTasas << " tasas entre " << rango.tasaMinima << "% y " << rango.tasaMaxima << "%." << std::endl;
+
+    // Preguntar si se desea modificar el rango
+    std::cout << "¿Desea modificar el rango de la tabla? (s/n): ";
+    if (validarRespuestaSN()) {
+        std::cout << "Ingrese el plazo máximo en meses: ";
+        rango.plazoMaximo = obtenerEntero();
+
+        std::cout << "Ingrese la tasa de interés mínima (%): ";
+        rango.tasaMinima = obtenerDecimal();
+
+        std::cout << "Ingrese la tasa de interés máxima (%): ";
+        rango.tasaMaxima = obtenerDecimal();
+
+        std::cout << "Ingrese la cantidad de tasas: ";
+        rango.cantidadTasas = obtenerEntero();
+    }
+
+    try {
+        auto tabla = TablaCuotas::obtener(static_cast<TipoPrestamo>(tipoSeleccionado), moneda, rango);
+
+        std::cout << "Tabla de " << tabla->cantidadPlazos() << " plazos x " << tabla->cantidadTasas()
+                  << " tasas para un monto de " << tabla->getMonto() << " calculada en "
+                  << tabla->getTiempoCalculo() / 1000.0 << " ms." << std::endl;
+
+        // Preguntar si desea exportar la tabla
+        std::cout << "¿Desea guardar la tabla en un archivo (.csv)? (s/n): ";
+        if (validarRespuestaSN()) {
+            std::cout << "Ingrese el nombre del archivo: ";
+            std::string nombreArchivo = obtenerArchivoCSV();
+
+            if (tabla->exportarCSV(nombreArchivo)) {
+                std::cout << "Tabla guardada en " << nombreArchivo << std::endl;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+}
+
+
+// Generar el reporte de mora de la cartera
+void reporteMora(sqlite3* db) {
+    // Corte de los días de atraso a la fecha actual
+    if (Mora::actualizar(db) < 0) {
+        std::cerr << "Error al actualizar los días de atraso." << std::endl;
+        return;
+    }
+
+    std::vector<FilaMora> filas = Mora::reporte(db);
+    Mora::mostrarReporte(filas);
+
+    if (filas.empty()) {
+        return;
+    }
+
+    // Preguntar si desea exportar el reporte
+    std::cout << "¿Desea guardar el reporte en un archivo (.csv)? (s/n): ";
+    if (validarRespuestaSN()) {
+        std::cout << "Ingrese el nombre del archivo: ";
+        std::string nombreArchivo = obtenerArchivoCSV();
+
+        if (Mora::exportarCSV(filas, nombreArchivo)) {
+            std::cout << "Reporte guardado en " << nombreArchivo << std::endl;
+        }
+    }
+}
+
+
+// Generar el reporte de estado de todos los préstamos
+void reporteCartera(sqlite3* db) {
+    // Limpieza del buffer antes de usar getline
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::cout << "Ingrese el nombre del archivo: ";
+    std::string nombreArchivo = obtenerArchivoCSV();
+
+    ResumenCartera resumen;
+    if (ReporteCartera::generar(db, nombreArchivo, resumen)) {
+        ReporteCartera::mostrarResumen(resumen);
+        std::cout << "Reporte guardado en " << nombreArchivo << std::endl;
+    }
+}
@@ -0,0 +1,538 @@
+/**
+ * @file MigracionBD.cpp
+ * @brief Implementación de la clase MigracionBD para actualizar el esquema de una base de datos existente.
+ * @details Este archivo contiene la definición de los métodos que copian las tablas de la versión 1 del
+ *          esquema a un archivo nuevo con la versión actual, aplican las migraciones posteriores sobre
+ *          el archivo en uso y verifican el plan de las sentencias del programa.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "MigracionBD.hpp"
+#include "Codigos.hpp"
+#include "EsquemaBD.hpp"
+#include "SQLiteStatement.hpp"
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @struct ColumnaVersion1
+ * @brief Columna de la tabla nueva y expresión que la obtiene de la tabla de la versión 1.
+ *
+ * Las bases de datos de la versión 1 creadas antes de agregar una columna no la tienen; en ese caso se
+ * usa `defecto`. Una columna sin valor por defecto debe existir en la tabla original.
+ */
+struct ColumnaVersion1 {
+    const char* nombre;
+    std::string expresion;
+    const char* defecto = nullptr;
+};
+
+/**
+ * @struct TablaVersion1
+ * @brief Tabla de la versión 1 del esquema y las columnas que se copian de ella.
+ */
+struct TablaVersion1 {
+    const char* nombre;
+    const char* llave;
+    std::vector<ColumnaVersion1> columnas;
+};
+
+/**
+ * @struct CerrarConexion
+ * @brief Cierra una conexión a la base de datos al destruir su `std::unique_ptr`.
+ */
+struct CerrarConexion {
+    void operator()(sqlite3* db) const {
+        sqlite3_close(db);
+    }
+};
+
+/// @brief Conexión a una base de datos que se cierra automáticamente.
+using Conexion = std::unique_ptr<sqlite3, CerrarConexion>;
+
+// Función auxiliar para construir la expresión que convierte un código de texto en su valor entero
+static std::string expresionValores(const std::string& columna, const char* const* codigos, int cantidad, int primerValor = 0) {
+    std::string expresion = "CASE " + columna;
+    for (int i = 0; i < cantidad; i++) {
+        expresion += std::string(" WHEN '") + codigos[i] + "' THEN " + std::to_string(primerValor + i);
+    }
+    return expresion + " END";
+}
+
+// Función auxiliar con las tablas de la versión 1, en el orden en que se copian
+static const std::vector<TablaVersion1>& tablasVersion1() {
+    // Los códigos desconocidos se convierten en NULL y la restricción NOT NULL detiene la migración
+    static const std::string MONEDA = expresionValores("moneda", MONEDAS, CANTIDAD_MONEDAS);
+    static const std::string TIPO_TRANSACCION = expresionValores("tipo", TIPOS_TRANSACCION, CANTIDAD_TIPOS_TRANSACCION);
+    static const std::string TIPO_PRESTAMO = expresionValores("tipo", TIPOS_PRESTAMO, CANTIDAD_TIPOS_PRESTAMO, valor(TipoPrestamo::PERSONAL));
+
+    static const std::vector<TablaVersion1> tablas = {
+        {"Clientes", "idCliente", {
+            {"idCliente", "idCliente"}, {"cedula", "cedula"}, {"nombre", "nombre"}, {"primerApellido", "primerApellido"},
+            {"segundoApellido", "segundoApellido"}, {"telefono", "telefono"}}},
+        {"Cuentas", "idCuenta", {
+            {"idCuenta", "idCuenta"}, {"idCliente", "idCliente"}, {"moneda", MONEDA}, {"saldo", "saldo"},
+            {"tasaInteres", "tasaInteres"}}},
+        {"CDP", "idCDP", {
+            {"idCDP", "idCDP"}, {"idCuenta", "idCuenta"}, {"moneda", MONEDA}, {"deposito", "deposito"},
+            {"plazoMeses", "plazoMeses"}, {"tasaInteres", "tasaInteres"}}},
+        {"Transacciones", "idTransaccion", {
+            // El importador de cuentas guardaba -1 como remitente de los depósitos iniciales; la cuenta inexistente queda nula
+            {"idTransaccion", "idTransaccion"}, {"idRemitente", "NULLIF(idRemitente, -1)"}, {"idDestinatario", "NULLIF(idDestinatario, -1)"},
+            {"tipo", TIPO_TRANSACCION}, {"monto", "monto"},
+            // Antes del estado de cuenta no se guardaba la fecha: los movimientos quedan con la de la migración
+            {"fecha", "fecha", "datetime('now')"}}},
+        {"Prestamos", "idPrestamo", {
+            {"idPrestamo", "idPrestamo"}, {"idCuenta", "idCuenta"}, {"tipo", TIPO_PRESTAMO}, {"moneda", MONEDA},
+            {"monto", "monto"}, {"tasaInteres", "tasaInteres"}, {"plazoMeses", "plazoMeses"}, {"cuotaMensual", "cuotaMensual"},
+            {"cuotasPagadas", "cuotasPagadas"}, {"capitalPagado", "capitalPagado"}, {"interesesPagados", "interesesPagados"},
+            {"activo", "activo"},
+            // Antes del control de la mora no se guardaba el vencimiento: la próxima cuota vence en un mes, sin atraso
+            {"fechaProximoPago", "fechaProximoPago", "date('now', '+1 month')"}, {"diasAtraso", "diasAtraso", "0"}}},
+        {"PagoPrestamos", "idPagoPrestamo", {
+            {"idPagoPrestamo", "idPagoPrestamo"}, {"idPrestamo", "idPrestamo"}, {"cuotaPagada", "cuotaPagada"},
+            {"aporteCapital", "aporteCapital"}, {"aporteIntereses", "aporteIntereses"}, {"saldoRestante", "saldoRestante"}}}
+    };
+    return tablas;
+}
+
+// Función auxiliar para abrir una conexión sin verificar la versión del esquema
+static Conexion abrir(const std::string& nombreDB, int flags) {
+    sqlite3* db = nullptr;
+    int resultado = sqlite3_open_v2(nombreDB.c_str(), &db, flags, nullptr);
+    Conexion conexion(db);
+    if (resultado != SQLITE_OK) {
+        throw std::runtime_error("Error al abrir la base de datos " + nombreDB + ": " + std::string(sqlite3_errmsg(db)));
+    }
+    return conexion;
+}
+
+// Función auxiliar para ejecutar uno o varios comandos SQL
+static void ejecutar(sqlite3* db, const std::string& sql) {
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Error al ejecutar la migración: " + std::string(sqlite3_errmsg(db)));
+    }
+}
+
+// Función auxiliar para obtener el primer valor de una consulta
+static long long consultarEntero(sqlite3* db, const std::string& sql) {
+    SQLiteStatement statement(db, sql);
+    return sqlite3_step(statement.get()) == SQLITE_ROW ? sqlite3_column_int64(statement.get(), 0) : 0;
+}
+
+// Función auxiliar para obtener los segundos transcurridos desde un instante
+static double segundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+// Función auxiliar para copiar una tabla por bloques, mostrando el avance
+static TablaMigrada copiarTabla(sqlite3* destino, const TablaVersion1& tabla, long long filasPorBloque) {
+    auto inicio = std::chrono::steady_clock::now();
+    TablaMigrada migrada{tabla.nombre};
+    long long total = consultarEntero(destino, std::string("SELECT COUNT(*) FROM origen.") + tabla.nombre + ";");
+
+    // Las columnas que faltan en la tabla original toman su valor por defecto
+    std::string columnas;
+    std::string expresiones;
+    {
+        SQLiteStatement existe(destino, "SELECT COUNT(*) FROM pragma_table_info(?1, 'origen') WHERE name = ?2;");
+        for (const ColumnaVersion1& columna : tabla.columnas) {
+            sqlite3_bind_text(existe.get(), 1, tabla.nombre, -1, SQLITE_STATIC);
+            sqlite3_bind_text(existe.get(), 2, columna.nombre, -1, SQLITE_STATIC);
+            bool existente = sqlite3_step(existe.get()) == SQLITE_ROW && sqlite3_column_int(existe.get(), 0) > 0;
+            sqlite3_reset(existe.get());
+
+            if (!existente && !columna.defecto) {
+                throw std::runtime_error("Error: La tabla " + std::string(tabla.nombre) + " no tiene la columna " + columna.nombre + ".");
+            }
+            columnas += (columnas.empty() ? "" : ", ") + std::string(columna.nombre);
+            expresiones += (expresiones.empty() ? "" : ", ") + (existente ? columna.expresion : std::string(columna.defecto));
+        }
+    }
+
+    // Cada bloque continúa después de la llave mayor copiada, recorriendo la tabla en orden por su llave primaria
+    SQLiteStatement copia(destino, std::string("INSERT INTO main.") + tabla.nombre + " (" + columnas + ") SELECT " +
+                                   expresiones + " FROM origen." + tabla.nombre + " WHERE " + tabla.llave +
+                                   " > ?1 ORDER BY " + tabla.llave + " LIMIT ?2;");
+    long long ultimaLlave = -1;
+
+    while (true) {
+        ejecutar(destino, "BEGIN;");
+        sqlite3_bind_int64(copia.get(), 1, ultimaLlave);
+        sqlite3_bind_int64(copia.get(), 2, filasPorBloque);
+        if (sqlite3_step(copia.get()) != SQLITE_DONE) {
+            throw std::runtime_error("Error al copiar la tabla " + std::string(tabla.nombre) + ": " + std::string(sqlite3_errmsg(destino)));
+        }
+        sqlite3_reset(copia.get());
+        long long copiadas = sqlite3_changes64(destino);
+        ultimaLlave = sqlite3_last_insert_rowid(destino);
+        ejecutar(destino, "COMMIT;");
+
+        if (copiadas == 0) {
+            break;
+        }
+        migrada.filas += copiadas;
+        std::cout << "\r  " << std::left << std::setw(16) << tabla.nombre << std::right << migrada.filas << " de " << total
+                  << " filas (" << (100 * migrada.filas / total) << "%)" << std::flush;
+    }
+    std::cout << "\r  " << std::left << std::setw(16) << tabla.nombre << std::right << migrada.filas << " de " << total
+              << " filas (100%)" << std::endl;
+
+    if (migrada.filas != total) {
+        throw std::runtime_error("Error: Se copiaron " + std::to_string(migrada.filas) + " de " + std::to_string(total) +
+                                 " filas de la tabla " + tabla.nombre + ".");
+    }
+
+    migrada.segundos = segundosDesde(inicio);
+    return migrada;
+}
+
+// Función auxiliar para ejecutar un paso de datos por bloques desde una llave hasta la mayor llave de la tabla
+static long long ejecutarPaso(sqlite3* db, const PasoDatos& paso, long long& ultimaLlave, long long filasPorBloque,
+                              int version, int indicePaso, bool enLinea) {
+    SQLiteStatement actualizacion(db, paso.sql);
+    SQLiteStatement progreso(db, "UPDATE ProgresoMigracion SET ultimaLlave = ?1 WHERE version = ?2 AND paso = ?3;");
+    const std::string consultaMayor = std::string("SELECT MAX(") + paso.llave + ") FROM " + paso.tabla + ";";
+    long long mayorLlave = consultarEntero(db, consultaMayor);
+    long long filas = 0;
+
+    while (ultimaLlave < mayorLlave) {
+        long long hasta = std::min(ultimaLlave + filasPorBloque, mayorLlave);
+
+        // El bloque y su avance se confirman juntos: al reanudar se continúa después de la última llave guardada
+        ejecutar(db, "BEGIN IMMEDIATE;");
+        sqlite3_bind_int64(actualizacion.get(), 1, ultimaLlave);
+        sqlite3_bind_int64(actualizacion.get(), 2, hasta);
+        if (sqlite3_step(actualizacion.get()) != SQLITE_DONE) {
+            throw std::runtime_error("Error al actualizar la tabla " + std::string(paso.tabla) + ": " + std::string(sqlite3_errmsg(db)));
+        }
+        sqlite3_reset(actualizacion.get());
+        filas += sqlite3_changes64(db);
+
+        if (enLinea) {
+            sqlite3_bind_int64(progreso.get(), 1, hasta);
+            sqlite3_bind_int(progreso.get(), 2, version);
+            sqlite3_bind_int(progreso.get(), 3, indicePaso);
+            if (sqlite3_step(progreso.get()) != SQLITE_DONE) {
+                throw std::runtime_error("Error al guardar el avance de la migración: " + std::string(sqlite3_errmsg(db)));
+            }
+            sqlite3_reset(progreso.get());
+        }
+        ejecutar(db, "COMMIT;");
+        ultimaLlave = hasta;
+
+        std::cout << "\r  " << std::left << std::setw(16) << paso.tabla << std::right << "llave " << ultimaLlave
+                  << " de " << mayorLlave << std::flush;
+
+        // Las filas insertadas mientras tanto se procesan antes de terminar el paso
+        if (ultimaLlave == mayorLlave) {
+            mayorLlave = consultarEntero(db, consultaMayor);
+        }
+        if (enLinea) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(PAUSA_ENTRE_BLOQUES_MS));
+        }
+    }
+    std::cout << "\r  " << std::left << std::setw(16) << paso.tabla << std::right << filas << " filas actualizadas" << std::endl;
+    return filas;
+}
+
+// Función auxiliar para copiar todas las páginas de una base de datos a otra con la API de respaldo
+static void copiarPaginas(sqlite3* destino, sqlite3* origen, const std::string& descripcion) {
+    sqlite3_backup* copia = sqlite3_backup_init(destino, "main", origen, "main");
+    if (!copia) {
+        throw std::runtime_error("Error al copiar " + descripcion + ": " + std::string(sqlite3_errmsg(destino)));
+    }
+    int resultado = sqlite3_backup_step(copia, -1);
+    sqlite3_backup_finish(copia);
+    if (resultado != SQLITE_DONE) {
+        throw std::runtime_error("Error al copiar " + descripcion + ": " + std::string(sqlite3_errstr(resultado)));
+    }
+}
+
+// Función auxiliar para reconstruir una base de datos de la versión 1 en un archivo nuevo con la versión actual
+static void reconstruirVersion1(const std::string& nombreDB, ResultadoMigracion& resultado, long long filasPorBloque) {
+    std::string nombreNuevo = nombreDB + ".v2";
+    std::string nombreRespaldo = nombreDB + ".v1";
+    if (std::filesystem::exists(nombreRespaldo)) {
+        throw std::runtime_error("Error: Ya existe el respaldo " + nombreRespaldo + "; muévalo antes de migrar.");
+    }
+
+    bool respaldoCreado = false;
+    try {
+        Conexion origen = abrir(nombreDB, SQLITE_OPEN_READWRITE);
+        sqlite3_busy_timeout(origen.get(), ESPERA_BLOQUEO_MIGRACION_MS);
+
+        // Salir del modo WAL solo es posible sin otras conexiones abiertas, lo que confirma el acceso exclusivo
+        std::string modoDiario;
+        {
+            SQLiteStatement consulta(origen.get(), "PRAGMA journal_mode;");
+            if (sqlite3_step(consulta.get()) == SQLITE_ROW) {
+                modoDiario = reinterpret_cast<const char*>(sqlite3_column_text(consulta.get(), 0));
+            }
+        }
+        if (modoDiario == "wal" && sqlite3_exec(origen.get(), "PRAGMA journal_mode = DELETE;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error: Otros programas tienen abierta la base de datos " + nombreDB +
+                                     "; ciérrelos antes de migrar desde la versión 1.");
+        }
+
+        // En modo exclusivo los bloqueos no se liberan al confirmar: nadie más escribe hasta cerrar la conexión
+        ejecutar(origen.get(), "PRAGMA locking_mode = EXCLUSIVE;");
+        ejecutar(origen.get(), "BEGIN IMMEDIATE;");
+        resultado.bytesAntes = static_cast<long long>(std::filesystem::file_size(nombreDB));
+
+        std::filesystem::remove(nombreNuevo);
+        {
+            // El archivo nuevo no necesita diario: si la migración falla se elimina y el original no cambia
+            Conexion destino = abrir(nombreNuevo, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+            ejecutar(destino.get(), "PRAGMA journal_mode = OFF; PRAGMA synchronous = OFF;");
+            {
+                SQLiteStatement adjuntar(destino.get(), "ATTACH DATABASE ? AS origen;");
+                sqlite3_bind_text(adjuntar.get(), 1, nombreDB.c_str(), -1, SQLITE_STATIC);
+                if (sqlite3_step(adjuntar.get()) != SQLITE_DONE) {
+                    throw std::runtime_error("Error al adjuntar la base de datos original: " + std::string(sqlite3_errmsg(destino.get())));
+                }
+            }
+
+            ejecutar(destino.get(), SQL_TABLAS);
+            std::cout << "Copiando tablas de " << nombreDB << " (versión 1)..." << std::endl;
+            for (const TablaVersion1& tabla : tablasVersion1()) {
+                resultado.tablas.push_back(copiarTabla(destino.get(), tabla, filasPorBloque));
+            }
+
+            // Las tablas ya tienen las columnas de la versión actual; solo faltan los datos de las migraciones posteriores
+            for (const Migracion& migracion : MIGRACIONES) {
+                for (size_t i = 0; i < migracion.datos.size(); i++) {
+                    const PasoDatos& paso = migracion.datos[i];
+                    long long desde = consultarEntero(destino.get(), std::string("SELECT COALESCE(MIN(") + paso.llave + "), 0) - 1 FROM " + paso.tabla + ";");
+                    ejecutarPaso(destino.get(), paso, desde, filasPorBloque, migracion.version, static_cast<int>(i), false);
+                }
+            }
+
+            // Los índices se construyen una sola vez con todas las filas, en lugar de actualizarse fila por fila
+            std::cout << "Creando índices..." << std::endl;
+            auto inicioIndices = std::chrono::steady_clock::now();
+            ejecutar(destino.get(), SQL_INDICES);
+            resultado.segundosIndices = segundosDesde(inicioIndices);
+
+            ejecutar(destino.get(), "DETACH DATABASE origen;");
+            ejecutar(destino.get(), "PRAGMA user_version = " + std::to_string(VERSION_ESQUEMA) + ";");
+        }
+
+        // Escribir en la transacción toma el bloqueo exclusivo, que se conserva hasta cerrar la conexión
+        ejecutar(origen.get(), "PRAGMA user_version = 1;");
+        ejecutar(origen.get(), "COMMIT;");
+
+        {
+            respaldoCreado = true;
+            Conexion respaldo = abrir(nombreRespaldo, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+            copiarPaginas(respaldo.get(), origen.get(), "el respaldo " + nombreRespaldo);
+        }
+
+        // El archivo original se sobrescribe en lugar de renombrarse: los programas que aún lo tengan abierto
+        // ven la versión nueva en su siguiente operación, en vez de seguir escribiendo en el respaldo
+        {
+            Conexion nuevo = abrir(nombreNuevo, SQLITE_OPEN_READONLY);
+            copiarPaginas(origen.get(), nuevo.get(), "la base de datos nueva");
+        }
+        respaldoCreado = false; // Desde aquí el respaldo es la única copia de la versión 1
+        if (modoDiario == "wal") {
+            ejecutar(origen.get(), "PRAGMA journal_mode = WAL;");
+        }
+        origen.reset();
+
+        std::filesystem::remove(nombreNuevo);
+        resultado.bytesDespues = static_cast<long long>(std::filesystem::file_size(nombreDB));
+        resultado.respaldo = nombreRespaldo;
+
+    } catch (...) {
+        // Si el original no se reemplazó, un respaldo incompleto impediría volver a intentarlo
+        std::error_code error;
+        std::filesystem::remove(nombreNuevo, error);
+        if (respaldoCreado) {
+            std::filesystem::remove(nombreRespaldo, error);
+        }
+        throw;
+    }
+}
+
+// Función auxiliar para aplicar una migración sobre la base de datos en uso
+static MigracionAplicada aplicarMigracion(sqlite3* db, const Migracion& migracion) {
+    auto inicio = std::chrono::steady_clock::now();
+    MigracionAplicada aplicada;
+    aplicada.version = migracion.version;
+    aplicada.descripcion = migracion.descripcion;
+    const std::string version = std::to_string(migracion.version);
+
+    std::cout << "Migración a la versión " << migracion.version << ": " << migracion.descripcion << std::endl;
+
+    // Sin pasos de datos, la migración completa es una sola transacción
+    if (migracion.datos.empty()) {
+        ejecutar(db, "BEGIN IMMEDIATE;");
+        ejecutar(db, migracion.esquema ? migracion.esquema : "");
+        ejecutar(db, migracion.final ? migracion.final : "");
+        ejecutar(db, "PRAGMA user_version = " + version + ";");
+        ejecutar(db, "COMMIT;");
+        aplicada.segundos = segundosDesde(inicio);
+        return aplicada;
+    }
+
+    // Las filas de ProgresoMigracion indican que el esquema ya se aplicó en una ejecución interrumpida
+    aplicada.reanudada =
+        consultarEntero(db, "SELECT COUNT(*) FROM sqlite_schema WHERE name = 'ProgresoMigracion';") > 0 &&
+        consultarEntero(db, "SELECT COUNT(*) FROM ProgresoMigracion WHERE version = " + version + ";") > 0;
+
+    if (!aplicada.reanudada) {
+        ejecutar(db, "BEGIN IMMEDIATE;");
+        ejecutar(db, migracion.esquema ? migracion.esquema : "");
+        ejecutar(db, "CREATE TABLE IF NOT EXISTS ProgresoMigracion ("
+                     "version INTEGER NOT NULL, paso INTEGER NOT NULL, ultimaLlave INTEGER NOT NULL, "
+                     "PRIMARY KEY (version, paso)) STRICT;");
+        for (size_t i = 0; i < migracion.datos.size(); i++) {
+            const PasoDatos& paso = migracion.datos[i];
+            ejecutar(db, "INSERT INTO ProgresoMigracion (version, paso, ultimaLlave) SELECT " + version + ", " +
+                         std::to_string(i) + ", COALESCE(MIN(" + paso.llave + "), 0) - 1 FROM " + paso.tabla + ";");
+        }
+        ejecutar(db, "COMMIT;");
+    }
+
+    auto ultimaLlave = [&](size_t indicePaso) {
+        return consultarEntero(db, "SELECT ultimaLlave FROM ProgresoMigracion WHERE version = " + version +
+                                   " AND paso = " + std::to_string(indicePaso) + ";");
+    };
+
+    for (size_t i = 0; i < migracion.datos.size(); i++) {
+        long long desde = ultimaLlave(i);
+        aplicada.filas += ejecutarPaso(db, migracion.datos[i], desde, FILAS_POR_BLOQUE_DATOS,
+                                       migracion.version, static_cast<int>(i), true);
+    }
+
+    // Última transacción: filas insertadas después del último bloque, sentencias finales y cambio de versión
+    ejecutar(db, "BEGIN IMMEDIATE;");
+    for (size_t i = 0; i < migracion.datos.size(); i++) {
+        SQLiteStatement actualizacion(db, migracion.datos[i].sql);
+        sqlite3_bind_int64(actualizacion.get(), 1, ultimaLlave(i));
+        sqlite3_bind_int64(actualizacion.get(), 2, std::numeric_limits<sqlite3_int64>::max());
+        if (sqlite3_step(actualizacion.get()) != SQLITE_DONE) {
+            throw std::runtime_error("Error al actualizar la tabla " + std::string(migracion.datos[i].tabla) + ": " +
+                                     std::string(sqlite3_errmsg(db)));
+        }
+        aplicada.filas += sqlite3_changes64(db);
+    }
+    ejecutar(db, migracion.final ? migracion.final : "");
+    ejecutar(db, "DROP TABLE ProgresoMigracion;");
+    ejecutar(db, "PRAGMA user_version = " + version + ";");
+    ejecutar(db, "COMMIT;");
+
+    aplicada.segundos = segundosDesde(inicio);
+    return aplicada;
+}
+
+// Función auxiliar para saber si una migración interrumpida guardó su avance en ProgresoMigracion
+static bool tieneAvance(const std::string& nombreDB) {
+    try {
+        Conexion db = abrir(nombreDB, SQLITE_OPEN_READONLY);
+        return consultarEntero(db.get(), "SELECT COUNT(*) FROM sqlite_schema WHERE name = 'ProgresoMigracion';") > 0 &&
+               consultarEntero(db.get(), "SELECT COUNT(*) FROM ProgresoMigracion;") > 0;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+
+// Definición de método estático para migrar una base de datos a la versión actual del esquema
+bool MigracionBD::migrar(const std::string& nombreDB, ResultadoMigracion& resultado, long long filasPorBloque) {
+    auto inicio = std::chrono::steady_clock::now();
+    resultado = ResultadoMigracion();
+
+    try {
+        if (!std::filesystem::exists(nombreDB)) {
+            throw std::runtime_error("Error: No existe la base de datos " + nombreDB + ".");
+        }
+
+        Conexion db = abrir(nombreDB, SQLITE_OPEN_READWRITE);
+        int version = static_cast<int>(consultarEntero(db.get(), "PRAGMA user_version;"));
+
+        // La versión 1 del esquema no registraba su número en user_version
+        if (version == 0) {
+            if (consultarEntero(db.get(), "SELECT COUNT(*) FROM sqlite_schema WHERE name = 'Cuentas';") == 0) {
+                throw std::runtime_error("Error: " + nombreDB + " no tiene las tablas del banco; créela con inicio_db.");
+            }
+            version = 1;
+        }
+        if (version > VERSION_ESQUEMA) {
+            throw std::runtime_error("Error: " + nombreDB + " está en la versión " + std::to_string(version) +
+                                     " del esquema, más reciente que la de este programa (" + std::to_string(VERSION_ESQUEMA) + ").");
+        }
+        resultado.versionAnterior = version;
+
+        if (version == 1) {
+            db.reset();
+            reconstruirVersion1(nombreDB, resultado, filasPorBloque);
+            db = abrir(nombreDB, SQLITE_OPEN_READWRITE);
+            version = VERSION_ESQUEMA;
+        }
+
+        // Las ventanillas pueden seguir operando: se espera por el bloqueo de escritura en lugar de fallar
+        sqlite3_busy_timeout(db.get(), ESPERA_BLOQUEO_MIGRACION_MS);
+        for (const Migracion& migracion : MIGRACIONES) {
+            if (migracion.version > version) {
+                resultado.migraciones.push_back(aplicarMigracion(db.get(), migracion));
+                version = migracion.version;
+            }
+        }
+        resultado.versionNueva = version;
+
+        bool planesValidos = PlanesConsulta::verificar(db.get(), resultado.planes);
+        resultado.segundos = segundosDesde(inicio);
+        return planesValidos;
+
+    } catch (const std::exception& e) {
+        std::cerr << std::endl << e.what() << std::endl;
+        resultado.reanudable = tieneAvance(nombreDB);
+        resultado.segundos = segundosDesde(inicio);
+        return false;
+    }
+}
+
+// Definición de método estático para mostrar el resultado de una migración
+void MigracionBD::mostrarResultado(const ResultadoMigracion& resultado) {
+    std::cout << "\n=== Resultado de la Migración ===" << std::endl;
+    if (resultado.versionAnterior == resultado.versionNueva) {
+        std::cout << "La base de datos ya está en la versión " << resultado.versionNueva << " del esquema." << std::endl;
+    } else {
+        std::cout << "Versión del esquema: " << resultado.versionAnterior << " -> " << resultado.versionNueva << std::endl;
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    if (!resultado.tablas.empty()) {
+        std::cout << "Reconstrucción desde la versión 1:" << std::endl;
+        std::cout << std::left << std::setw(16) << "Tabla" << std::right << std::setw(12) << "Filas" << std::setw(14) << "Tiempo (s)" << std::endl;
+        for (const TablaMigrada& tabla : resultado.tablas) {
+            std::cout << std::left << std::setw(16) << tabla.nombre << std::right << std::setw(12) << tabla.filas
+                      << std::setw(14) << tabla.segundos << std::endl;
+        }
+        std::cout << "Índices: " << resultado.segundosIndices << " s" << std::endl;
+        std::cout << "Tamaño del archivo: " << resultado.bytesAntes / (1024.0 * 1024.0) << " MiB -> "
+                  << resultado.bytesDespues / (1024.0 * 1024.0) << " MiB" << std::endl;
+        std::cout << "Respaldo de la base de datos original: " << resultado.respaldo << std::endl;
+    }
+
+    for (const MigracionAplicada& migracion : resultado.migraciones) {
+        std::cout << "Versión " << migracion.version << " (" << migracion.descripcion << "): " << migracion.filas
+                  << " filas actualizadas en " << migracion.segundos << " s" << (migracion.reanudada ? ", reanudada" : "") << std::endl;
+    }
+
+    std::cout << "Planes de las sentencias del programa:" << std::endl;
+    PlanesConsulta::mostrarResultado(resultado.planes);
+    std::cout << "Tiempo total: " << resultado.segundos << " s" << std::endl;
+}
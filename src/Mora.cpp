@@ -0,0 +1,123 @@
+/**
+ * @file Mora.cpp
+ * @brief Implementación de la clase Mora para el control de atrasos de la cartera de préstamos.
+ * @details Este archivo contiene la definición de los métodos de la clase Mora, que permiten realizar
+ *          el corte diario de los días de atraso, generar el reporte de antigüedad de la mora y
+ *          exportarlo en formato CSV.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Mora.hpp"
+#include "Codigos.hpp"
+#include "Consultas.hpp"
+#include "SQLiteStatement.hpp"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+
+// Definición de método estático para el corte diario de los días de atraso
+int Mora::actualizar(sqlite3* db, const std::string& fecha) {
+    try {
+        // Solo se visitan los préstamos vencidos (índice parcial idx_vencimiento_prestamos)
+        SQLiteStatement statement(db, SQL_ACTUALIZAR_MORA);
+
+        if (fecha.empty()) {
+            sqlite3_bind_text(statement.get(), 1, "now", -1, SQLITE_STATIC);
+        } else {
+            sqlite3_bind_text(statement.get(), 1, fecha.c_str(), -1, SQLITE_STATIC);
+        }
+
+        if (sqlite3_step(statement.get()) != SQLITE_DONE) {
+            throw std::runtime_error("Error: No se pudieron actualizar los días de atraso: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        return sqlite3_changes(db);
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+}
+
+
+// Definición de método estático para generar el reporte de antigüedad de la mora
+std::vector<FilaMora> Mora::reporte(sqlite3* db) {
+    std::vector<FilaMora> filas;
+
+    try {
+        // Lectura en orden del índice parcial idx_mora_prestamos, que cubre todas las columnas de la consulta
+        SQLiteStatement statement(db, SQL_REPORTE_MORA);
+
+        while (sqlite3_step(statement.get()) == SQLITE_ROW) {
+            FilaMora fila;
+            fila.moneda = codigo(monedaSegunValor(sqlite3_column_int(statement.get(), 0)));
+            fila.tipo = codigo(tipoPrestamoSegunValor(sqlite3_column_int(statement.get(), 1)));
+
+            for (int r = 0; r < CANTIDAD_RANGOS_MORA; r++) {
+                fila.prestamos[r] = sqlite3_column_int(statement.get(), 2 + r);
+                fila.saldo[r] = sqlite3_column_double(statement.get(), 2 + CANTIDAD_RANGOS_MORA + r);
+            }
+
+            filas.push_back(fila);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+
+    return filas;
+}
+
+
+// Definición de método estático para mostrar el reporte de mora
+void Mora::mostrarReporte(const std::vector<FilaMora>& filas) {
+    if (filas.empty()) {
+        std::cout << "No hay préstamos activos." << std::endl;
+        return;
+    }
+
+    std::cout << "\n=== Reporte de Mora (días de atraso) ===" << std::endl;
+    std::cout << std::setw(8) << "Moneda" << std::setw(6) << "Tipo";
+    for (const char* rango : RANGOS_MORA) {
+        std::cout << std::setw(8) << rango << std::setw(16) << "Saldo";
+    }
+    std::cout << std::endl;
+
+    for (const FilaMora& fila : filas) {
+        std::cout << std::setw(8) << fila.moneda << std::setw(6) << fila.tipo;
+        for (int r = 0; r < CANTIDAD_RANGOS_MORA; r++) {
+            std::cout << std::setw(8) << fila.prestamos[r] << std::setw(16) << fila.saldo[r];
+        }
+        std::cout << std::endl;
+    }
+}
+
+
+// Definición de método estático para exportar el reporte de mora en formato CSV
+bool Mora::exportarCSV(const std::vector<FilaMora>& filas, const std::string& nombreArchivo) {
+    std::ofstream archivo(nombreArchivo);
+
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo para guardar el reporte de mora." << std::endl;
+        return false;
+    }
+
+    archivo << std::fixed << std::setprecision(2); // Salida con dos decimales
+    archivo << "Moneda,Tipo,Rango,Prestamos,Saldo\n";
+
+    for (const FilaMora& fila : filas) {
+        for (int r = 0; r < CANTIDAD_RANGOS_MORA; r++) {
+            archivo << fila.moneda << "," << fila.tipo << "," << RANGOS_MORA[r] << ","
+                    << fila.prestamos[r] << "," << fila.saldo[r] << "\n";
+        }
+    }
+
+    archivo.close();
+    return !archivo.fail();
+}
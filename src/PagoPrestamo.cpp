@@ -12,8 +12,11 @@
  * @date 28/11/2024
  */
 #include "PagoPrestamo.hpp"
+#include "Consultas.hpp"
 #include "SQLiteStatement.hpp"
+#include "CapturaSalida.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
@@ -29,10 +32,7 @@ PagoPrestamo::PagoPrestamo(int idPrestamo, double cuotaPagada, double aporteCapi
 bool PagoPrestamo::crear(sqlite3* db) {
     try {
         // Consulta para insertar el pago en la tabla
-        std::string sql = R"(
-            INSERT INTO PagoPrestamos (idPrestamo, cuotaPagada, aporteCapital, aporteIntereses, saldoRestante)
-            VALUES (?, ?, ?, ?, ?);
-        )";
+        std::string sql = SQL_CREAR_PAGO_PRESTAMO;
 
         // Crear statement y preparar la consulta
         SQLiteStatement statement(db, sql);
@@ -55,8 +55,63 @@ bool PagoPrestamo::crear(sqlite3* db) {
         return true; // Operación exitosa
 
     } catch (const std::exception& e) {
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
 
         return false; // Operación fallida
     }
 }
+
+
+// Definición de método estático para registrar varios pagos con inserciones de múltiples filas
+bool PagoPrestamo::crearVarios(sqlite3* db, const std::vector<PagoPrestamo>& pagos) {
+    try {
+        for (size_t inicio = 0; inicio < pagos.size(); inicio += PAGOS_POR_INSERCION) {
+            size_t cantidad = std::min(PAGOS_POR_INSERCION, pagos.size() - inicio);
+
+            // Consulta con un grupo de parámetros por cada pago del bloque
+            std::ostringstream sql;
+            sql << "INSERT INTO PagoPrestamos (idPrestamo, cuotaPagada, aporteCapital, aporteIntereses, saldoRestante) VALUES ";
+            for (size_t i = 0; i < cantidad; i++) {
+                sql << (i == 0 ? "" : ", ") << "(?, ?, ?, ?, ?)";
+            }
+            sql << ";";
+
+            SQLiteStatement statement(db, sql.str());
+
+            // Asignar los valores de cada pago a sus parámetros
+            for (size_t i = 0; i < cantidad; i++) {
+                const PagoPrestamo& pago = pagos[inicio + i];
+                int base = static_cast<int>(i) * 5;
+                sqlite3_bind_int(statement.get(), base + 1, pago.idPrestamo);
+                sqlite3_bind_double(statement.get(), base + 2, pago.cuotaPagada);
+                sqlite3_bind_double(statement.get(), base + 3, pago.aporteCapital);
+                sqlite3_bind_double(statement.get(), base + 4, pago.aporteIntereses);
+                sqlite3_bind_double(statement.get(), base + 5, pago.saldoRestante);
+            }
+
+            if (sqlite3_step(statement.get()) != SQLITE_DONE) {
+                throw std::runtime_error("Error al ejecutar la consulta para registrar los pagos: " + std::string(sqlite3_errmsg(db)));
+            }
+        }
+
+        return true; // Operación exitosa
+
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+
+        return false; // Operación fallida
+    }
+}
+
+
+double PagoPrestamo::getCuotaPagada() const {
+    return cuotaPagada;
+}
+
+double PagoPrestamo::getAporteCapital() const {
+    return aporteCapital;
+}
+
+double PagoPrestamo::getAporteIntereses() const {
+    return aporteIntereses;
+}
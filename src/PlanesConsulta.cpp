@@ -0,0 +1,153 @@
+/**
+ * @file PlanesConsulta.cpp
+ * @brief Implementación de la clase PlanesConsulta para detectar regresiones en los planes de las consultas SQL.
+ * @details Este archivo contiene la definición de los métodos que generan la base de datos sintética,
+ *          verifican el plan de cada sentencia registrada y muestran el resultado.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "PlanesConsulta.hpp"
+#include "EsquemaBD.hpp"
+#include "SQLiteStatement.hpp"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+// Función auxiliar para ejecutar un script SQL
+static void ejecutar(sqlite3* db, const std::string& sql) {
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Error al generar la base de datos: " + std::string(sqlite3_errmsg(db)));
+    }
+}
+
+// Definición de método estático para generar la base de datos sintética
+bool PlanesConsulta::generarBaseDatos(sqlite3* db, int clientes) {
+    const std::string n = std::to_string(clientes);
+    const std::string cuentas = std::to_string(2 * clientes);
+
+    // Secuencia 1..?, usada por cada inserción
+    auto secuencia = [](const std::string& limite) {
+        return "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < " + limite + ") ";
+    };
+
+    try {
+        ejecutar(db, SQL_TABLAS);
+        ejecutar(db, "BEGIN;");
+
+        ejecutar(db, secuencia(n) +
+            "INSERT INTO Clientes (idCliente, cedula, nombre, primerApellido, segundoApellido, telefono) "
+            "SELECT i, 100000000 + i, 'Nombre' || (i % 5003), 'Apellido' || (i % 997), 'Apellido' || (i % 991), "
+            "'8' || printf('%07d', i) FROM n;");
+
+        // Dos cuentas por cliente, una en cada moneda
+        ejecutar(db, secuencia(cuentas) +
+            "INSERT INTO Cuentas (idCuenta, idCliente, moneda, saldo, tasaInteres) "
+            "SELECT i, (i + 1) / 2, i % 2, (i % 1000) * 100.0, 1.5 FROM n;");
+
+        ejecutar(db, secuencia(std::to_string(clientes / 2)) +
+            "INSERT INTO CDP (idCDP, idCuenta, moneda, deposito, plazoMeses, tasaInteres) "
+            "SELECT i, 4 * i - 3, 1, 5000.0, 12, 4.0 FROM n;");
+
+        // Diez transacciones por cliente durante un año; los depósitos no tienen remitente y los retiros no tienen destinatario
+        ejecutar(db, secuencia(std::to_string(10LL * clientes)) +
+            "INSERT INTO Transacciones (idTransaccion, idRemitente, idDestinatario, tipo, monto, fecha) "
+            "SELECT i, CASE WHEN i % 5 = 0 THEN NULL ELSE (i * 7919) % " + cuentas + " + 1 END, "
+            "CASE WHEN i % 5 = 1 THEN NULL ELSE (i * 104729) % " + cuentas + " + 1 END, "
+            "i % 5, (i % 500) * 10.0, datetime('2024-01-01', '+' || (i % 31536000) || ' seconds') FROM n;");
+
+        // Un préstamo por cliente, uno de cada diez ya pagado
+        ejecutar(db, secuencia(n) +
+            "INSERT INTO Prestamos (idPrestamo, idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, cuotaMensual, "
+            "cuotasPagadas, capitalPagado, interesesPagados, activo, fechaProximoPago, diasAtraso) "
+            "SELECT i, 2 * i - 1, 1 + i % 3, 0, 1000000.0, 12.0, 60, 22244.45, i % 60, (i % 60) * 10000.0, "
+            "(i % 60) * 5000.0, i % 10 <> 0, date('2024-01-01', '+' || (i % 730) || ' days'), i % 120 FROM n;");
+
+        ejecutar(db, secuencia(std::to_string(3LL * clientes)) +
+            "INSERT INTO PagoPrestamos (idPagoPrestamo, idPrestamo, cuotaPagada, aporteCapital, aporteIntereses, saldoRestante) "
+            "SELECT i, (i + 2) / 3, 22244.45, 12244.45, 10000.0, 1000000.0 - 12244.45 * (i % 3 + 1) FROM n;");
+
+        ejecutar(db, "COMMIT;");
+        ejecutar(db, SQL_INDICES);
+        ejecutar(db, "ANALYZE;");
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+        return false;
+    }
+}
+
+// Definición de método estático para verificar el plan de las sentencias
+bool PlanesConsulta::verificar(sqlite3* db, ResultadoPlanes& resultado, const std::vector<ConsultaSQL>& consultas) {
+    resultado = ResultadoPlanes();
+
+    try {
+        for (const ConsultaSQL& consulta : consultas) {
+            PlanConsulta plan;
+            plan.nombre = consulta.nombre;
+
+            SQLiteStatement explicacion(db, std::string("EXPLAIN QUERY PLAN ") + consulta.sql);
+            while (sqlite3_step(explicacion.get()) == SQLITE_ROW) {
+                std::string detalle = reinterpret_cast<const char*>(sqlite3_column_text(explicacion.get(), 3));
+
+                // Un SCAN sin índice que no sea de una tabla virtual (json_each, FTS5) recorre la tabla completa
+                if (detalle.rfind("SCAN ", 0) == 0 && detalle.find(" USING ") == std::string::npos &&
+                    detalle.find("VIRTUAL TABLE") == std::string::npos && detalle != "SCAN CONSTANT ROW") {
+                    plan.problemas.push_back("recorre la tabla completa");
+                }
+                if (detalle.find("AUTOMATIC") != std::string::npos) {
+                    plan.problemas.push_back("crea un índice automático");
+                }
+                if (detalle.find("USE TEMP B-TREE") != std::string::npos && !consulta.ordenamientoPermitido) {
+                    plan.problemas.push_back("ordena con un árbol B temporal");
+                }
+                plan.plan.push_back(detalle);
+            }
+
+            std::istringstream indices(consulta.indices);
+            std::string indice;
+            while (indices >> indice) {
+                bool usado = false;
+                for (const std::string& linea : plan.plan) {
+                    usado = usado || linea.find(indice) != std::string::npos;
+                }
+                if (!usado) {
+                    plan.problemas.push_back("no usa " + indice);
+                }
+            }
+
+            resultado.invalidos += plan.problemas.empty() ? 0 : 1;
+            resultado.consultas.push_back(plan);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+
+    return resultado.invalidos == 0;
+}
+
+// Definición de método estático para mostrar el resultado de la verificación
+void PlanesConsulta::mostrarResultado(const ResultadoPlanes& resultado, bool detallado) {
+    for (const PlanConsulta& plan : resultado.consultas) {
+        bool valido = plan.problemas.empty();
+        std::cout << (valido ? "  OK     " : "  FALLA  ") << std::left << std::setw(40) << plan.nombre << std::right;
+        for (size_t i = 0; i < plan.problemas.size(); i++) {
+            std::cout << (i == 0 ? "" : ", ") << plan.problemas[i];
+        }
+        std::cout << std::endl;
+
+        if (!valido || detallado) {
+            for (const std::string& linea : plan.plan) {
+                std::cout << "           " << linea << std::endl;
+            }
+        }
+    }
+    std::cout << "Sentencias verificadas: " << resultado.consultas.size() << ", con plan inválido: " << resultado.invalidos << std::endl;
+}
@@ -13,21 +13,30 @@
  */
 
 #include "Prestamo.hpp"
+#include "Consultas.hpp"
 #include "auxiliares.hpp"
 #include "SQLiteStatement.hpp"
+#include "FiltrosExistencia.hpp"
 #include "Transaccion.hpp"
 #include "PagoPrestamo.hpp"
+#include "Concurrencia.hpp"
+#include "CapturaSalida.hpp"
 #include "constants.hpp"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <cmath>
+#include <algorithm>
+
+/// @brief Saldo por debajo del cual un préstamo se considera pagado (diferencias de redondeo).
+constexpr double TOLERANCIA_SALDO = 0.005;
 
 
 // Definición del constructor de la clase Prestamo
 Prestamo::Prestamo(
     int idCuenta,
-    const std::string& tipo,
-    const std::string &moneda,
+    TipoPrestamo tipo,
+    Moneda moneda,
     double monto,
     double tasaInteres,
     int plazoMeses,
@@ -59,23 +68,26 @@ Prestamo::Prestamo(
 
 // Definición de función para calcular el monto de intereses
 double Prestamo::calcularIntereses() {
-    return (monto * tasaInteres / 100) / 12;
+    return calcularInteresesMensuales(monto - capitalPagado, tasaInteres);
+}
+
+// Definición de función estática para calcular los intereses de un mes sobre un saldo
+double Prestamo::calcularInteresesMensuales(double saldo, double tasaInteres) {
+    return (saldo * tasaInteres / 100) / 12;
 }
 
 // Definición de la función para crear un préstamo
 bool Prestamo::crear(sqlite3* db) {
     try {
         // Consulta SQL para insertar un nuevo préstamo
-        const std::string sql = "INSERT INTO Prestamos (idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, "
-                                "cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, activo) "
-                                "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+        const std::string sql = SQL_CREAR_PRESTAMO;
 
         SQLiteStatement statement(db, sql);
 
         // Bind de los valores al statement
         sqlite3_bind_int(statement.get(), 1, idCuenta);
-        sqlite3_bind_text(statement.get(), 2, tipo.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(statement.get(), 3, moneda.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, valor(tipo));
+        sqlite3_bind_int(statement.get(), 3, valor(moneda));
         sqlite3_bind_double(statement.get(), 4, monto);
         sqlite3_bind_double(statement.get(), 5, tasaInteres);
         sqlite3_bind_int(statement.get(), 6, plazoMeses);
@@ -91,7 +103,7 @@ bool Prestamo::crear(sqlite3* db) {
         }
 
         idPrestamo = sqlite3_last_insert_rowid(db);
-        std::cout << "Préstamo creado con éxito. ID: " << idPrestamo << std::endl;
+        flujoSalida() << "Préstamo creado con éxito. ID: " << idPrestamo << std::endl;
         
         // Agregar depósito del préstamo solicitado
 
@@ -99,14 +111,19 @@ bool Prestamo::crear(sqlite3* db) {
         return true;
 
     } catch (const std::exception& e) {
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
 
 
 bool Prestamo::existe(sqlite3* db, int idPrestamo) {
-    const char* sql = "SELECT COUNT(1) FROM Prestamos WHERE idPrestamo = ?;";
+    // Si el filtro de Bloom descarta el ID, no es necesario consultar la base de datos
+    if (!FiltrosExistencia::puedeExistir(db, FiltroExistencia::PRESTAMOS, idPrestamo)) {
+        return false;
+    }
+
+    const char* sql = SQL_EXISTE_PRESTAMO;
 
     try {
         SQLiteStatement statement(db, sql);
@@ -119,7 +136,7 @@ bool Prestamo::existe(sqlite3* db, int idPrestamo) {
         }
 
     } catch (const std::exception& e) {
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
@@ -128,12 +145,10 @@ bool Prestamo::existe(sqlite3* db, int idPrestamo) {
 // Definición de función estática para obtener un préstamo de la base de datos
 Prestamo Prestamo::obtener(sqlite3* db, int idPrestamo) {
     // Consulta SQL para seleccionar datos del préstamo a partir de su ID
-    std::string sql = "SELECT idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, cuotaMensual, "
-                      "cuotasPagadas, capitalPagado, interesesPagados, activo "
-                      "FROM Prestamos WHERE idPrestamo = ?;";
+    std::string sql = SQL_OBTENER_PRESTAMO;
 
     // Crear un préstamo vacío
-    Prestamo prestamo(0, "", "", 0, 0, 0);
+    Prestamo prestamo(0, TipoPrestamo::PERSONAL, Moneda::CRC, 0, 0, 0);
 
     try {
         SQLiteStatement statement(db, sql);
@@ -142,12 +157,13 @@ Prestamo Prestamo::obtener(sqlite3* db, int idPrestamo) {
         sqlite3_bind_int(statement.get(), 1, idPrestamo);
 
         // Ejecutar la consulta y verificar si se encontró un registro
-        if (sqlite3_step(statement.get()) == SQLITE_ROW) {
+        int resultado = sqlite3_step(statement.get());
+        if (resultado == SQLITE_ROW) {
             // Asignar los valores obtenidos de la base de datos al objeto préstamo
             prestamo.idPrestamo = idPrestamo;
             prestamo.idCuenta = sqlite3_column_int(statement.get(), 0);
-            prestamo.tipo = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 1));
-            prestamo.moneda = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 2));
+            prestamo.tipo = tipoPrestamoSegunValor(sqlite3_column_int(statement.get(), 1));
+            prestamo.moneda = monedaSegunValor(sqlite3_column_int(statement.get(), 2));
             prestamo.monto = sqlite3_column_double(statement.get(), 3);
             prestamo.tasaInteres = sqlite3_column_double(statement.get(), 4);
             prestamo.plazoMeses = sqlite3_column_int(statement.get(), 5);
@@ -156,94 +172,275 @@ Prestamo Prestamo::obtener(sqlite3* db, int idPrestamo) {
             prestamo.capitalPagado = sqlite3_column_double(statement.get(), 8);
             prestamo.interesesPagados = sqlite3_column_double(statement.get(), 9);
             prestamo.activo = sqlite3_column_int(statement.get(), 10) == 1;
-        } else {
+            prestamo.fechaProximoPago = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 11));
+            prestamo.diasAtraso = sqlite3_column_int(statement.get(), 12);
+            prestamo.version = sqlite3_column_int(statement.get(), 13);
+        } else if (resultado == SQLITE_DONE) {
             throw std::runtime_error("Error: Préstamo no encontrado con el ID ingresado.");
+        } else {
+            throw std::runtime_error("Error al consultar el préstamo: " + std::string(sqlite3_errmsg(db)));
         }
     } catch (const std::exception& e) {
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
     }
 
     return prestamo;
 }
 
+// Definición de función estática para obtener varios préstamos en una sola consulta
+std::vector<Prestamo> Prestamo::obtenerVarios(sqlite3* db, std::span<const int> idsPrestamo) {
+    // Consulta SQL que recorre la lista de IDs con json_each; j.key conserva el orden de la lista
+    std::string sql = SQL_OBTENER_PRESTAMOS;
+
+    std::vector<Prestamo> prestamos;
+
+    try {
+        SQLiteStatement statement(db, sql);
+        statement.bindLista(1, idsPrestamo);
+        prestamos.reserve(idsPrestamo.size());
+
+        // Crear un préstamo por cada fila obtenida
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            Prestamo& prestamo = prestamos.emplace_back(
+                sqlite3_column_int(statement.get(), 1),
+                tipoPrestamoSegunValor(sqlite3_column_int(statement.get(), 2)),
+                monedaSegunValor(sqlite3_column_int(statement.get(), 3)),
+                sqlite3_column_double(statement.get(), 4),
+                sqlite3_column_double(statement.get(), 5),
+                sqlite3_column_int(statement.get(), 6),
+                sqlite3_column_double(statement.get(), 7),
+                sqlite3_column_int(statement.get(), 8),
+                sqlite3_column_double(statement.get(), 9),
+                sqlite3_column_double(statement.get(), 10),
+                sqlite3_column_int(statement.get(), 11) == 1
+            );
+            prestamo.idPrestamo = sqlite3_column_int(statement.get(), 0);
+            prestamo.fechaProximoPago = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 12));
+            prestamo.diasAtraso = sqlite3_column_int(statement.get(), 13);
+            prestamo.version = sqlite3_column_int(statement.get(), 14);
+        }
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al obtener los préstamos: " + std::string(sqlite3_errmsg(db)));
+        }
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        prestamos.clear();
+    }
+
+    return prestamos;
+}
+
 // Definición de la función para calcular la cuota mensual del préstamo
 double Prestamo::calcularCuotaMensual(double monto, double tasaInteres, int plazoMeses) {
     double tasaInteresMensual = (tasaInteres/100) / 12;
 
-    double a = 1 + tasaInteresMensual;
+    // Factor (1 + i)^n, calculado una sola vez
+    double factor = std::pow(1 + tasaInteresMensual, plazoMeses);
 
-    double cuotaMensual = (monto * tasaInteresMensual * potencia(a, plazoMeses)) / (potencia(a, plazoMeses) - 1);
+    double cuotaMensual = (monto * tasaInteresMensual * factor) / (factor - 1);
 
     return cuotaMensual;
 }
 
+// Definición de la función para calcular el saldo pendiente después de pagar varias cuotas
+double Prestamo::calcularSaldoRestante(double monto, double tasaInteres, double cuotaMensual, int cuotasPagadas) {
+    double tasaInteresMensual = (tasaInteres/100) / 12;
+
+    // Saldo de la anualidad: monto * (1 + i)^k - cuota * ((1 + i)^k - 1) / i
+    double factor = std::pow(1 + tasaInteresMensual, cuotasPagadas);
+
+    return monto * factor - cuotaMensual * (factor - 1) / tasaInteresMensual;
+}
+
 
 bool Prestamo::abonarCuota(sqlite3* db, Cuenta& cuenta) {
-    try {
+    return abonarCuotas(db, cuenta, 1);
+}
+
+
+// Definición de método para abonar varias cuotas en una sola operación
+bool Prestamo::abonarCuotas(sqlite3* db, Cuenta& cuenta, int cantidadCuotas) {
+    for (int intento = 1; ; intento++) {
+        int cuotasRestantes = plazoMeses - cuotasPagadas;
+
+        if (!activo || cuotasRestantes <= 0) {
+            flujoErrores() << "Error: El préstamo ya fue pagado en su totalidad." << std::endl;
+            return false;
+        }
+
+        if (cantidadCuotas <= 0 || cantidadCuotas > cuotasRestantes) {
+            flujoErrores() << "Error: La cantidad de cuotas debe estar entre 1 y " << cuotasRestantes << "." << std::endl;
+            return false;
+        }
+
+        // Calcular el desglose de cada cuota sobre el saldo que deja la anterior
+        std::vector<PagoPrestamo> pagos;
+        pagos.reserve(cantidadCuotas);
+
+        double saldo = monto - capitalPagado;
+        for (int i = 1; i <= cantidadCuotas; i++) {
+            double intereses = calcularInteresesMensuales(saldo, tasaInteres);
+            double abonoCapital = cuotaMensual - intereses;
+
+            // La última cuota del préstamo liquida el saldo pendiente
+            if (i == cuotasRestantes) {
+                abonoCapital = saldo;
+            }
+
+            saldo -= abonoCapital;
+            pagos.emplace_back(idPrestamo, abonoCapital + intereses, abonoCapital, intereses, saldo);
+        }
+
+        try {
+            return aplicarAbono(db, cuenta, pagos, cantidadCuotas, cuotaMensual);
+        } catch (const ConflictoVersion& e) {
+            // Otra sesión modificó el préstamo o la cuenta: el desglose se calcula de nuevo con los datos actuales
+            bool reintentar = reintentarConflicto(db, e, intento);
+            if (!recargar(db, cuenta) || !reintentar) {
+                return false;
+            }
+        }
+    }
+}
+
+
+// Definición de método para abonar un monto extraordinario al capital
+bool Prestamo::abonarCapital(sqlite3* db, Cuenta& cuenta, double montoCapital) {
+    for (int intento = 1; ; intento++) {
+        double saldo = monto - capitalPagado;
+
+        if (!activo || saldo <= TOLERANCIA_SALDO) {
+            flujoErrores() << "Error: El préstamo ya fue pagado en su totalidad." << std::endl;
+            return false;
+        }
 
-        if (cuenta.getMoneda() != this->moneda) {
-            std::cerr << "Error: Los tipos de moneda entre la cuenta y el préstamo no coinciden." << std::endl;
+        if (montoCapital <= 0 || montoCapital > saldo + TOLERANCIA_SALDO) {
+            flujoErrores() << "Error: El abono al capital debe ser positivo y no superar el saldo pendiente de " << saldo << "." << std::endl;
             return false;
         }
 
+        double abono = std::min(montoCapital, saldo);
+        saldo -= abono;
+
+        // Recalcular la cuota para amortizar el nuevo saldo en las cuotas restantes
+        int cuotasRestantes = plazoMeses - cuotasPagadas;
+        double nuevaCuota = cuotaMensual;
+        if (saldo > TOLERANCIA_SALDO && cuotasRestantes > 0) {
+            nuevaCuota = calcularCuotaMensual(saldo, tasaInteres, cuotasRestantes);
+        }
+
+        std::vector<PagoPrestamo> pagos;
+        pagos.emplace_back(idPrestamo, abono, abono, 0.0, saldo);
+
+        try {
+            return aplicarAbono(db, cuenta, pagos, 0, nuevaCuota);
+        } catch (const ConflictoVersion& e) {
+            // Otra sesión modificó el préstamo o la cuenta: el saldo y la cuota se calculan de nuevo
+            bool reintentar = reintentarConflicto(db, e, intento);
+            if (!recargar(db, cuenta) || !reintentar) {
+                return false;
+            }
+        }
+    }
+}
+
+
+// Definición de método privado para aplicar un abono en una sola transacción
+bool Prestamo::aplicarAbono(sqlite3* db, Cuenta& cuenta, const std::vector<PagoPrestamo>& pagos, int cuotas, double nuevaCuota) {
+    if (cuenta.getMoneda() != this->moneda) {
+        flujoErrores() << "Error: Los tipos de moneda entre la cuenta y el préstamo no coinciden." << std::endl;
+        return false;
+    }
+
+    // Totales del abono
+    double total = 0.0;
+    double abonoCapital = 0.0;
+    double abonoIntereses = 0.0;
+    for (const PagoPrestamo& pago : pagos) {
+        total += pago.getCuotaPagada();
+        abonoCapital += pago.getAporteCapital();
+        abonoIntereses += pago.getAporteIntereses();
+    }
+
+    // Datos anteriores para restaurarlos si el abono falla
+    const int cuotasAnteriores = cuotasPagadas;
+    const double capitalAnterior = capitalPagado;
+    const double interesesAnteriores = interesesPagados;
+    const double cuotaAnterior = cuotaMensual;
+    const bool activoAnterior = activo;
+    const std::string fechaAnterior = fechaProximoPago;
+    const int diasAtrasoAnterior = diasAtraso;
+    const int versionAnterior = version;
+    bool cuentaDebitada = false;
+
+    try {
         // Iniciar la transacción en la base de datos
         if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
             throw std::runtime_error("Error: No se pudo iniciar la transacción.");
         }
 
-        // Reducir los fondos de la cuenta y registrar la transacción
-        if (!cuenta.abonarPrestamo(db, cuotaMensual)) {
+        // Reducir los fondos de la cuenta y registrar la transacción una sola vez
+        if (!cuenta.abonarPrestamo(db, total)) {
             throw std::runtime_error("Error: No se pudo realizar el abono desde la cuenta.");
         }
+        cuentaDebitada = true;
 
         // Actualizar los datos del préstamo
-        double interesesFijos = calcularIntereses();
-
-        // Calcular capital a abonar
-        double abonoCapital = cuotaMensual - interesesFijos;
-
-        cuotasPagadas++;
+        cuotasPagadas += cuotas;
         capitalPagado += abonoCapital;
-        interesesPagados += interesesFijos;
+        interesesPagados += abonoIntereses;
+        cuotaMensual = nuevaCuota;
 
-        // Si se han pagado todas las cuotas, marcar el préstamo como inactivo
-        if (cuotasPagadas >= plazoMeses) {
-            std::cout << "El préstamo fue pagado en su totalidad." << std::endl;
+        // Si se pagaron todas las cuotas o el saldo, marcar el préstamo como inactivo
+        if (cuotasPagadas >= plazoMeses || monto - capitalPagado <= TOLERANCIA_SALDO) {
             activo = false;
         }
 
         if (!actualizarDatosAbono(db)) {
-            cuotasPagadas--;
-            capitalPagado -= abonoCapital;
-            interesesPagados -= interesesFijos;
             throw std::runtime_error("Error: No se pudieron actualizar los datos del préstamo.");
         }
 
-        // Crear objeto de la clase PagoPrestamo para registrar la transacción
-        PagoPrestamo pago(idPrestamo, cuotaMensual, abonoCapital, interesesFijos, monto - capitalPagado);
+        if (cuotas > 0 && !actualizarVencimiento(db, cuotas)) {
+            throw std::runtime_error("Error: No se pudo actualizar la fecha de próximo pago.");
+        }
 
-        if (!pago.crear(db)) {
-            cuotasPagadas--;
-            capitalPagado -= abonoCapital;
-            interesesPagados -= interesesFijos;
+        if (!PagoPrestamo::crearVarios(db, pagos)) {
             throw std::runtime_error("Error: No se pudo guardar el movimiento del pago del préstamo.");
         }
 
         // Confirmar la transacción en la base de datos
         if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            cuotasPagadas--;
-            capitalPagado -= abonoCapital;
-            interesesPagados -= interesesFijos;
             throw std::runtime_error("Error: No se pudo confirmar la transacción.");
         }
 
+        if (!activo) {
+            flujoSalida() << "El préstamo fue pagado en su totalidad." << std::endl;
+        }
+
         return true;
 
+    } catch (const ConflictoVersion&) {
+        // El método que calculó el abono deshace la transacción, recarga los datos y se reintenta
+        throw;
     } catch (const std::exception& e) {
         // Realizar rollback en caso de error
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         if (sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr) != SQLITE_OK) {
-            std::cerr << "Error: No se pudo realizar el rollback." << std::endl;
+            flujoErrores() << "Error: No se pudo realizar el rollback." << std::endl;
+        }
+
+        // Restaurar los datos en memoria
+        cuotasPagadas = cuotasAnteriores;
+        capitalPagado = capitalAnterior;
+        interesesPagados = interesesAnteriores;
+        cuotaMensual = cuotaAnterior;
+        activo = activoAnterior;
+        fechaProximoPago = fechaAnterior;
+        diasAtraso = diasAtrasoAnterior;
+        version = versionAnterior;
+        if (cuentaDebitada) {
+            cuenta = Cuenta::obtener(db, cuenta.getID());
         }
         return false;
     }
@@ -253,33 +450,88 @@ bool Prestamo::abonarCuota(sqlite3* db, Cuenta& cuenta) {
 bool Prestamo::actualizarDatosAbono(sqlite3* db) {
     try {
         // Consulta SQL para actualizar los datos del préstamo
-        const std::string sql = "UPDATE Prestamos SET cuotasPagadas = ?, capitalPagado = ?, interesesPagados = ?, activo = ? WHERE idPrestamo = ?;";
+        const std::string sql = SQL_ACTUALIZAR_ABONO;
         SQLiteStatement statement(db, sql);
 
         // Asignar los valores actualizados a la consulta
         sqlite3_bind_int(statement.get(), 1, cuotasPagadas);
         sqlite3_bind_double(statement.get(), 2, capitalPagado);
         sqlite3_bind_double(statement.get(), 3, interesesPagados);
-        sqlite3_bind_int(statement.get(), 4, activo ? 1 : 0);
-        sqlite3_bind_int(statement.get(), 5, idPrestamo);
+        sqlite3_bind_double(statement.get(), 4, cuotaMensual);
+        sqlite3_bind_int(statement.get(), 5, activo ? 1 : 0);
+        sqlite3_bind_int(statement.get(), 6, idPrestamo);
+        sqlite3_bind_int(statement.get(), 7, version);
 
         // Ejecutar la consulta
         if (sqlite3_step(statement.get()) != SQLITE_DONE) {
             throw std::runtime_error("Error: No se pudo actualizar los datos del préstamo en la base de datos.");
         }
 
+        // Si ninguna fila cambió, otra sesión abonó al préstamo después de leerlo
+        if (sqlite3_changes(db) == 0) {
+            throw ConflictoVersion("El préstamo " + std::to_string(idPrestamo) + " fue modificado por otra sesión.");
+        }
+        version++;
+
         return true; // Actualización exitosa
 
+    } catch (const ConflictoVersion&) {
+        // El abono deshace la transacción y se reintenta
+        throw;
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
 
+// Definición de método privado para adelantar la fecha de próximo pago
+bool Prestamo::actualizarVencimiento(sqlite3* db, int cuotas) {
+    try {
+        // Avanzar la fecha un mes por cuota y recalcular el atraso con respecto a la fecha actual
+        const std::string sql = SQL_ACTUALIZAR_VENCIMIENTO;
+        SQLiteStatement statement(db, sql);
+
+        const std::string meses = "+" + std::to_string(cuotas) + " months";
+        sqlite3_bind_text(statement.get(), 1, meses.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(statement.get(), 2, idPrestamo);
+
+        if (sqlite3_step(statement.get()) != SQLITE_ROW) {
+            throw std::runtime_error("Error: No se pudo actualizar la fecha de próximo pago del préstamo.");
+        }
+
+        // Actualizar los datos en memoria con los valores calculados por la base de datos
+        fechaProximoPago = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 0));
+        diasAtraso = sqlite3_column_int(statement.get(), 1);
+
+        if (sqlite3_step(statement.get()) != SQLITE_DONE) {
+            throw std::runtime_error("Error: No se pudo completar la actualización de la fecha de próximo pago.");
+        }
+
+        return true;
+
+    } catch (const std::exception& e) {
+        flujoErrores() << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Definición de método privado para recargar el préstamo y la cuenta después de un conflicto de versión
+bool Prestamo::recargar(sqlite3* db, Cuenta& cuenta) {
+    Prestamo actual = Prestamo::obtener(db, idPrestamo);
+    Cuenta cuentaActual = Cuenta::obtener(db, cuenta.getID());
+    if (actual.idPrestamo == 0 || cuentaActual.getID() == 0) {
+        return false;
+    }
+
+    *this = actual;
+    cuenta = cuentaActual;
+    return true;
+}
+
 void Prestamo::mostrarHistorialAbonos(sqlite3* db) const {
     // Consulta SQL para obtener los pagos asociados al préstamo
-    std::string sql = "SELECT cuotaPagada, aporteCapital, aporteIntereses FROM PagoPrestamos WHERE idPrestamo = ?;";
+    std::string sql = SQL_HISTORIAL_ABONOS;
     
     try {
         // Crear statement para manejar la consulta
@@ -289,8 +541,8 @@ void Prestamo::mostrarHistorialAbonos(sqlite3* db) const {
         sqlite3_bind_int(statement.get(), 1, idPrestamo);
 
         // Encabezado para la tabla de historial de pagos
-        std::cout << "=== Historial de Pagos para el Préstamo ID " << idPrestamo << " ===" << std::endl;
-        std::cout << "Cuota Pagada\tAporte Capital\tAporte Intereses" << std::endl;
+        flujoSalida() << "=== Historial de Pagos para el Préstamo ID " << idPrestamo << " ===" << std::endl;
+        flujoSalida() << "Cuota Pagada\tAporte Capital\tAporte Intereses" << std::endl;
 
         // Recorrer los resultados de la consulta
         while (sqlite3_step(statement.get()) == SQLITE_ROW) {
@@ -299,11 +551,11 @@ void Prestamo::mostrarHistorialAbonos(sqlite3* db) const {
             double aporteIntereses = sqlite3_column_double(statement.get(), 2);
 
             // Mostrar los resultados en formato de tabla
-            std::cout << cuotaPagada << "\t\t" << aporteCapital << "\t\t" << aporteIntereses << std::endl;
+            flujoSalida() << cuotaPagada << "\t\t" << aporteCapital << "\t\t" << aporteIntereses << std::endl;
         }
     } catch (const std::exception& e) {
         // Manejo de errores
-        std::cerr << "Error al mostrar el historial de pagos: " << e.what() << std::endl;
+        flujoErrores() << "Error al mostrar el historial de pagos: " << e.what() << std::endl;
     }
 }
 
@@ -328,18 +580,21 @@ bool Prestamo::setIDCuenta(int idCuenta) {
 
 // Definición de método para mostrar la información del préstamo requerida para hacer un abono
 void Prestamo::mostrarInformacionPago() const {
-    std::cout << "==== Información del Préstamo ====" << std::endl;
-    std::cout << "ID del Préstamo: " << idPrestamo << std::endl;
-    std::cout << "Cuota mensual: " << cuotaMensual << std::endl;
+    flujoSalida() << "==== Información del Préstamo ====" << std::endl;
+    flujoSalida() << "ID del Préstamo: " << idPrestamo << std::endl;
+    flujoSalida() << "Cuota mensual: " << cuotaMensual << std::endl;
+    flujoSalida() << "Cuotas restantes: " << plazoMeses - cuotasPagadas << std::endl;
+    flujoSalida() << "Saldo pendiente: " << monto - capitalPagado << std::endl;
+    flujoSalida() << "Fecha de próximo pago: " << fechaProximoPago << std::endl;
+    if (diasAtraso > 0) {
+        flujoSalida() << "Días de atraso: " << diasAtraso << std::endl;
+    }
 }
 
 // Definición de método estático para realizar la consulta del estado de un préstamo
 bool Prestamo::consultarEstado(sqlite3* db, int idPrestamo, const std::string& nombreArchivo) {
     // Consulta SQL para recuperar datos del préstamo
-    std::string sql = R"(
-        SELECT cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, plazoMeses 
-        FROM Prestamos WHERE idPrestamo = ?;
-    )";
+    std::string sql = SQL_ESTADO_PRESTAMO;
 
     try {
         // Preparar statement con SQLiteStatement
@@ -356,17 +611,21 @@ bool Prestamo::consultarEstado(sqlite3* db, int idPrestamo, const std::string& n
             double capitalPagado = sqlite3_column_double(statement.get(), 2);
             double interesesPagados = sqlite3_column_double(statement.get(), 3);
             int plazoMeses = sqlite3_column_int(statement.get(), 4);
+            std::string fechaProximoPago = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 5));
+            int diasAtraso = sqlite3_column_int(statement.get(), 6);
 
             // Calcular cuotas restantes
             int cuotasRestantes = plazoMeses - cuotasPagadas;
 
             // Mostrar datos al usuario
-            std::cout << "==== Estado del Préstamo ====" << std::endl;
-            std::cout << "Cuota Mensual: " << cuotaMensual << std::endl;
-            std::cout << "Cuotas Pagadas: " << cuotasPagadas << std::endl;
-            std::cout << "Aporte al Capital: " << capitalPagado << std::endl;
-            std::cout << "Intereses Pagados: " << interesesPagados << std::endl;
-            std::cout << "Cuotas Restantes: " << cuotasRestantes << std::endl;
+            flujoSalida() << "==== Estado del Préstamo ====" << std::endl;
+            flujoSalida() << "Cuota Mensual: " << cuotaMensual << std::endl;
+            flujoSalida() << "Cuotas Pagadas: " << cuotasPagadas << std::endl;
+            flujoSalida() << "Aporte al Capital: " << capitalPagado << std::endl;
+            flujoSalida() << "Intereses Pagados: " << interesesPagados << std::endl;
+            flujoSalida() << "Cuotas Restantes: " << cuotasRestantes << std::endl;
+            flujoSalida() << "Fecha de Próximo Pago: " << fechaProximoPago << std::endl;
+            flujoSalida() << "Días de Atraso: " << diasAtraso << std::endl;
 
             // Generar reporte si el nombre del archivo no está vacío
             if (!nombreArchivo.empty()) {
@@ -376,13 +635,14 @@ bool Prestamo::consultarEstado(sqlite3* db, int idPrestamo, const std::string& n
                 }
 
                 // Escribir los datos en formato CSV
-                archivo << "Cuota Mensual,Cuotas Pagadas,Aporte al Capital,Intereses Pagados,Cuotas Restantes\n";
-                archivo << cuotaMensual << "," << cuotasPagadas << "," << capitalPagado << "," << interesesPagados << "," << cuotasRestantes << "\n";
+                archivo << "Cuota Mensual,Cuotas Pagadas,Aporte al Capital,Intereses Pagados,Cuotas Restantes,Fecha de Proximo Pago,Dias de Atraso\n";
+                archivo << cuotaMensual << "," << cuotasPagadas << "," << capitalPagado << "," << interesesPagados << "," << cuotasRestantes << ","
+                        << fechaProximoPago << "," << diasAtraso << "\n";
                 archivo.close();
 
-                std::cout << "Estado del préstamo guardado en el archivo: " << nombreArchivo << std::endl;
+                flujoSalida() << "Estado del préstamo guardado en el archivo: " << nombreArchivo << std::endl;
             } else {
-                std::cout << "Reporte no generado." << std::endl;
+                flujoSalida() << "Reporte no generado." << std::endl;
             }
 
             return true;
@@ -391,33 +651,33 @@ bool Prestamo::consultarEstado(sqlite3* db, int idPrestamo, const std::string& n
         }
     } catch (const std::exception& e) {
         // Manejar errores
-        std::cerr << e.what() << std::endl;
+        flujoErrores() << e.what() << std::endl;
         return false;
     }
 }
 
 
-void Prestamo::reportePagoEstimado(const std::string& moneda, double monto, int plazoMeses, double tasaInteres, double cuotaMensual) {
+void Prestamo::reportePagoEstimado(Moneda moneda, double monto, int plazoMeses, double tasaInteres, double cuotaMensual) {
     // Mostrar los detalles del préstamo en forma de tabla
-    std::cout << "\n=== Resumen del Préstamo Estimado ===" << std::endl;
-    std::cout << std::setw(12) << "Moneda" 
+    flujoSalida() << "\n=== Resumen del Préstamo Estimado ===" << std::endl;
+    flujoSalida() << std::setw(12) << "Moneda" 
               << std::setw(15) << "Monto Total" 
               << std::setw(15) << "Plazo (Meses)" 
               << std::setw(10) << "Tasa (%)" 
               << std::setw(15) << "Cuota Mensual" << std::endl;
-    std::cout << std::setw(12) << moneda 
+    flujoSalida() << std::setw(12) << codigo(moneda) 
               << std::setw(15) << monto 
               << std::setw(15) << plazoMeses 
               << std::setw(10) << tasaInteres 
               << std::setw(15) << cuotaMensual << std::endl;
 
     // Preguntar al usuario si desea guardar el reporte
-    std::cout << "\n¿Desea guardar este reporte en un archivo? (s/n): ";
+    flujoSalida() << "\n¿Desea guardar este reporte en un archivo? (s/n): ";
     bool guardarArchivo = validarRespuestaSN();
 
     if (guardarArchivo) {
         // Solicitar el nombre del archivo
-        std::cout << "Ingrese el nombre del archivo (con extensión .csv): ";
+        flujoSalida() << "Ingrese el nombre del archivo (con extensión .csv): ";
         std::string nombreArchivo = obtenerArchivoCSV();
 
         // Guardar los datos en el archivo
@@ -425,31 +685,31 @@ void Prestamo::reportePagoEstimado(const std::string& moneda, double monto, int
 
         // Abrir archivo
         if (!archivo.is_open()) {
-            std::cerr << "Error al guardar el archivo.\n";
+            flujoErrores() << "Error al guardar el archivo.\n";
         }
 
         // Escribir títulos en el archivo valores de las variables a almacenar
         archivo << std::fixed << std::setprecision(2); // Salida con dos decimales
         archivo << "Moneda,Monto Total,Plazo en Meses,Tasa de Interés,Cuota Mensual\n";
-        archivo << moneda << "," << monto << "," << plazoMeses << "," 
+        archivo << codigo(moneda) << "," << monto << "," << plazoMeses << "," 
                 << tasaInteres << "," << cuotaMensual << "\n";
         
         archivo.close();// Cerrar el archivo
 
         // Mensaje de verificación
-        std::cout << "Reporte guardado en " << nombreArchivo << "\n";
+        flujoSalida() << "Reporte guardado en " << nombreArchivo << "\n";
     }
 }
 
 
-ValoresPrestamo Prestamo::obtenerValoresPredeterminados(TipoPrestamo tipo, const std::string &moneda) {
+ValoresPrestamo Prestamo::obtenerValoresPredeterminados(TipoPrestamo tipo, Moneda moneda) {
     switch (tipo) {
         case TipoPrestamo::PERSONAL:
-            return (moneda == "CRC") ? Prestamos::Colones::PERSONAL : Prestamos::Dolares::PERSONAL;
+            return (moneda == Moneda::CRC) ? Prestamos::Colones::PERSONAL : Prestamos::Dolares::PERSONAL;
         case TipoPrestamo::PRENDARIO:
-            return (moneda == "CRC") ? Prestamos::Colones::PRENDARIO : Prestamos::Dolares::PRENDARIO;
+            return (moneda == Moneda::CRC) ? Prestamos::Colones::PRENDARIO : Prestamos::Dolares::PRENDARIO;
         case TipoPrestamo::HIPOTECARIO:
-            return (moneda == "CRC") ? Prestamos::Colones::HIPOTECARIO : Prestamos::Dolares::HIPOTECARIO;
+            return (moneda == Moneda::CRC) ? Prestamos::Colones::HIPOTECARIO : Prestamos::Dolares::HIPOTECARIO;
         default:
             // Retornar valores nulos en caso de un tipo no manejado
             return ValoresPrestamo{0.0, 0.0, 0, 0.0};
@@ -0,0 +1,205 @@
+/**
+ * @file ProyeccionCartera.cpp
+ * @brief Implementación de la clase ProyeccionCartera para proyectar intereses de la cartera.
+ * @details Este archivo contiene la definición de los métodos de la clase ProyeccionCartera, que permiten
+ *          cargar la cartera en memoria, proyectar los intereses de préstamos y CDP en paralelo y
+ *          exportar el resumen en formato CSV.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "ProyeccionCartera.hpp"
+#include "Prestamo.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+/// @brief Cantidad de préstamos que se proyectan juntos para que sus columnas quepan en caché.
+constexpr size_t TAMANO_BLOQUE = 512;
+
+// Función auxiliar para obtener el índice de una moneda a partir de su valor almacenado
+static int indiceMoneda(int moneda) {
+    return moneda == valor(Moneda::USD) ? 1 : 0;
+}
+
+
+// Definición de método para cargar la cartera desde la base de datos
+bool ProyeccionCartera::cargar(sqlite3* db) {
+    for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+        prestamos[m] = ColumnasPrestamos();
+        cdps[m] = ColumnasCDP();
+    }
+
+    try {
+        // Préstamos activos con sus cuotas pendientes
+        SQLiteStatement statementPrestamos(db, R"(
+            SELECT moneda, monto - capitalPagado, tasaInteres, cuotaMensual, plazoMeses - cuotasPagadas
+            FROM Prestamos WHERE activo = 1;
+        )");
+
+        while (sqlite3_step(statementPrestamos.get()) == SQLITE_ROW) {
+            ColumnasPrestamos& columnas = prestamos[indiceMoneda(sqlite3_column_int(statementPrestamos.get(), 0))];
+            columnas.saldo.push_back(sqlite3_column_double(statementPrestamos.get(), 1));
+            columnas.tasaMensual.push_back(Prestamo::calcularInteresesMensuales(1.0, sqlite3_column_double(statementPrestamos.get(), 2)));
+            columnas.cuota.push_back(sqlite3_column_double(statementPrestamos.get(), 3));
+            columnas.cuotasRestantes.push_back(std::max(0, sqlite3_column_int(statementPrestamos.get(), 4)));
+        }
+
+        // CDP con el interés mensual sobre su depósito
+        SQLiteStatement statementCDP(db, "SELECT moneda, deposito, tasaInteres, plazoMeses FROM CDP;");
+
+        while (sqlite3_step(statementCDP.get()) == SQLITE_ROW) {
+            ColumnasCDP& columnas = cdps[indiceMoneda(sqlite3_column_int(statementCDP.get(), 0))];
+            double deposito = sqlite3_column_double(statementCDP.get(), 1);
+            double tasaInteres = sqlite3_column_double(statementCDP.get(), 2);
+            columnas.interesMensual.push_back((deposito * tasaInteres / 100) / 12);
+            columnas.mesesRestantes.push_back(sqlite3_column_int(statementCDP.get(), 3));
+        }
+
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+}
+
+
+// Definición de método para proyectar un bloque de préstamos
+void ProyeccionCartera::proyectarPrestamos(const ColumnasPrestamos& columnas, size_t inicio, size_t fin, int meses, double* acumulado) {
+    double saldo[TAMANO_BLOQUE];
+
+    for (size_t bloque = inicio; bloque < fin; bloque += TAMANO_BLOQUE) {
+        const size_t n = std::min(TAMANO_BLOQUE, fin - bloque);
+        const double* __restrict tasa = columnas.tasaMensual.data() + bloque;
+        const double* __restrict cuota = columnas.cuota.data() + bloque;
+        const int* __restrict restantes = columnas.cuotasRestantes.data() + bloque;
+
+        // Copia local del saldo, que se reduce mes a mes
+        std::copy_n(columnas.saldo.data() + bloque, n, saldo);
+        int mesesBloque = std::min(meses, *std::max_element(restantes, restantes + n));
+
+        for (int mes = 0; mes < mesesBloque; mes++) {
+            double total = 0.0;
+
+            // Sin saltos condicionales: los préstamos ya pagados aportan cero
+            for (size_t i = 0; i < n; i++) {
+                double activo = restantes[i] > mes ? 1.0 : 0.0;
+                double intereses = saldo[i] * tasa[i] * activo;
+                saldo[i] -= (cuota[i] * activo - intereses);
+                total += intereses;
+            }
+
+            acumulado[mes] += total;
+        }
+    }
+}
+
+// Definición de método para proyectar un bloque de CDP
+void ProyeccionCartera::proyectarCDP(const ColumnasCDP& columnas, size_t inicio, size_t fin, int meses, double* acumulado) {
+    const double* __restrict interes = columnas.interesMensual.data();
+    const int* __restrict restantes = columnas.mesesRestantes.data();
+
+    for (int mes = 0; mes < meses; mes++) {
+        double total = 0.0;
+        for (size_t i = inicio; i < fin; i++) {
+            total += restantes[i] > mes ? interes[i] : 0.0;
+        }
+        acumulado[mes] += total;
+    }
+}
+
+
+// Definición de método para proyectar los intereses de los próximos meses
+std::vector<FilaProyeccion> ProyeccionCartera::proyectar(int meses, unsigned int hilos) const {
+    if (meses <= 0) {
+        return {};
+    }
+
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Acumuladores independientes por hilo: [moneda][préstamos | CDP][mes]
+    const size_t porHilo = static_cast<size_t>(CANTIDAD_MONEDAS) * 2 * meses;
+    std::vector<double> acumulados(porHilo * hilos, 0.0);
+
+    auto trabajo = [&](unsigned int h) {
+        double* acumulado = acumulados.data() + porHilo * h;
+
+        for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+            // Cada hilo toma un bloque contiguo de cada columna
+            size_t totalPrestamos = prestamos[m].saldo.size();
+            proyectarPrestamos(prestamos[m], totalPrestamos * h / hilos, totalPrestamos * (h + 1) / hilos,
+                               meses, acumulado + (2 * m) * meses);
+
+            size_t totalCDP = cdps[m].interesMensual.size();
+            proyectarCDP(cdps[m], totalCDP * h / hilos, totalCDP * (h + 1) / hilos,
+                         meses, acumulado + (2 * m + 1) * meses);
+        }
+    };
+
+    std::vector<std::thread> trabajadores;
+    for (unsigned int h = 1; h < hilos; h++) {
+        trabajadores.emplace_back(trabajo, h);
+    }
+    trabajo(0); // El hilo actual procesa el primer bloque
+    for (std::thread& t : trabajadores) {
+        t.join();
+    }
+
+    // Reducir los acumuladores de todos los hilos
+    std::vector<FilaProyeccion> filas;
+    filas.reserve(static_cast<size_t>(meses) * CANTIDAD_MONEDAS);
+
+    for (int mes = 0; mes < meses; mes++) {
+        for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+            FilaProyeccion fila{mes + 1, MONEDAS[m], 0.0, 0.0};
+            for (unsigned int h = 0; h < hilos; h++) {
+                const double* acumulado = acumulados.data() + porHilo * h;
+                fila.interesesPrestamos += acumulado[(2 * m) * meses + mes];
+                fila.interesesCDP += acumulado[(2 * m + 1) * meses + mes];
+            }
+            filas.push_back(fila);
+        }
+    }
+
+    return filas;
+}
+
+
+size_t ProyeccionCartera::cantidadPrestamos() const {
+    return prestamos[0].saldo.size() + prestamos[1].saldo.size();
+}
+
+size_t ProyeccionCartera::cantidadCDP() const {
+    return cdps[0].interesMensual.size() + cdps[1].interesMensual.size();
+}
+
+
+// Definición de método estático para exportar la proyección en formato CSV
+bool ProyeccionCartera::exportarCSV(const std::vector<FilaProyeccion>& filas, const std::string& nombreArchivo) {
+    std::ofstream archivo(nombreArchivo);
+
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo para guardar la proyección." << std::endl;
+        return false;
+    }
+
+    archivo << std::fixed << std::setprecision(2); // Salida con dos decimales
+    archivo << "Mes,Moneda,Intereses Prestamos,Intereses CDP,Margen Neto\n";
+
+    for (const FilaProyeccion& fila : filas) {
+        archivo << fila.mes << "," << fila.moneda << "," << fila.interesesPrestamos << ","
+                << fila.interesesCDP << "," << (fila.interesesPrestamos - fila.interesesCDP) << "\n";
+    }
+
+    archivo.close();
+    return !archivo.fail();
+}
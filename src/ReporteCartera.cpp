@@ -0,0 +1,182 @@
+/**
+ * @file ReporteCartera.cpp
+ * @brief Implementación de la clase ReporteCartera para el reporte de estado de toda la cartera de préstamos.
+ * @details Este archivo contiene la definición de los métodos que recorren la tabla Prestamos una sola
+ *          vez, escriben el estado de cada préstamo y acumulan los totales por tipo y moneda.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "ReporteCartera.hpp"
+#include "EscritorCSV.hpp"
+#include "SQLiteStatement.hpp"
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+// Función auxiliar para obtener el índice de un valor codificado (0 si está fuera de la lista)
+static int indiceValor(int valorColumna, int primerValor, int cantidad) {
+    int indice = valorColumna - primerValor;
+    return (indice >= 0 && indice < cantidad) ? indice : 0;
+}
+
+// Función auxiliar para escribir una fila de totales
+static void escribirTotales(EscritorCSV& escritor, const char* tipo, const char* moneda, const TotalesCartera& totales) {
+    escritor.campo(std::string_view("TOTAL"));
+    escritor.campoVacio();
+    escritor.campo(std::string_view(tipo));
+    escritor.campo(std::string_view(moneda));
+    escritor.campo(totales.monto);
+    escritor.campo(totales.cuotaMensual);
+    escritor.campo(totales.cuotasPagadas);
+    escritor.campo(totales.capitalPagado);
+    escritor.campo(totales.interesesPagados);
+    escritor.campo(totales.cuotasRestantes);
+    escritor.campo(totales.saldoPendiente);
+    escritor.campoVacio();
+    escritor.campoVacio();
+    escritor.campo(totales.activos);
+    escritor.finFila();
+}
+
+
+// Definición de método estático para generar el reporte de estado de todos los préstamos
+bool ReporteCartera::generar(sqlite3* db, const std::string& nombreArchivo, ResumenCartera& resumen) {
+    resumen = ResumenCartera();
+
+    try {
+        // Recorrido secuencial de la tabla, en orden de ID
+        SQLiteStatement statement(db, R"(
+            SELECT idPrestamo, idCuenta, tipo, moneda, monto, cuotaMensual, cuotasPagadas, capitalPagado,
+                   interesesPagados, plazoMeses, fechaProximoPago, diasAtraso, activo
+            FROM Prestamos;
+        )");
+
+        EscritorCSV escritor(nombreArchivo);
+        if (!escritor.abierto()) {
+            throw std::runtime_error("Error: No se pudo abrir el archivo para guardar el reporte de cartera.");
+        }
+
+        for (const char* columna : {"ID Prestamo", "ID Cuenta", "Tipo", "Moneda", "Monto", "Cuota Mensual",
+                                    "Cuotas Pagadas", "Aporte al Capital", "Intereses Pagados", "Cuotas Restantes",
+                                    "Saldo Pendiente", "Fecha de Proximo Pago", "Dias de Atraso", "Activo"}) {
+            escritor.campo(std::string_view(columna));
+        }
+        escritor.finFila();
+
+        int resultado;
+        while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+            sqlite3_stmt* fila = statement.get();
+
+            int tipo = indiceValor(sqlite3_column_int(fila, 2), valor(TipoPrestamo::PERSONAL), CANTIDAD_TIPOS_PRESTAMO);
+            int moneda = indiceValor(sqlite3_column_int(fila, 3), valor(Moneda::CRC), CANTIDAD_MONEDAS);
+            double monto = sqlite3_column_double(fila, 4);
+            double cuotaMensual = sqlite3_column_double(fila, 5);
+            int cuotasPagadas = sqlite3_column_int(fila, 6);
+            double capitalPagado = sqlite3_column_double(fila, 7);
+            double interesesPagados = sqlite3_column_double(fila, 8);
+            int plazoMeses = sqlite3_column_int(fila, 9);
+            bool activo = sqlite3_column_int(fila, 12) != 0;
+
+            // Los préstamos cancelados no tienen cuotas ni saldo pendiente
+            int cuotasRestantes = activo ? plazoMeses - cuotasPagadas : 0;
+            double saldoPendiente = activo ? monto - capitalPagado : 0.0;
+
+            escritor.campo(static_cast<long long>(sqlite3_column_int64(fila, 0)));
+            escritor.campo(static_cast<long long>(sqlite3_column_int64(fila, 1)));
+            escritor.campo(std::string_view(TIPOS_PRESTAMO[tipo]));
+            escritor.campo(std::string_view(MONEDAS[moneda]));
+            escritor.campo(monto);
+            escritor.campo(cuotaMensual);
+            escritor.campo(static_cast<long long>(cuotasPagadas));
+            escritor.campo(capitalPagado);
+            escritor.campo(interesesPagados);
+            escritor.campo(static_cast<long long>(cuotasRestantes));
+            escritor.campo(saldoPendiente);
+            const unsigned char* fecha = sqlite3_column_text(fila, 10);
+            escritor.campo(fecha != nullptr ? std::string_view(reinterpret_cast<const char*>(fecha)) : std::string_view());
+            escritor.campo(static_cast<long long>(sqlite3_column_int(fila, 11)));
+            escritor.campo(static_cast<long long>(activo ? 1 : 0));
+            escritor.finFila();
+
+            // Acumular los totales del tipo y la moneda
+            TotalesCartera& totales = resumen.segmentos[tipo][moneda];
+            totales.prestamos++;
+            totales.monto += monto;
+            totales.cuotasPagadas += cuotasPagadas;
+            totales.capitalPagado += capitalPagado;
+            totales.interesesPagados += interesesPagados;
+            if (activo) {
+                totales.activos++;
+                totales.cuotaMensual += cuotaMensual;
+                totales.cuotasRestantes += cuotasRestantes;
+                totales.saldoPendiente += saldoPendiente;
+            }
+        }
+
+        if (resultado != SQLITE_DONE) {
+            throw std::runtime_error("Error al leer los préstamos: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        // Totales por tipo y moneda, y de toda la cartera
+        for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+            for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+                const TotalesCartera& totales = resumen.segmentos[t][m];
+                if (totales.prestamos == 0) {
+                    continue;
+                }
+                escribirTotales(escritor, TIPOS_PRESTAMO[t], MONEDAS[m], totales);
+
+                resumen.total.prestamos += totales.prestamos;
+                resumen.total.activos += totales.activos;
+                resumen.total.cuotasPagadas += totales.cuotasPagadas;
+                resumen.total.cuotasRestantes += totales.cuotasRestantes;
+            }
+        }
+
+        if (!escritor.cerrar()) {
+            throw std::runtime_error("Error: No se pudo escribir el archivo del reporte de cartera.");
+        }
+
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Definición de método estático para mostrar los totales de la cartera
+void ReporteCartera::mostrarResumen(const ResumenCartera& resumen) {
+    if (resumen.total.prestamos == 0) {
+        std::cout << "No hay préstamos registrados." << std::endl;
+        return;
+    }
+
+    std::cout << "\n=== Reporte de Cartera ===" << std::endl;
+    std::cout << std::setw(6) << "Tipo" << std::setw(8) << "Moneda" << std::setw(11) << "Préstamos"
+              << std::setw(9) << "Activos" << std::setw(18) << "Monto" << std::setw(18) << "Capital Pagado"
+              << std::setw(18) << "Intereses" << std::setw(18) << "Saldo Pendiente"
+              << std::setw(14) << "Cuotas Rest." << std::endl;
+
+    for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+        for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+            const TotalesCartera& totales = resumen.segmentos[t][m];
+            if (totales.prestamos == 0) {
+                continue;
+            }
+            std::cout << std::setw(6) << TIPOS_PRESTAMO[t] << std::setw(8) << MONEDAS[m]
+                      << std::setw(10) << totales.prestamos << std::setw(9) << totales.activos
+                      << std::setw(18) << totales.monto << std::setw(18) << totales.capitalPagado
+                      << std::setw(18) << totales.interesesPagados << std::setw(18) << totales.saldoPendiente
+                      << std::setw(14) << totales.cuotasRestantes << std::endl;
+        }
+    }
+
+    std::cout << "Total: " << resumen.total.prestamos << " préstamos (" << resumen.total.activos
+              << " activos), " << resumen.total.cuotasRestantes << " cuotas restantes" << std::endl;
+}
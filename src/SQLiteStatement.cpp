@@ -13,6 +13,7 @@
 #include "SQLiteStatement.hpp"
 
 #include <sqlite3.h>
+#include <charconv>
 #include <iostream>
 
 
@@ -39,4 +40,24 @@ SQLiteStatement::~SQLiteStatement() {
 
 sqlite3_stmt* SQLiteStatement::get() const {
     return stmt_; // Retorna el statement preparado
-}
\ No newline at end of file
+}
+
+// Definición de método para asignar una lista de enteros como arreglo JSON
+void SQLiteStatement::bindLista(int indice, std::span<const int> valores) {
+    // Cada entero ocupa a lo sumo 11 caracteres más la coma
+    std::string lista(valores.size() * 12 + 2, '\0');
+    char* actual = lista.data();
+    *actual++ = '[';
+    for (size_t i = 0; i < valores.size(); ++i) {
+        if (i > 0) {
+            *actual++ = ',';
+        }
+        actual = std::to_chars(actual, lista.data() + lista.size(), valores[i]).ptr;
+    }
+    *actual++ = ']';
+    lista.resize(actual - lista.data());
+
+    if (sqlite3_bind_text(stmt_, indice, lista.c_str(), static_cast<int>(lista.size()), SQLITE_TRANSIENT) != SQLITE_OK) {
+        throw std::runtime_error("Error al asignar la lista de la consulta: " + std::string(sqlite3_errmsg(sqlite3_db_handle(stmt_))));
+    }
+}
@@ -0,0 +1,514 @@
+/**
+ * @file Servidor.cpp
+ * @brief Implementación de la clase Servidor para atender varias ventanillas desde un solo proceso.
+ * @details Este archivo contiene la definición de los métodos de la clase Servidor: el ciclo
+ *          de eventos `epoll` sobre el socket de dominio Unix, la separación de las solicitudes de cada
+ *          conexión, las corrutinas que ejecutan las operaciones y el envío de las respuestas.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#ifdef __linux__
+
+#include "Servidor.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/// @brief Identificadores de `epoll` reservados para el socket de escucha y el `eventfd`.
+constexpr uint64_t ID_ESCUCHA = 0;
+constexpr uint64_t ID_EVENTO = 1;
+
+// Función auxiliar para agregar un entero de 32 bits en little-endian
+static void escribirEntero(std::string& destino, uint32_t valor) {
+    for (int i = 0; i < 4; i++) {
+        destino.push_back(static_cast<char>(valor >> (8 * i)));
+    }
+}
+
+// Función auxiliar para agregar un número de punto flotante de 64 bits en little-endian
+static void escribirDecimal(std::string& destino, double valor) {
+    uint64_t bits;
+    std::memcpy(&bits, &valor, sizeof(bits));
+    for (int i = 0; i < 8; i++) {
+        destino.push_back(static_cast<char>(bits >> (8 * i)));
+    }
+}
+
+// Función auxiliar para leer un entero de 32 bits en little-endian
+static uint32_t leerEntero(const char* datos) {
+    uint32_t valor = 0;
+    for (int i = 0; i < 4; i++) {
+        valor |= static_cast<uint32_t>(static_cast<uint8_t>(datos[i])) << (8 * i);
+    }
+    return valor;
+}
+
+// Función auxiliar para armar la trama de una respuesta
+static std::string armarRespuesta(uint32_t id, EstadoRespuesta estado, const std::string& datos) {
+    std::string trama;
+    trama.reserve(9 + datos.size());
+    escribirEntero(trama, static_cast<uint32_t>(5 + datos.size()));
+    escribirEntero(trama, id);
+    trama.push_back(static_cast<char>(estado));
+    trama += datos;
+    return trama;
+}
+
+/**
+ * @class LectorArgumentos
+ * @brief Lee en orden los argumentos de una solicitud.
+ */
+class LectorArgumentos {
+    private:
+        const std::string& datos;
+        size_t posicion = 0;
+
+    public:
+        explicit LectorArgumentos(const std::string& datos) : datos(datos) {}
+
+        bool leer(int32_t& valor) {
+            if (datos.size() - posicion < 4) return false;
+            valor = static_cast<int32_t>(leerEntero(datos.data() + posicion));
+            posicion += 4;
+            return true;
+        }
+
+        bool leer(double& valor) {
+            if (datos.size() - posicion < 8) return false;
+            uint64_t bits = leerEntero(datos.data() + posicion) | static_cast<uint64_t>(leerEntero(datos.data() + posicion + 4)) << 32;
+            std::memcpy(&valor, &bits, sizeof(valor));
+            posicion += 8;
+            return true;
+        }
+
+        // Verifica que no sobren bytes después del último argumento
+        bool completo() const {
+            return posicion == datos.size();
+        }
+};
+
+
+// Definición del constructor de la clase Servidor
+Servidor::Servidor(const std::string& nombreDB, const std::string& rutaSocket, unsigned int hilosLectura)
+    : nombreDB(nombreDB), rutaSocket(rutaSocket), hilosLectura(hilosLectura),
+      ejecutor([this] { despertar(); }), siguienteConexion(ID_EVENTO + 1) {}
+
+// Definición del destructor de la clase Servidor
+Servidor::~Servidor() {
+    activo = false;
+
+    // Terminar las operaciones en curso antes de cerrar las conexiones
+    if (banco) {
+        banco->cerrar();
+        ejecutor.ejecutarListas();
+    }
+
+    for (auto& [id, conexion] : conexiones) {
+        close(conexion.descriptor);
+    }
+
+    if (descriptorEscucha >= 0) {
+        close(descriptorEscucha);
+        unlink(rutaSocket.c_str());
+    }
+    if (descriptorEpoll >= 0) close(descriptorEpoll);
+    if (descriptorEvento >= 0) close(descriptorEvento);
+}
+
+
+
+
+// Definición de método para crear el socket de escucha e iniciar los pools de BancoAsincrono
+bool Servidor::iniciar() {
+    if (hilosLectura == 0) {
+        hilosLectura = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // El eventfd debe existir antes de que los pools puedan despertar al ciclo de eventos
+    descriptorEpoll = epoll_create1(EPOLL_CLOEXEC);
+    descriptorEvento = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (descriptorEpoll < 0 || descriptorEvento < 0) {
+        std::clog << "Error: No se pudo crear el ciclo de eventos: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    try {
+        banco = std::make_unique<BancoAsincrono>(ejecutor, nombreDB, hilosLectura);
+    } catch (const std::runtime_error& e) {
+        std::clog << e.what() << std::endl;
+        return false;
+    }
+
+    // Socket de escucha
+    sockaddr_un direccion{};
+    direccion.sun_family = AF_UNIX;
+    if (rutaSocket.empty() || rutaSocket.size() >= sizeof(direccion.sun_path)) {
+        std::clog << "Error: Ruta del socket inválida: " << rutaSocket << std::endl;
+        return false;
+    }
+    std::memcpy(direccion.sun_path, rutaSocket.c_str(), rutaSocket.size() + 1);
+
+    // Eliminar un socket anterior que haya quedado en la ruta
+    struct stat informacion;
+    if (stat(rutaSocket.c_str(), &informacion) == 0 && S_ISSOCK(informacion.st_mode)) {
+        unlink(rutaSocket.c_str());
+    }
+
+    descriptorEscucha = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (descriptorEscucha < 0
+        || bind(descriptorEscucha, reinterpret_cast<sockaddr*>(&direccion), sizeof(direccion)) < 0
+        || listen(descriptorEscucha, SOMAXCONN) < 0) {
+        std::clog << "Error: No se pudo escuchar en " << rutaSocket << ": " << std::strerror(errno) << std::endl;
+        if (descriptorEscucha >= 0) {
+            close(descriptorEscucha);
+            descriptorEscucha = -1;
+        }
+        return false;
+    }
+
+    epoll_event evento{};
+    evento.events = EPOLLIN;
+    evento.data.u64 = ID_ESCUCHA;
+    epoll_ctl(descriptorEpoll, EPOLL_CTL_ADD, descriptorEscucha, &evento);
+    evento.data.u64 = ID_EVENTO;
+    epoll_ctl(descriptorEpoll, EPOLL_CTL_ADD, descriptorEvento, &evento);
+
+    activo = true;
+    return true;
+}
+
+
+// Definición de método para despertar al ciclo de eventos
+void Servidor::despertar() {
+    uint64_t uno = 1;
+    if (write(descriptorEvento, &uno, sizeof(uno)) < 0) {
+        // Si el eventfd está saturado el ciclo ya tiene un aviso pendiente
+    }
+}
+
+// Definición de método para solicitar detener el ciclo de eventos
+void Servidor::detener() {
+    activo = false;
+    despertar();
+}
+
+
+// Definición de método para ejecutar el ciclo de eventos
+void Servidor::ejecutar() {
+    // Los mensajes de las clases no pasan por std::cout ni std::cerr: BancoAsincrono los captura por
+    // operación en flujos propios del hilo del pool y devuelve los de error como detalle de la respuesta
+    epoll_event eventos[128];
+
+    while (activo) {
+        int cantidad = epoll_wait(descriptorEpoll, eventos, 128, -1);
+        if (cantidad < 0) {
+            if (errno == EINTR) continue;
+            std::clog << "Error en el ciclo de eventos: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < cantidad; i++) {
+            uint64_t id = eventos[i].data.u64;
+
+            if (id == ID_ESCUCHA) {
+                aceptarConexiones();
+            } else if (id == ID_EVENTO) {
+                uint64_t avisos;
+                if (read(descriptorEvento, &avisos, sizeof(avisos)) < 0) {
+                    // Sin avisos pendientes
+                }
+                ejecutor.ejecutarListas(); // Reanudar las corrutinas con operaciones terminadas
+            } else {
+                auto it = conexiones.find(id);
+                if (it == conexiones.end()) continue;
+
+                if (eventos[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    leerConexion(id, it->second);
+                    it = conexiones.find(id); // La conexión pudo cerrarse
+                }
+                if (it != conexiones.end() && (eventos[i].events & EPOLLOUT)) {
+                    escribirConexion(id, it->second);
+                }
+            }
+        }
+
+        enviarRespuestas();
+    }
+
+    // Terminar las operaciones en curso y enviar sus respuestas
+    banco->cerrar();
+    ejecutor.ejecutarListas();
+    enviarRespuestas();
+}
+
+
+// Definición de método para aceptar las conexiones pendientes
+void Servidor::aceptarConexiones() {
+    while (true) {
+        int descriptor = accept4(descriptorEscucha, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (descriptor < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                std::clog << "Error al aceptar una conexión: " << std::strerror(errno) << std::endl;
+            }
+            return;
+        }
+
+        uint64_t id = siguienteConexion++;
+        Conexion& conexion = conexiones[id];
+        conexion.descriptor = descriptor;
+        conexion.eventos = EPOLLIN;
+
+        epoll_event evento{};
+        evento.events = conexion.eventos;
+        evento.data.u64 = id;
+        epoll_ctl(descriptorEpoll, EPOLL_CTL_ADD, descriptor, &evento);
+    }
+}
+
+
+// Definición de método para leer los datos disponibles de una conexión
+void Servidor::leerConexion(uint64_t id, Conexion& conexion) {
+    char buffer[65536];
+
+    while (true) {
+        ssize_t leidos = recv(conexion.descriptor, buffer, sizeof(buffer), 0);
+        if (leidos > 0) {
+            conexion.entrada.append(buffer, static_cast<size_t>(leidos));
+            continue;
+        }
+        if (leidos == 0) {
+            // El cliente terminó de enviar; las tramas de esta misma lectura todavía se atienden
+            conexion.finEntrada = true;
+            break;
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+
+        cerrarConexion(id); // Error de la conexión
+        return;
+    }
+
+    if (procesarSolicitudes(id, conexion)) {
+        escribirConexion(id, conexion);
+    }
+}
+
+
+// Definición de método para separar las solicitudes completas de una conexión y lanzar sus corrutinas
+bool Servidor::procesarSolicitudes(uint64_t id, Conexion& conexion) {
+    const std::string& entrada = conexion.entrada;
+    size_t posicion = 0;
+
+    while (conexion.pendientes < MAXIMO_PENDIENTES && entrada.size() - posicion >= 4) {
+        uint32_t largo = leerEntero(entrada.data() + posicion);
+        if (largo < 5 || largo > MAXIMO_TRAMA) {
+            cerrarConexion(id); // Trama inválida: no se puede recuperar la sincronía
+            return false;
+        }
+        if (entrada.size() - posicion - 4 < largo) {
+            break; // Trama incompleta
+        }
+
+        const char* trama = entrada.data() + posicion + 4;
+        Solicitud solicitud{id, leerEntero(trama), static_cast<uint8_t>(trama[4]), std::string(trama + 5, largo - 5)};
+        posicion += 4 + largo;
+
+        conexion.pendientes++;
+        ejecutor.lanzar(atender(std::move(solicitud)));
+    }
+
+    conexion.entrada.erase(0, posicion);
+
+    // Dejar de leer de la conexión mientras tenga demasiadas solicitudes pendientes
+    conexion.leyendo = conexion.pendientes < MAXIMO_PENDIENTES;
+    return true;
+}
+
+
+// Definición de método para enviar los datos pendientes de una conexión
+bool Servidor::escribirConexion(uint64_t id, Conexion& conexion) {
+    size_t enviados = 0;
+
+    while (enviados < conexion.salida.size()) {
+        ssize_t resultado = send(conexion.descriptor, conexion.salida.data() + enviados,
+                                 conexion.salida.size() - enviados, MSG_NOSIGNAL);
+        if (resultado > 0) {
+            enviados += static_cast<size_t>(resultado);
+            continue;
+        }
+        if (resultado < 0 && errno == EINTR) continue;
+        if (resultado < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+        cerrarConexion(id);
+        return false;
+    }
+
+    conexion.salida.erase(0, enviados);
+
+    // Un cliente que cerró su lado de escritura se desconecta cuando ya recibió todas sus respuestas
+    if (conexion.finEntrada && conexion.pendientes == 0 && conexion.salida.empty()) {
+        cerrarConexion(id);
+        return false;
+    }
+
+    actualizarEventos(id, conexion);
+    return true;
+}
+
+
+// Definición de método para enviar las respuestas nuevas de cada conexión
+void Servidor::enviarRespuestas() {
+    std::vector<uint64_t> actualizadas;
+    actualizadas.swap(conexionesConRespuestas);
+
+    std::sort(actualizadas.begin(), actualizadas.end());
+    actualizadas.erase(std::unique(actualizadas.begin(), actualizadas.end()), actualizadas.end());
+
+    for (uint64_t id : actualizadas) {
+        auto it = conexiones.find(id);
+        if (it == conexiones.end()) continue;
+
+        Conexion& conexion = it->second;
+
+        // Reanudar la lectura y procesar las solicitudes que quedaron en espera
+        if (!conexion.leyendo && conexion.pendientes <= MAXIMO_PENDIENTES / 2
+            && !procesarSolicitudes(id, conexion)) {
+            continue;
+        }
+
+        escribirConexion(id, conexion);
+    }
+}
+
+
+// Definición de método para actualizar los eventos de epoll de una conexión
+void Servidor::actualizarEventos(uint64_t id, Conexion& conexion) {
+    uint32_t eventos = (conexion.leyendo && !conexion.finEntrada ? EPOLLIN : 0) | (conexion.salida.empty() ? 0 : EPOLLOUT);
+    if (eventos == conexion.eventos) {
+        return;
+    }
+
+    // Sin eventos el descriptor se quita de epoll, que de lo contrario seguiría reportando EPOLLHUP
+    // mientras se esperan las respuestas de un cliente que ya cerró la conexión
+    int operacion = conexion.eventos == 0 ? EPOLL_CTL_ADD : eventos == 0 ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+    conexion.eventos = eventos;
+    epoll_event evento{};
+    evento.events = eventos;
+    evento.data.u64 = id;
+    epoll_ctl(descriptorEpoll, operacion, conexion.descriptor, &evento);
+}
+
+
+// Definición de método para cerrar una conexión
+void Servidor::cerrarConexion(uint64_t id) {
+    auto it = conexiones.find(id);
+    if (it == conexiones.end()) return;
+
+    if (it->second.eventos != 0) {
+        epoll_ctl(descriptorEpoll, EPOLL_CTL_DEL, it->second.descriptor, nullptr);
+    }
+    close(it->second.descriptor);
+    conexiones.erase(it);
+}
+
+
+// Definición de método para agregar una respuesta a la salida de su conexión
+void Servidor::responder(uint64_t idConexion, std::string trama) {
+    auto it = conexiones.find(idConexion);
+    if (it == conexiones.end()) {
+        return; // La conexión se cerró antes de la respuesta
+    }
+
+    it->second.salida += trama;
+    it->second.pendientes--;
+    conexionesConRespuestas.push_back(idConexion);
+}
+
+
+// Definición de corrutina para ejecutar una solicitud con BancoAsincrono
+Tarea<void> Servidor::atender(Solicitud solicitud) {
+    LectorArgumentos argumentos(solicitud.argumentos);
+    std::optional<Tarea<ResultadoOperacion>> operacion;
+    int32_t idCuenta, idDestino, entero;
+    double monto, tasa;
+
+    // Iniciar la operación si los argumentos tienen el formato esperado
+    switch (static_cast<OperacionServidor>(solicitud.operacion)) {
+        case OperacionServidor::SALDO:
+            if (argumentos.leer(idCuenta) && argumentos.completo()) {
+                operacion.emplace(banco->verSaldo(idCuenta));
+            }
+            break;
+        case OperacionServidor::DEPOSITO:
+            if (argumentos.leer(idCuenta) && argumentos.leer(monto) && argumentos.completo()) {
+                operacion.emplace(banco->depositar(idCuenta, monto));
+            }
+            break;
+        case OperacionServidor::RETIRO:
+            if (argumentos.leer(idCuenta) && argumentos.leer(monto) && argumentos.completo()) {
+                operacion.emplace(banco->retirar(idCuenta, monto));
+            }
+            break;
+        case OperacionServidor::TRANSFERENCIA:
+            if (argumentos.leer(idCuenta) && argumentos.leer(idDestino) && argumentos.leer(monto) && argumentos.completo()) {
+                operacion.emplace(banco->transferir(idCuenta, idDestino, monto));
+            }
+            break;
+        case OperacionServidor::ABONO:
+            if (argumentos.leer(idDestino) && argumentos.leer(idCuenta) && argumentos.leer(entero) && argumentos.completo()) {
+                operacion.emplace(banco->abonarCuotas(idDestino, idCuenta, entero));
+            }
+            break;
+        case OperacionServidor::CDP:
+            if (argumentos.leer(idCuenta) && argumentos.leer(monto) && argumentos.leer(entero)
+                && argumentos.leer(tasa) && argumentos.completo()) {
+                operacion.emplace(banco->solicitarCDP(idCuenta, monto, entero, tasa));
+            }
+            break;
+        case OperacionServidor::CLIENTE:
+            if (argumentos.leer(entero) && argumentos.completo()) {
+                operacion.emplace(banco->buscarCliente(entero));
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (!operacion) {
+        responder(solicitud.conexion, armarRespuesta(solicitud.id, EstadoRespuesta::SOLICITUD_INVALIDA,
+                                                     "Error: Operación o argumentos inválidos."));
+        co_return;
+    }
+
+    // Suspender hasta que el pool termine la operación; se reanuda en el hilo del ciclo de eventos
+    ResultadoOperacion resultado = co_await std::move(*operacion);
+
+    if (!resultado.exito) {
+        responder(solicitud.conexion, armarRespuesta(solicitud.id, EstadoRespuesta::ERROR,
+                                                     resultado.detalle.empty() ? "Error: No se pudo realizar la operación."
+                                                                               : resultado.detalle));
+        co_return;
+    }
+
+    std::string datos;
+    if (static_cast<OperacionServidor>(solicitud.operacion) == OperacionServidor::CLIENTE) {
+        escribirEntero(datos, static_cast<uint32_t>(resultado.valor));
+    } else {
+        escribirDecimal(datos, resultado.valor);
+    }
+    responder(solicitud.conexion, armarRespuesta(solicitud.id, EstadoRespuesta::OK, datos));
+}
+
+#endif // __linux__
@@ -0,0 +1,339 @@
+/**
+ * @file SimuladorCartera.cpp
+ * @brief Implementación de la clase SimuladorCartera para simular choques de tasa e impagos en la cartera.
+ * @details Este archivo contiene la definición de los métodos de la clase SimuladorCartera, que permiten
+ *          cargar los préstamos activos, ejecutar los escenarios Monte Carlo en paralelo y reportar la
+ *          distribución de flujos de caja y pérdidas por tipo de préstamo y moneda.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "SimuladorCartera.hpp"
+#include "Prestamo.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+
+/// @brief Cantidad de escenarios que toma un hilo cada vez que consulta el contador compartido.
+constexpr int ESCENARIOS_POR_BLOQUE = 8;
+
+/// @brief Tasa de interés anual mínima (%) después de aplicar un choque negativo.
+constexpr double TASA_MINIMA = 0.01;
+
+/**
+ * @struct Acumulador
+ * @brief Estadísticas acumuladas de un segmento, actualizadas escenario por escenario.
+ *
+ * Usa el método de Welford para la media y la varianza, y un histograma de pérdidas relativo a la
+ * exposición del segmento para estimar los percentiles con memoria constante.
+ */
+struct Acumulador {
+    long escenarios = 0;
+    double flujoMedia = 0.0, flujoM2 = 0.0;
+    double flujoMinimo = std::numeric_limits<double>::max(), flujoMaximo = std::numeric_limits<double>::lowest();
+    double perdidaMedia = 0.0, perdidaM2 = 0.0, perdidaMaxima = 0.0;
+    std::vector<uint64_t> histograma = std::vector<uint64_t>(INTERVALOS_HISTOGRAMA, 0);
+
+    // Agregar el resultado de un escenario
+    void agregar(double flujo, double perdida, double exposicion) {
+        escenarios++;
+
+        double delta = flujo - flujoMedia;
+        flujoMedia += delta / escenarios;
+        flujoM2 += delta * (flujo - flujoMedia);
+        flujoMinimo = std::min(flujoMinimo, flujo);
+        flujoMaximo = std::max(flujoMaximo, flujo);
+
+        delta = perdida - perdidaMedia;
+        perdidaMedia += delta / escenarios;
+        perdidaM2 += delta * (perdida - perdidaMedia);
+        perdidaMaxima = std::max(perdidaMaxima, perdida);
+
+        int intervalo = exposicion > 0 ? static_cast<int>(perdida / exposicion * INTERVALOS_HISTOGRAMA) : 0;
+        histograma[std::clamp(intervalo, 0, INTERVALOS_HISTOGRAMA - 1)]++;
+    }
+
+    // Combinar las estadísticas de otro hilo (fórmula de Chan para la varianza)
+    void combinar(const Acumulador& otro) {
+        if (otro.escenarios == 0) {
+            return;
+        }
+
+        long total = escenarios + otro.escenarios;
+        double delta = otro.flujoMedia - flujoMedia;
+        flujoM2 += otro.flujoM2 + delta * delta * escenarios * otro.escenarios / total;
+        flujoMedia += delta * otro.escenarios / total;
+
+        delta = otro.perdidaMedia - perdidaMedia;
+        perdidaM2 += otro.perdidaM2 + delta * delta * escenarios * otro.escenarios / total;
+        perdidaMedia += delta * otro.escenarios / total;
+
+        flujoMinimo = std::min(flujoMinimo, otro.flujoMinimo);
+        flujoMaximo = std::max(flujoMaximo, otro.flujoMaximo);
+        perdidaMaxima = std::max(perdidaMaxima, otro.perdidaMaxima);
+        escenarios = total;
+
+        for (int i = 0; i < INTERVALOS_HISTOGRAMA; i++) {
+            histograma[i] += otro.histograma[i];
+        }
+    }
+
+    // Estimar un percentil de la pérdida con el límite superior del intervalo correspondiente
+    double percentilPerdida(double q, double exposicion) const {
+        uint64_t objetivo = static_cast<uint64_t>(std::ceil(q * escenarios));
+        uint64_t acumulado = 0;
+        for (int i = 0; i < INTERVALOS_HISTOGRAMA; i++) {
+            acumulado += histograma[i];
+            if (acumulado >= objetivo) {
+                return std::min(perdidaMaxima, exposicion * (i + 1) / INTERVALOS_HISTOGRAMA);
+            }
+        }
+        return perdidaMaxima;
+    }
+};
+
+// Función auxiliar para derivar la semilla de un escenario (splitmix64)
+static uint64_t semillaEscenario(uint64_t semilla, uint64_t escenario) {
+    uint64_t z = semilla + (escenario + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Función auxiliar para obtener el índice de un valor codificado (0 si está fuera de la lista)
+static uint8_t indiceValor(int valorColumna, int primerValor, int cantidad) {
+    int indice = valorColumna - primerValor;
+    return (indice >= 0 && indice < cantidad) ? static_cast<uint8_t>(indice) : 0;
+}
+
+
+// Definición de método para cargar los préstamos activos
+bool SimuladorCartera::cargar(sqlite3* db) {
+    tipo.clear();
+    moneda.clear();
+    saldo.clear();
+    tasaInteres.clear();
+    cuotasRestantes.clear();
+
+    try {
+        SQLiteStatement statement(db, R"(
+            SELECT tipo, moneda, monto - capitalPagado, tasaInteres, plazoMeses - cuotasPagadas
+            FROM Prestamos WHERE activo = 1;
+        )");
+
+        while (sqlite3_step(statement.get()) == SQLITE_ROW) {
+            tipo.push_back(indiceValor(sqlite3_column_int(statement.get(), 0), valor(TipoPrestamo::PERSONAL), CANTIDAD_TIPOS_PRESTAMO));
+            moneda.push_back(indiceValor(sqlite3_column_int(statement.get(), 1), valor(Moneda::CRC), CANTIDAD_MONEDAS));
+            saldo.push_back(sqlite3_column_double(statement.get(), 2));
+            tasaInteres.push_back(sqlite3_column_double(statement.get(), 3));
+            cuotasRestantes.push_back(sqlite3_column_int(statement.get(), 4));
+        }
+
+        return true;
+
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+}
+
+
+// Definición de método para ejecutar la simulación
+ResultadoSimulacion SimuladorCartera::simular(const ParametrosSimulacion& parametros) const {
+    auto inicio = std::chrono::steady_clock::now();
+
+    ResultadoSimulacion resultado;
+    resultado.escenarios = std::max(0, parametros.escenarios);
+    resultado.prestamos = saldo.size();
+
+    // Cantidad de préstamos y exposición de cada segmento
+    for (size_t i = 0; i < saldo.size(); i++) {
+        resultado.segmentos[tipo[i]][moneda[i]].prestamos++;
+        resultado.segmentos[tipo[i]][moneda[i]].exposicion += std::max(0.0, saldo[i]);
+    }
+
+    unsigned int hilos = parametros.hilos;
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Acumuladores independientes por hilo y contador compartido de escenarios
+    std::vector<std::vector<Acumulador>> acumuladores(hilos, std::vector<Acumulador>(CANTIDAD_TIPOS_PRESTAMO * CANTIDAD_MONEDAS));
+    std::atomic<int> siguienteEscenario{0};
+
+    auto trabajo = [&](unsigned int h) {
+        std::vector<Acumulador>& acumulador = acumuladores[h];
+        std::mt19937_64 generador;
+        std::normal_distribution<double> choqueTasa(0.0, parametros.volatilidadTasa);
+        std::uniform_real_distribution<double> uniforme(0.0, 1.0);
+
+        int bloque;
+        while ((bloque = siguienteEscenario.fetch_add(ESCENARIOS_POR_BLOQUE)) < resultado.escenarios) {
+            int finBloque = std::min(bloque + ESCENARIOS_POR_BLOQUE, resultado.escenarios);
+
+            for (int escenario = bloque; escenario < finBloque; escenario++) {
+                generador.seed(semillaEscenario(parametros.semilla, escenario));
+                choqueTasa.reset();
+                double choque = choqueTasa(generador);
+
+                // Probabilidad mensual de impago de cada tipo, ajustada por el choque de tasa
+                double logSupervivencia[CANTIDAD_TIPOS_PRESTAMO];
+                for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+                    double anual = std::clamp(parametros.probabilidadImpago[t] * (1 + parametros.sensibilidadImpago * choque), 0.0, 1.0);
+                    double mensual = 1 - std::pow(1 - anual, 1.0 / 12);
+                    logSupervivencia[t] = mensual > 0 ? std::log1p(-mensual) : 0.0;
+                }
+
+                double flujo[CANTIDAD_TIPOS_PRESTAMO][CANTIDAD_MONEDAS] = {};
+                double perdida[CANTIDAD_TIPOS_PRESTAMO][CANTIDAD_MONEDAS] = {};
+
+                for (size_t i = 0; i < saldo.size(); i++) {
+                    int restantes = cuotasRestantes[i];
+                    if (restantes <= 0 || saldo[i] <= 0) {
+                        continue;
+                    }
+
+                    int t = tipo[i];
+                    int m = moneda[i];
+
+                    // Recalcular la cuota del saldo pendiente con la tasa del escenario
+                    double tasa = std::max(tasaInteres[i] + choque, TASA_MINIMA);
+                    double cuota = Prestamo::calcularCuotaMensual(saldo[i], tasa, restantes);
+
+                    // Mes de impago con distribución geométrica (después del plazo si no hay impago)
+                    int mesImpago = restantes + 1;
+                    if (logSupervivencia[t] < 0) {
+                        double meses = std::floor(std::log(1.0 - uniforme(generador)) / logSupervivencia[t]);
+                        mesImpago = 1 + static_cast<int>(std::min(meses, static_cast<double>(restantes)));
+                    }
+
+                    if (mesImpago <= restantes) {
+                        int pagos = mesImpago - 1;
+                        double saldoImpago = Prestamo::calcularSaldoRestante(saldo[i], tasa, cuota, pagos);
+                        flujo[t][m] += pagos * cuota + saldoImpago * parametros.recuperacion[t];
+                        perdida[t][m] += saldoImpago * (1 - parametros.recuperacion[t]);
+                    } else {
+                        flujo[t][m] += restantes * cuota;
+                    }
+                }
+
+                // Reducir el escenario en las estadísticas del hilo
+                for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+                    for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+                        acumulador[t * CANTIDAD_MONEDAS + m].agregar(flujo[t][m], perdida[t][m], resultado.segmentos[t][m].exposicion);
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> trabajadores;
+    for (unsigned int h = 1; h < hilos; h++) {
+        trabajadores.emplace_back(trabajo, h);
+    }
+    trabajo(0); // El hilo actual también procesa escenarios
+    for (std::thread& t : trabajadores) {
+        t.join();
+    }
+
+    // Combinar las estadísticas de todos los hilos
+    for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+        for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+            Acumulador total;
+            for (unsigned int h = 0; h < hilos; h++) {
+                total.combinar(acumuladores[h][t * CANTIDAD_MONEDAS + m]);
+            }
+
+            EstadisticasSegmento& segmento = resultado.segmentos[t][m];
+            if (total.escenarios == 0) {
+                continue;
+            }
+            segmento.flujoMedio = total.flujoMedia;
+            segmento.flujoDesviacion = total.escenarios > 1 ? std::sqrt(total.flujoM2 / (total.escenarios - 1)) : 0.0;
+            segmento.flujoMinimo = total.flujoMinimo;
+            segmento.flujoMaximo = total.flujoMaximo;
+            segmento.perdidaMedia = total.perdidaMedia;
+            segmento.perdidaDesviacion = total.escenarios > 1 ? std::sqrt(total.perdidaM2 / (total.escenarios - 1)) : 0.0;
+            segmento.perdidaP95 = total.percentilPerdida(0.95, segmento.exposicion);
+            segmento.perdidaP99 = total.percentilPerdida(0.99, segmento.exposicion);
+            segmento.perdidaMaxima = total.perdidaMaxima;
+        }
+    }
+
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    double combinaciones = static_cast<double>(resultado.prestamos) * resultado.escenarios;
+    resultado.segundosPorMillon = combinaciones > 0 ? resultado.segundos / (combinaciones / 1e6) : 0.0;
+
+    return resultado;
+}
+
+
+size_t SimuladorCartera::cantidadPrestamos() const {
+    return saldo.size();
+}
+
+
+// Definición de método estático para mostrar el resultado en la terminal
+void SimuladorCartera::mostrarResultado(const ResultadoSimulacion& resultado) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Resultado de la Simulación ===" << std::endl;
+    std::cout << std::setw(6) << "Tipo" << std::setw(8) << "Moneda" << std::setw(12) << "Préstamos"
+              << std::setw(18) << "Exposición" << std::setw(18) << "Flujo Medio" << std::setw(18) << "Pérdida Media"
+              << std::setw(18) << "Pérdida P95" << std::setw(18) << "Pérdida P99" << std::endl;
+
+    for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+        for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+            const EstadisticasSegmento& segmento = resultado.segmentos[t][m];
+            if (segmento.prestamos == 0) {
+                continue;
+            }
+            std::cout << std::setw(6) << TIPOS_PRESTAMO[t] << std::setw(8) << MONEDAS[m] << std::setw(11) << segmento.prestamos
+                      << std::setw(18) << segmento.exposicion << std::setw(18) << segmento.flujoMedio
+                      << std::setw(18) << segmento.perdidaMedia << std::setw(18) << segmento.perdidaP95
+                      << std::setw(18) << segmento.perdidaP99 << std::endl;
+        }
+    }
+
+    std::cout << "\nEscenarios: " << resultado.escenarios << ", préstamos: " << resultado.prestamos << std::endl;
+    std::cout << "Tiempo total: " << resultado.segundos << " s (" << std::setprecision(4)
+              << resultado.segundosPorMillon << " s por millón de préstamo-escenarios)" << std::endl;
+    std::cout << std::setprecision(2);
+}
+
+// Definición de método estático para exportar el resultado en formato CSV
+bool SimuladorCartera::exportarCSV(const ResultadoSimulacion& resultado, const std::string& nombreArchivo) {
+    std::ofstream archivo(nombreArchivo);
+
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo para guardar la simulación." << std::endl;
+        return false;
+    }
+
+    archivo << std::fixed << std::setprecision(2); // Salida con dos decimales
+    archivo << "Tipo,Moneda,Prestamos,Exposicion,Flujo Medio,Flujo Desviacion,Flujo Minimo,Flujo Maximo,"
+               "Perdida Media,Perdida Desviacion,Perdida P95,Perdida P99,Perdida Maxima\n";
+
+    for (int t = 0; t < CANTIDAD_TIPOS_PRESTAMO; t++) {
+        for (int m = 0; m < CANTIDAD_MONEDAS; m++) {
+            const EstadisticasSegmento& s = resultado.segmentos[t][m];
+            archivo << TIPOS_PRESTAMO[t] << "," << MONEDAS[m] << "," << s.prestamos << "," << s.exposicion << ","
+                    << s.flujoMedio << "," << s.flujoDesviacion << "," << s.flujoMinimo << "," << s.flujoMaximo << ","
+                    << s.perdidaMedia << "," << s.perdidaDesviacion << "," << s.perdidaP95 << "," << s.perdidaP99 << ","
+                    << s.perdidaMaxima << "\n";
+        }
+    }
+
+    archivo.close();
+    return !archivo.fail();
+}
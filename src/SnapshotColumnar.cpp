@@ -0,0 +1,575 @@
+/**
+ * @file SnapshotColumnar.cpp
+ * @brief Implementación de las clases SnapshotColumnar y LectorSnapshot para instantáneas columnares de la base de datos.
+ * @details Este archivo contiene la definición de los métodos que exportan las tablas a un archivo columnar
+ *          por grupos de filas y de los métodos que mapean y decodifican ese archivo.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "SnapshotColumnar.hpp"
+#include "Codigos.hpp"
+#include "Database.hpp"
+#include "SQLiteStatement.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SNAPSHOT_MMAP
+#endif
+
+/**
+ * @struct ColumnaExportada
+ * @brief Columna de una tabla exportada: nombre en la instantánea, expresión SQL y codificación.
+ */
+struct ColumnaExportada {
+    const char* nombre;
+    std::string expresion;
+    CodificacionColumna codificacion;
+};
+
+/**
+ * @struct TablaExportada
+ * @brief Tabla exportada con el orden de sus filas y sus columnas.
+ */
+struct TablaExportada {
+    const char* nombre;
+    const char* orden;
+    std::vector<ColumnaExportada> columnas;
+};
+
+// Función auxiliar con las tablas y columnas de la instantánea
+static const std::vector<TablaExportada>& tablasExportadas() {
+    constexpr CodificacionColumna ENTERO = CodificacionColumna::ENTERO_DELTA;
+    constexpr CodificacionColumna DECIMAL = CodificacionColumna::DECIMAL;
+    constexpr CodificacionColumna TEXTO = CodificacionColumna::DICCIONARIO;
+
+    // Las monedas y los tipos se guardan como enteros y se exportan con su código de texto
+    static const std::string MONEDA = expresionCodigos("moneda", MONEDAS, CANTIDAD_MONEDAS);
+    static const std::string TIPO_TRANSACCION = expresionCodigos("tipo", TIPOS_TRANSACCION, CANTIDAD_TIPOS_TRANSACCION);
+    static const std::string TIPO_PRESTAMO = expresionCodigos("tipo", TIPOS_PRESTAMO, CANTIDAD_TIPOS_PRESTAMO, valor(TipoPrestamo::PERSONAL));
+
+    static const std::vector<TablaExportada> tablas = {
+        {"Cuentas", "idCuenta", {
+            {"idCuenta", "idCuenta", ENTERO}, {"idCliente", "idCliente", ENTERO}, {"moneda", MONEDA, TEXTO},
+            {"saldo", "saldo", DECIMAL}, {"tasaInteres", "tasaInteres", DECIMAL}}},
+        {"Transacciones", "idTransaccion", {
+            {"idTransaccion", "idTransaccion", ENTERO}, {"idRemitente", "idRemitente", ENTERO},
+            {"idDestinatario", "idDestinatario", ENTERO}, {"tipo", TIPO_TRANSACCION, TEXTO}, {"monto", "monto", DECIMAL},
+            {"fecha", "unixepoch(fecha)", ENTERO}}},
+        {"Prestamos", "idPrestamo", {
+            {"idPrestamo", "idPrestamo", ENTERO}, {"idCuenta", "idCuenta", ENTERO}, {"tipo", TIPO_PRESTAMO, TEXTO},
+            {"moneda", MONEDA, TEXTO}, {"monto", "monto", DECIMAL}, {"tasaInteres", "tasaInteres", DECIMAL},
+            {"plazoMeses", "plazoMeses", ENTERO}, {"cuotaMensual", "cuotaMensual", DECIMAL},
+            {"cuotasPagadas", "cuotasPagadas", ENTERO}, {"capitalPagado", "capitalPagado", DECIMAL},
+            {"interesesPagados", "interesesPagados", DECIMAL}, {"activo", "activo", ENTERO},
+            {"fechaProximoPago", "unixepoch(fechaProximoPago)", ENTERO}, {"diasAtraso", "diasAtraso", ENTERO}}},
+        {"PagoPrestamos", "idPagoPrestamo", {
+            {"idPagoPrestamo", "idPagoPrestamo", ENTERO}, {"idPrestamo", "idPrestamo", ENTERO},
+            {"cuotaPagada", "cuotaPagada", DECIMAL}, {"aporteCapital", "aporteCapital", DECIMAL},
+            {"aporteIntereses", "aporteIntereses", DECIMAL}, {"saldoRestante", "saldoRestante", DECIMAL}}},
+        {"CDP", "idCDP", {
+            {"idCDP", "idCDP", ENTERO}, {"idCuenta", "idCuenta", ENTERO}, {"moneda", MONEDA, TEXTO},
+            {"deposito", "deposito", DECIMAL}, {"plazoMeses", "plazoMeses", ENTERO},
+            {"tasaInteres", "tasaInteres", DECIMAL}}}
+    };
+    return tablas;
+}
+
+// -------------------------------- Escritura --------------------------------
+
+/**
+ * @struct ArchivoSalida
+ * @brief Archivo de instantánea en escritura, con la posición actual.
+ */
+struct ArchivoSalida {
+    std::FILE* archivo;
+    uint64_t posicion = 0;
+
+    void escribir(const void* datos, size_t cantidad) {
+        if (cantidad > 0 && std::fwrite(datos, 1, cantidad, archivo) != cantidad) {
+            throw std::runtime_error("Error: No se pudo escribir el archivo de la instantánea.");
+        }
+        posicion += cantidad;
+    }
+
+    // Completa con ceros hasta un múltiplo de 8 bytes
+    void alinear() {
+        static const char ceros[8] = {};
+        escribir(ceros, (8 - posicion % 8) % 8);
+    }
+};
+
+// Funciones auxiliares para serializar el directorio
+static void agregarU32(std::vector<uint8_t>& buffer, uint32_t valor) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&valor);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(valor));
+}
+
+static void agregarU64(std::vector<uint8_t>& buffer, uint64_t valor) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&valor);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(valor));
+}
+
+static void agregarTexto(std::vector<uint8_t>& buffer, const std::string& texto) {
+    agregarU32(buffer, static_cast<uint32_t>(texto.size()));
+    buffer.insert(buffer.end(), texto.begin(), texto.end());
+}
+
+// Función auxiliar para codificar enteros como diferencias en zigzag y varint
+static void codificarDelta(const std::vector<int64_t>& valores, std::vector<uint8_t>& salida) {
+    salida.clear();
+    uint64_t anterior = 0;
+
+    for (int64_t valor : valores) {
+        uint64_t diferencia = static_cast<uint64_t>(valor) - anterior;
+        uint64_t zigzag = (diferencia << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(diferencia) >> 63);
+        anterior = static_cast<uint64_t>(valor);
+
+        while (zigzag >= 0x80) {
+            salida.push_back(static_cast<uint8_t>(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        salida.push_back(static_cast<uint8_t>(zigzag));
+    }
+}
+
+
+// Definición de método estático para exportar una instantánea de la base de datos
+bool SnapshotColumnar::exportar(const std::string& nombreDB, const std::string& nombreArchivo, ResumenSnapshot& resumen) {
+    auto inicio = std::chrono::steady_clock::now();
+    resumen = ResumenSnapshot();
+
+    const std::string temporal = nombreArchivo + ".tmp";
+    std::FILE* archivo = nullptr;
+
+    try {
+        Database conexion(nombreDB, true);
+        sqlite3* db = conexion.get();
+
+        // Fuera del modo WAL, la transacción de lectura bloquearía a los escritores durante toda la exportación
+        {
+            SQLiteStatement modo(db, "PRAGMA journal_mode;");
+            const unsigned char* texto = sqlite3_step(modo.get()) == SQLITE_ROW ? sqlite3_column_text(modo.get(), 0) : nullptr;
+            if (texto == nullptr || std::string(reinterpret_cast<const char*>(texto)) != "wal") {
+                throw std::runtime_error("Error: La base de datos " + nombreDB + " no está en modo WAL; la exportación "
+                                         "bloquearía las escrituras. Actívelo con \"PRAGMA journal_mode = WAL\" o iniciando el servidor.");
+            }
+        }
+
+        if (sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error al iniciar la transacción de lectura: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        archivo = std::fopen(temporal.c_str(), "wb");
+        if (archivo == nullptr) {
+            throw std::runtime_error("Error: No se pudo crear el archivo de la instantánea.");
+        }
+
+        ArchivoSalida salida{archivo};
+        CabeceraSnapshot cabecera{};
+        std::memcpy(cabecera.magia, MAGIA_SNAPSHOT, sizeof(cabecera.magia));
+        cabecera.version = VERSION_SNAPSHOT;
+        cabecera.creado = static_cast<int64_t>(std::time(nullptr));
+        salida.escribir(&cabecera, sizeof(cabecera)); // Se reescribe al final con la posición del directorio
+
+        std::vector<TablaSnapshot> tablas;
+        std::vector<uint8_t> codificados;
+
+        for (const TablaExportada& exportada : tablasExportadas()) {
+            const size_t cantidadColumnas = exportada.columnas.size();
+
+            TablaSnapshot tabla;
+            tabla.nombre = exportada.nombre;
+            for (const ColumnaExportada& columna : exportada.columnas) {
+                tabla.columnas.push_back({columna.nombre, columna.codificacion, {}});
+            }
+
+            std::string sql = "SELECT ";
+            for (size_t c = 0; c < cantidadColumnas; c++) {
+                sql += (c > 0 ? ", " : "") + std::string(exportada.columnas[c].expresion);
+            }
+            sql += " FROM " + std::string(exportada.nombre) + " ORDER BY " + exportada.orden + ";";
+            SQLiteStatement statement(db, sql);
+
+            // Valores del grupo actual de cada columna
+            std::vector<std::vector<int64_t>> enteros(cantidadColumnas);
+            std::vector<std::vector<double>> decimales(cantidadColumnas);
+            std::vector<std::vector<uint8_t>> codigos(cantidadColumnas);
+            size_t filasGrupo = 0;
+
+            // Escribe un bloque por columna del grupo actual
+            auto cerrarGrupo = [&]() {
+                GrupoSnapshot grupo{static_cast<uint32_t>(filasGrupo), {}};
+
+                for (size_t c = 0; c < cantidadColumnas; c++) {
+                    salida.alinear();
+                    BloqueSnapshot bloque{salida.posicion, 0};
+
+                    switch (tabla.columnas[c].codificacion) {
+                        case CodificacionColumna::ENTERO_DELTA:
+                            codificarDelta(enteros[c], codificados);
+                            salida.escribir(codificados.data(), codificados.size());
+                            enteros[c].clear();
+                            break;
+                        case CodificacionColumna::DECIMAL:
+                            salida.escribir(decimales[c].data(), decimales[c].size() * sizeof(double));
+                            decimales[c].clear();
+                            break;
+                        case CodificacionColumna::DICCIONARIO:
+                            salida.escribir(codigos[c].data(), codigos[c].size());
+                            codigos[c].clear();
+                            break;
+                    }
+
+                    bloque.tamano = salida.posicion - bloque.inicio;
+                    grupo.bloques.push_back(bloque);
+                }
+
+                tabla.grupos.push_back(std::move(grupo));
+                tabla.filas += filasGrupo;
+                filasGrupo = 0;
+            };
+
+            int resultado;
+            while ((resultado = sqlite3_step(statement.get())) == SQLITE_ROW) {
+                for (size_t c = 0; c < cantidadColumnas; c++) {
+                    int indice = static_cast<int>(c);
+
+                    switch (tabla.columnas[c].codificacion) {
+                        case CodificacionColumna::ENTERO_DELTA:
+                            enteros[c].push_back(sqlite3_column_type(statement.get(), indice) == SQLITE_NULL
+                                                 ? -1 : sqlite3_column_int64(statement.get(), indice));
+                            break;
+                        case CodificacionColumna::DECIMAL:
+                            decimales[c].push_back(sqlite3_column_double(statement.get(), indice));
+                            break;
+                        case CodificacionColumna::DICCIONARIO: {
+                            const char* texto = reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), indice));
+                            std::string_view valor = texto != nullptr ? texto : "";
+                            std::vector<std::string>& diccionario = tabla.columnas[c].diccionario;
+
+                            auto encontrado = std::find(diccionario.begin(), diccionario.end(), valor);
+                            if (encontrado == diccionario.end()) {
+                                if (diccionario.size() == 256) {
+                                    throw std::runtime_error("La columna " + tabla.columnas[c].nombre + " tiene más de 256 valores distintos.");
+                                }
+                                diccionario.emplace_back(valor);
+                                encontrado = diccionario.end() - 1;
+                            }
+                            codigos[c].push_back(static_cast<uint8_t>(encontrado - diccionario.begin()));
+                            break;
+                        }
+                    }
+                }
+
+                if (++filasGrupo == FILAS_POR_GRUPO) {
+                    cerrarGrupo();
+                }
+            }
+
+            if (resultado != SQLITE_DONE) {
+                throw std::runtime_error("Error al leer la tabla " + tabla.nombre + ": " + sqlite3_errmsg(db));
+            }
+            if (filasGrupo > 0) {
+                cerrarGrupo();
+            }
+
+            resumen.filas.emplace_back(tabla.nombre, tabla.filas);
+            tablas.push_back(std::move(tabla));
+        }
+
+        if (sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Error al terminar la transacción de lectura: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        // Directorio al final del archivo
+        std::vector<uint8_t> directorio;
+        agregarU32(directorio, static_cast<uint32_t>(tablas.size()));
+        for (const TablaSnapshot& tabla : tablas) {
+            agregarTexto(directorio, tabla.nombre);
+            agregarU64(directorio, tabla.filas);
+            agregarU32(directorio, static_cast<uint32_t>(tabla.columnas.size()));
+            agregarU32(directorio, static_cast<uint32_t>(tabla.grupos.size()));
+
+            for (const ColumnaSnapshot& columna : tabla.columnas) {
+                agregarTexto(directorio, columna.nombre);
+                directorio.push_back(static_cast<uint8_t>(columna.codificacion));
+                agregarU32(directorio, static_cast<uint32_t>(columna.diccionario.size()));
+                for (const std::string& valor : columna.diccionario) {
+                    agregarTexto(directorio, valor);
+                }
+            }
+
+            for (const GrupoSnapshot& grupo : tabla.grupos) {
+                agregarU32(directorio, grupo.filas);
+                for (const BloqueSnapshot& bloque : grupo.bloques) {
+                    agregarU64(directorio, bloque.inicio);
+                    agregarU64(directorio, bloque.tamano);
+                }
+            }
+        }
+
+        salida.alinear();
+        cabecera.inicioDirectorio = salida.posicion;
+        cabecera.tamanoDirectorio = directorio.size();
+        salida.escribir(directorio.data(), directorio.size());
+        resumen.bytes = salida.posicion;
+
+        if (std::fseek(archivo, 0, SEEK_SET) != 0 || std::fwrite(&cabecera, sizeof(cabecera), 1, archivo) != 1) {
+            throw std::runtime_error("Error: No se pudo escribir la cabecera de la instantánea.");
+        }
+
+        int cierre = std::fclose(archivo);
+        archivo = nullptr;
+        if (cierre != 0 || std::rename(temporal.c_str(), nombreArchivo.c_str()) != 0) {
+            throw std::runtime_error("Error: No se pudo guardar el archivo " + nombreArchivo + ".");
+        }
+
+        resumen.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        return true;
+
+    } catch (const std::exception& e) {
+        if (archivo != nullptr) {
+            std::fclose(archivo);
+        }
+        std::remove(temporal.c_str());
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+}
+
+// -------------------------------- Lectura --------------------------------
+
+/**
+ * @struct CursorDirectorio
+ * @brief Lectura del directorio con verificación de límites.
+ */
+struct CursorDirectorio {
+    const uint8_t* actual;
+    const uint8_t* fin;
+
+    void leer(void* destino, size_t cantidad) {
+        if (static_cast<size_t>(fin - actual) < cantidad) {
+            throw std::runtime_error("El directorio de la instantánea está incompleto.");
+        }
+        std::memcpy(destino, actual, cantidad);
+        actual += cantidad;
+    }
+
+    uint8_t u8() { uint8_t valor; leer(&valor, sizeof(valor)); return valor; }
+    uint32_t u32() { uint32_t valor; leer(&valor, sizeof(valor)); return valor; }
+    uint64_t u64() { uint64_t valor; leer(&valor, sizeof(valor)); return valor; }
+
+    std::string texto() {
+        uint32_t largo = u32();
+        std::string valor(largo, '\0');
+        leer(valor.data(), largo);
+        return valor;
+    }
+};
+
+
+// Definición de método de la estructura TablaSnapshot para obtener el índice de una columna
+size_t TablaSnapshot::columna(std::string_view nombreColumna) const {
+    for (size_t c = 0; c < columnas.size(); c++) {
+        if (columnas[c].nombre == nombreColumna) {
+            return c;
+        }
+    }
+    throw std::out_of_range("La tabla " + nombre + " no tiene la columna " + std::string(nombreColumna) + ".");
+}
+
+// Definición del constructor de la clase LectorSnapshot
+LectorSnapshot::LectorSnapshot(const std::string& nombreArchivo) {
+#ifdef SNAPSHOT_MMAP
+    int descriptor = ::open(nombreArchivo.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("No se pudo abrir la instantánea " + nombreArchivo + ".");
+    }
+
+    struct stat informacion;
+    if (::fstat(descriptor, &informacion) != 0 || informacion.st_size < static_cast<off_t>(sizeof(CabeceraSnapshot))) {
+        ::close(descriptor);
+        throw std::runtime_error("El archivo " + nombreArchivo + " no es una instantánea válida.");
+    }
+
+    tamano = static_cast<size_t>(informacion.st_size);
+    void* mapeo = ::mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor); // El mapeo se mantiene después de cerrar el descriptor
+    if (mapeo == MAP_FAILED) {
+        throw std::runtime_error("No se pudo mapear la instantánea " + nombreArchivo + ".");
+    }
+    datos = static_cast<const uint8_t*>(mapeo);
+#else
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo abrir la instantánea " + nombreArchivo + ".");
+    }
+    copia.assign(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+    datos = copia.data();
+    tamano = copia.size();
+#endif
+
+    try {
+        CabeceraSnapshot cabecera;
+        if (tamano < sizeof(cabecera)) {
+            throw std::runtime_error("El archivo " + nombreArchivo + " no es una instantánea válida.");
+        }
+        std::memcpy(&cabecera, datos, sizeof(cabecera));
+
+        if (std::memcmp(cabecera.magia, MAGIA_SNAPSHOT, sizeof(cabecera.magia)) != 0 || cabecera.version != VERSION_SNAPSHOT) {
+            throw std::runtime_error("El archivo " + nombreArchivo + " no es una instantánea válida.");
+        }
+        leerDirectorio(cabecera);
+
+    } catch (...) {
+#ifdef SNAPSHOT_MMAP
+        ::munmap(const_cast<uint8_t*>(datos), tamano);
+#endif
+        throw;
+    }
+}
+
+// Definición del destructor de la clase LectorSnapshot
+LectorSnapshot::~LectorSnapshot() {
+#ifdef SNAPSHOT_MMAP
+    if (datos != nullptr) {
+        ::munmap(const_cast<uint8_t*>(datos), tamano);
+    }
+#endif
+}
+
+// Definición de método privado para leer el directorio de la instantánea
+void LectorSnapshot::leerDirectorio(const CabeceraSnapshot& cabecera) {
+    if (cabecera.inicioDirectorio > tamano || cabecera.tamanoDirectorio > tamano - cabecera.inicioDirectorio) {
+        throw std::runtime_error("El directorio de la instantánea está fuera del archivo.");
+    }
+
+    CursorDirectorio cursor{datos + cabecera.inicioDirectorio, datos + cabecera.inicioDirectorio + cabecera.tamanoDirectorio};
+    uint32_t cantidadTablas = cursor.u32();
+
+    for (uint32_t t = 0; t < cantidadTablas; t++) {
+        TablaSnapshot tabla;
+        tabla.nombre = cursor.texto();
+        tabla.filas = cursor.u64();
+        uint32_t cantidadColumnas = cursor.u32();
+        uint32_t cantidadGrupos = cursor.u32();
+
+        for (uint32_t c = 0; c < cantidadColumnas; c++) {
+            ColumnaSnapshot columna;
+            columna.nombre = cursor.texto();
+            columna.codificacion = static_cast<CodificacionColumna>(cursor.u8());
+            uint32_t valores = cursor.u32();
+            for (uint32_t v = 0; v < valores; v++) {
+                columna.diccionario.push_back(cursor.texto());
+            }
+            tabla.columnas.push_back(std::move(columna));
+        }
+
+        for (uint32_t g = 0; g < cantidadGrupos; g++) {
+            GrupoSnapshot grupo;
+            grupo.filas = cursor.u32();
+
+            for (uint32_t c = 0; c < cantidadColumnas; c++) {
+                BloqueSnapshot bloque;
+                bloque.inicio = cursor.u64();
+                bloque.tamano = cursor.u64();
+
+                // Cada bloque debe estar dentro del archivo y tener el tamaño de su codificación
+                CodificacionColumna codificacion = tabla.columnas[c].codificacion;
+                bool valido = bloque.inicio % 8 == 0 && bloque.inicio <= tamano && bloque.tamano <= tamano - bloque.inicio;
+                if (codificacion == CodificacionColumna::DECIMAL) {
+                    valido = valido && bloque.tamano == uint64_t{grupo.filas} * sizeof(double);
+                } else if (codificacion == CodificacionColumna::DICCIONARIO) {
+                    valido = valido && bloque.tamano == grupo.filas;
+                }
+                if (!valido) {
+                    throw std::runtime_error("Bloque inválido en la columna " + tabla.columnas[c].nombre + " de " + tabla.nombre + ".");
+                }
+                grupo.bloques.push_back(bloque);
+            }
+            tabla.grupos.push_back(std::move(grupo));
+        }
+
+        tablas.push_back(std::move(tabla));
+    }
+}
+
+// Definición de método privado para obtener el bloque de una columna en un grupo
+const BloqueSnapshot& LectorSnapshot::bloque(const TablaSnapshot& tabla, size_t columna, size_t grupo,
+                                             CodificacionColumna codificacion) const {
+    if (columna >= tabla.columnas.size() || grupo >= tabla.grupos.size()) {
+        throw std::out_of_range("Columna o grupo fuera de rango en la tabla " + tabla.nombre + ".");
+    }
+    if (tabla.columnas[columna].codificacion != codificacion) {
+        throw std::invalid_argument("La columna " + tabla.columnas[columna].nombre + " tiene otra codificación.");
+    }
+    return tabla.grupos[grupo].bloques[columna];
+}
+
+
+const std::vector<TablaSnapshot>& LectorSnapshot::getTablas() const {
+    return tablas;
+}
+
+// Definición de método para obtener una tabla a partir de su nombre
+const TablaSnapshot& LectorSnapshot::tabla(std::string_view nombre) const {
+    for (const TablaSnapshot& tabla : tablas) {
+        if (tabla.nombre == nombre) {
+            return tabla;
+        }
+    }
+    throw std::out_of_range("La instantánea no tiene la tabla " + std::string(nombre) + ".");
+}
+
+// Definición de método para decodificar una columna de enteros de un grupo
+void LectorSnapshot::enteros(const TablaSnapshot& tabla, size_t columna, size_t grupo, std::vector<int64_t>& valores) const {
+    const BloqueSnapshot& datosBloque = bloque(tabla, columna, grupo, CodificacionColumna::ENTERO_DELTA);
+    const uint8_t* actual = datos + datosBloque.inicio;
+    const uint8_t* fin = actual + datosBloque.tamano;
+
+    valores.resize(tabla.grupos[grupo].filas);
+    uint64_t anterior = 0;
+
+    for (int64_t& valor : valores) {
+        uint64_t zigzag = 0;
+        int desplazamiento = 0;
+        uint8_t byte;
+
+        do {
+            if (actual == fin || desplazamiento > 63) {
+                throw std::runtime_error("Columna de enteros dañada en la tabla " + tabla.nombre + ".");
+            }
+            byte = *actual++;
+            zigzag |= static_cast<uint64_t>(byte & 0x7f) << desplazamiento;
+            desplazamiento += 7;
+        } while (byte & 0x80);
+
+        anterior += (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+        valor = static_cast<int64_t>(anterior);
+    }
+}
+
+// Definición de método para obtener una columna de decimales de un grupo
+const double* LectorSnapshot::decimales(const TablaSnapshot& tabla, size_t columna, size_t grupo) const {
+    return reinterpret_cast<const double*>(datos + bloque(tabla, columna, grupo, CodificacionColumna::DECIMAL).inicio);
+}
+
+// Definición de método para obtener una columna de códigos de diccionario de un grupo
+const uint8_t* LectorSnapshot::codigos(const TablaSnapshot& tabla, size_t columna, size_t grupo) const {
+    return datos + bloque(tabla, columna, grupo, CodificacionColumna::DICCIONARIO).inicio;
+}
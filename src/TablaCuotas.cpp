@@ -0,0 +1,176 @@
+/**
+ * @file TablaCuotas.cpp
+ * @brief Implementación de la clase TablaCuotas para generar tablas de cuotas mensuales de préstamos.
+ * @details Este archivo contiene la definición de los métodos de la clase TablaCuotas, que permiten
+ *          calcular la matriz de cuotas por plazo y tasa, almacenarla en caché por tipo de préstamo
+ *          y moneda, y exportarla en formato CSV.
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "TablaCuotas.hpp"
+#include "Prestamo.hpp"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+// Caché de tablas por tipo de préstamo y moneda, protegida por un mutex
+static std::map<std::pair<TipoPrestamo, Moneda>, std::shared_ptr<const TablaCuotas>> cacheTablas;
+static std::mutex mutexCacheTablas;
+
+
+// Definición del constructor de la clase TablaCuotas
+TablaCuotas::TablaCuotas(double monto, const RangoTablaCuotas& rango) : monto(monto), rango(rango) {
+    // Validar el rango antes de reservar memoria
+    if (rango.plazoMinimo <= 0 || rango.plazoMaximo < rango.plazoMinimo) {
+        throw std::invalid_argument("Error: Rango de plazos inválido para la tabla de cuotas.");
+    }
+    if (rango.cantidadTasas <= 0 || rango.tasaMinima <= 0 || rango.tasaMaxima < rango.tasaMinima) {
+        throw std::invalid_argument("Error: Rango de tasas inválido para la tabla de cuotas.");
+    }
+
+    calcular();
+}
+
+
+// Definición de método para calcular la matriz de cuotas
+void TablaCuotas::calcular() {
+    auto inicio = std::chrono::steady_clock::now();
+
+    const int columnas = rango.cantidadTasas;
+    const int filas = rango.plazoMaximo - rango.plazoMinimo + 1;
+
+    // Tasas uniformemente espaciadas entre la mínima y la máxima
+    tasas.resize(columnas);
+    double paso = columnas > 1 ? (rango.tasaMaxima - rango.tasaMinima) / (columnas - 1) : 0.0;
+    for (int j = 0; j < columnas; j++) {
+        tasas[j] = rango.tasaMinima + paso * j;
+    }
+
+    // Tasa mensual, base (1 + i) y potencia acumulada (1 + i)^n de cada columna
+    std::vector<double> tasaMensual(columnas), base(columnas), potencia(columnas, 1.0);
+    for (int j = 0; j < columnas; j++) {
+        tasaMensual[j] = (tasas[j] / 100) / 12;
+        base[j] = 1 + tasaMensual[j];
+    }
+
+    cuotas.resize(static_cast<size_t>(filas) * columnas);
+
+    // Recorrer los plazos en orden creciente, reutilizando la potencia de la fila anterior
+    for (int plazo = 1; plazo <= rango.plazoMaximo; plazo++) {
+        double* __restrict pot = potencia.data();
+        const double* __restrict b = base.data();
+        for (int j = 0; j < columnas; j++) {
+            pot[j] *= b[j];
+        }
+
+        if (plazo < rango.plazoMinimo) {
+            continue;
+        }
+
+        // Misma fórmula que Prestamo::calcularCuotaMensual
+        double* __restrict fila = cuotas.data() + static_cast<size_t>(plazo - rango.plazoMinimo) * columnas;
+        const double* __restrict i = tasaMensual.data();
+        for (int j = 0; j < columnas; j++) {
+            fila[j] = (monto * i[j] * pot[j]) / (pot[j] - 1);
+        }
+    }
+
+    tiempoCalculo = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+
+// Definición de método estático para obtener una tabla desde la caché
+std::shared_ptr<const TablaCuotas> TablaCuotas::obtener(TipoPrestamo tipo, Moneda moneda, const RangoTablaCuotas& rango) {
+    std::lock_guard<std::mutex> lock(mutexCacheTablas);
+
+    auto clave = std::make_pair(tipo, moneda);
+    auto it = cacheTablas.find(clave);
+
+    // Reutilizar la tabla si se calculó con el mismo rango
+    if (it != cacheTablas.end() && it->second->getRango() == rango) {
+        return it->second;
+    }
+
+    // Calcular la tabla con el monto predeterminado del tipo de préstamo
+    ValoresPrestamo valores = Prestamo::obtenerValoresPredeterminados(tipo, moneda);
+    auto tabla = std::make_shared<const TablaCuotas>(valores.monto, rango);
+    cacheTablas[clave] = tabla;
+
+    return tabla;
+}
+
+// Definición de método estático para vaciar la caché
+void TablaCuotas::limpiarCache() {
+    std::lock_guard<std::mutex> lock(mutexCacheTablas);
+    cacheTablas.clear();
+}
+
+
+double TablaCuotas::cuota(int plazoMeses, int indiceTasa) const {
+    return cuotas[static_cast<size_t>(plazoMeses - rango.plazoMinimo) * rango.cantidadTasas + indiceTasa];
+}
+
+double TablaCuotas::tasa(int indiceTasa) const {
+    return tasas[indiceTasa];
+}
+
+int TablaCuotas::cantidadPlazos() const {
+    return rango.plazoMaximo - rango.plazoMinimo + 1;
+}
+
+int TablaCuotas::cantidadTasas() const {
+    return rango.cantidadTasas;
+}
+
+double TablaCuotas::getMonto() const {
+    return monto;
+}
+
+const RangoTablaCuotas& TablaCuotas::getRango() const {
+    return rango;
+}
+
+double TablaCuotas::getTiempoCalculo() const {
+    return tiempoCalculo;
+}
+
+
+// Definición de método para exportar la tabla en formato CSV
+bool TablaCuotas::exportarCSV(const std::string& nombreArchivo) const {
+    std::ofstream archivo(nombreArchivo);
+
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo para guardar la tabla de cuotas." << std::endl;
+        return false;
+    }
+
+    archivo << std::fixed << std::setprecision(2); // Salida con dos decimales
+
+    // Encabezado con las tasas de cada columna
+    archivo << "Plazo en Meses";
+    for (double t : tasas) {
+        archivo << "," << t;
+    }
+    archivo << "\n";
+
+    // Una fila por plazo
+    for (int plazo = rango.plazoMinimo; plazo <= rango.plazoMaximo; plazo++) {
+        archivo << plazo;
+        for (int j = 0; j < rango.cantidadTasas; j++) {
+            archivo << "," << cuota(plazo, j);
+        }
+        archivo << "\n";
+    }
+
+    archivo.close();
+    return !archivo.fail();
+}
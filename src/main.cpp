@@ -14,10 +14,30 @@
 #include <iostream>
 #include <iomanip>
 #include "Database.hpp"
+#include "FiltrosExistencia.hpp"
 #include "constants.hpp"
 #include "Menu.hpp"
+#include "Mora.hpp"
+#include "Lote.hpp"
+#include "Servidor.hpp"
+#include <fstream>
+#include <string>
 #include "auxiliares.hpp"
 
+#ifdef __linux__
+#include <csignal>
+
+// Servidor en ejecución, para detenerlo desde el manejador de señales
+static Servidor* servidorActivo = nullptr;
+
+// Manejador de SIGINT y SIGTERM para detener el servidor de forma ordenada
+static void detenerServidor(int) {
+    if (servidorActivo != nullptr) {
+        servidorActivo->detener();
+    }
+}
+#endif
+
 /**
  * @brief Función principal de la aplicación.
  * 
@@ -26,12 +46,79 @@
  * al cliente o información sobre préstamos bancarios. El programa continúa ejecutándose
  * hasta que el usuario seleccione la opción de salir.
  * 
- * @return `int` Código de estado de la ejecución del programa.
+ * Con `--batch <archivo>` se ejecutan las operaciones del archivo sin mostrar el menú (ver Lote.hpp)
+ * y al finalizar se muestra un resumen de tiempos y fallos. Con `--servidor <socket> [hilos]` se
+ * atienden solicitudes de varias ventanillas por un socket de dominio Unix (ver Servidor.hpp) hasta
+ * recibir SIGINT o SIGTERM.
+ * 
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: opcionalmente `--batch` y el archivo de operaciones, o `--servidor`, la ruta
+ *             del socket y la cantidad de hilos lectores.
+ * @return `int` Código de estado de la ejecución del programa (1 si alguna operación del lote falló).
  */
-int main() {
+int main(int argc, char* argv[]) {
+
+    // Validar los argumentos de los modos por lotes y servidor
+    bool modoLote = argc > 1 && std::string(argv[1]) == "--batch";
+    bool modoServidor = argc > 1 && std::string(argv[1]) == "--servidor";
+    if ((argc > 1 && !modoLote && !modoServidor) || (modoLote && argc != 3)
+        || (modoServidor && (argc < 3 || argc > 4))) {
+        std::cerr << "Uso: " << argv[0] << " [--batch <archivo> | --servidor <socket> [hilos]]" << std::endl;
+        return 1;
+    }
 
     try {
         Database db("banco.db"); // Conectar a la base de datos
+
+        Mora::actualizar(db.get()); // Corte diario de los días de atraso de los préstamos
+
+        if (modoServidor) {
+#ifdef __linux__
+            unsigned int hilos = argc == 4 ? static_cast<unsigned int>(std::stoul(argv[3])) : 0;
+
+            Servidor servidor("banco.db", argv[2], hilos);
+            if (!servidor.iniciar()) {
+                return 1;
+            }
+
+            // Detener el servidor con SIGINT o SIGTERM
+            servidorActivo = &servidor;
+            struct sigaction accion{};
+            accion.sa_handler = detenerServidor;
+            sigemptyset(&accion.sa_mask);
+            sigaction(SIGINT, &accion, nullptr);
+            sigaction(SIGTERM, &accion, nullptr);
+
+            std::clog << "Servidor escuchando en " << argv[2] << std::endl;
+            servidor.ejecutar();
+            std::clog << "Servidor detenido." << std::endl;
+
+            servidorActivo = nullptr;
+            return 0;
+#else
+            std::cerr << "Error: El modo servidor solo está disponible en Linux." << std::endl;
+            return 1;
+#endif
+        }
+
+        // Filtros de Bloom para las verificaciones de existencia, guardados al cerrar la base de datos
+        FiltrosExistencia::activar(db.get(), "banco.db.bloom");
+
+        if (modoLote) {
+            std::ifstream archivo(argv[2]);
+            if (!archivo.is_open()) {
+                std::cerr << "Error: No se pudo abrir el archivo de operaciones " << argv[2] << std::endl;
+                return 1;
+            }
+
+            std::cout << std::fixed << std::setprecision(2); // Configurar salida con 2 decimales
+
+            Lote lote(db.get());
+            ResultadoLote resultado = lote.ejecutar(archivo);
+            Lote::mostrarResumen(resultado);
+
+            return resultado.fallos.empty() ? 0 : 1;
+        }
     
         int opcionPrincipal; // Opción ingresada para el menú principal
 
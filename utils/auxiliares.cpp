@@ -14,35 +14,24 @@
  */
 
 #include "auxiliares.hpp"
+#include "validaciones.hpp"
 
+#include <algorithm>
 #include <iostream>
-#include <regex>
 #include <limits>
 
 // Definición de función para validar una fecha ingresada
-std::string validarFecha() {
+std::string validarFecha(std::istream& entrada) {
     // Declaración de string para almacenar la fecha
     std::string fecha;
 
-    // Declaración de expresión regular para validar el formato correcto solicitado
-    std::regex formatoFecha(R"((1|2)\d{3}-(0[1-9]|1[0-2])-(0[1-9]|[12]\d|3[01]))");
-
     while (true) {
         // Realizar el ingreso de la fecha
-        std::cin >> fecha;
-
-        // Validación con el regex
-        if (std::regex_match(fecha, formatoFecha)) {
-            // Verificación adicional para días válidos según el mes
-            int año = std::stoi(fecha.substr(0, 4));
-            int mes = std::stoi(fecha.substr(5, 2));
-            int dia = std::stoi(fecha.substr(8, 2));
-
-            // Verificar días de febrero y años bisiestos
-            if ((mes == 2 && dia <= (año % 4 == 0 && (año % 100 != 0 || año % 400 == 0) ? 29 : 28)) ||
-                (mes == 4 || mes == 6 || mes == 9 || mes == 11 ? dia <= 30 : dia <= 31)) {
-                return fecha;
-            }
+        entrada >> fecha;
+
+        // Validación del formato y de los días según el mes y los años bisiestos
+        if (esFechaValida(fecha)) {
+            return fecha;
         }
         // Mensaje de error para formato incorrecto
         std::cout << "Error: Fecha inválida. Inténtelo de nuevo.\n";
@@ -86,7 +75,7 @@ double obtenerDecimal() {
 }
 
 // Definición de función para validar entre las monedas 'CRC' o 'USD'
-std::string validarMoneda() {
+Moneda validarMoneda() {
     int opcion; // Opción que representa la selección de moneda
     
     do {
@@ -101,22 +90,19 @@ std::string validarMoneda() {
         }
     } while (opcion != 1 && opcion != 2); // Continuar solicitando hasta obtener una opción válida
 
-    return opcion == 1 ? "CRC" : "USD"; // Retornar la moneda seleccionada por medio del operador ternario
+    return opcion == 1 ? Moneda::CRC : Moneda::USD; // Retornar la moneda seleccionada por medio del operador ternario
 }
 
 // Definición de función para validar el ingreso de un número de teléfono
-std::string validarTelefono() {
+std::string validarTelefono(std::istream& entrada) {
     std::string telefono; // String que representa el número de teléfono
-    
-    // Expresión regular que valida el formato del teléfono
-    std::regex formatoTelefono(R"(\d{4}-\d{4})");
 
     while (true) {
         std::cout << "Ingrese un número de teléfono (####-####): ";
-        std::cin >> telefono;
+        entrada >> telefono;
 
         // Verificar si el formato es válido
-        if (std::regex_match(telefono, formatoTelefono)) {
+        if (esTelefonoValido(telefono)) {
             return telefono;
         }
 
@@ -156,19 +142,16 @@ bool validarRespuestaSN() {
 
 
 // Función para validar si una cadena es un nombre de archivo .csv
-std::string obtenerArchivoCSV() {
+std::string obtenerArchivoCSV(std::istream& entrada) {
     std::string nombreArchivo; // Para almacenar el nombre del archivo ingresado
 
-    // Patrón regex para realizar la validación
-    std::regex patronCSV(R"(([^\/:*?"<>|]+)\.csv$)", std::regex_constants::icase);
-
     do {
-        std::getline(std::cin, nombreArchivo);
+        std::getline(entrada, nombreArchivo);
 
         // Eliminar espacios en blanco de la entrada
         nombreArchivo.erase(remove(nombreArchivo.begin(), nombreArchivo.end(), ' '), nombreArchivo.end());
 
-        if (std::regex_match(nombreArchivo, patronCSV)) {
+        if (esArchivoCSV(nombreArchivo)) {
             return nombreArchivo; // Retorna el nombre del archivo válido
         } else {
             std::cout << "Error: El nombre ingresado no corresponde a un archivo (.csv). Intente nuevamente." << std::endl;
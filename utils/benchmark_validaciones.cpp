@@ -0,0 +1,153 @@
+/**
+ * @file benchmark_validaciones.cpp
+ * @brief Programa para comparar las funciones de validaciones.hpp con las expresiones regulares equivalentes.
+ * @details Este archivo contiene el punto de entrada del programa que valida el mismo conjunto de fechas,
+ *          teléfonos y nombres de archivos con std::regex y con las funciones de validaciones.hpp, verifica
+ *          que ambos coincidan y muestra el tiempo por valor y la aceleración obtenida.
+ *
+ *          Uso: `benchmark_validaciones [cantidad]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "validaciones.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+// Las validaciones se pueden evaluar en tiempo de compilación
+static_assert(esFechaValida("2024-02-29") && !esFechaValida("2023-02-29") && !esFechaValida("2024-02-30"));
+static_assert(esTelefonoValido("8888-1234") && !esTelefonoValido("88881234"));
+static_assert(esArchivoCSV("reporte.CSV") && !esArchivoCSV(".csv") && !esArchivoCSV("a/b.csv"));
+
+/**
+ * @brief Mide el tiempo de validar todos los valores con una función.
+ *
+ * @param valores Valores a validar.
+ * @param validar Función de validación.
+ * @param validos Cantidad de valores válidos.
+ * @return `double` Nanosegundos por valor.
+ */
+template <typename Validar>
+static double medir(const std::vector<std::string>& valores, Validar validar, size_t& validos) {
+    validos = 0;
+    auto inicio = std::chrono::steady_clock::now();
+    for (const std::string& valor : valores) {
+        validos += validar(valor) ? 1 : 0;
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - inicio).count() / valores.size();
+}
+
+/**
+ * @brief Compara una expresión regular con una función de validación y muestra los resultados.
+ *
+ * @param formato Nombre del formato.
+ * @param valores Valores a validar.
+ * @param expresion Expresión regular equivalente.
+ * @param opciones Opciones de la expresión regular.
+ * @param validar Función de validación.
+ * @param adicional Verificación adicional después de la expresión regular.
+ * @return `bool` `true` si ambas coinciden en todos los valores.
+ */
+template <typename Validar, typename Adicional>
+static bool comparar(const std::string& formato, const std::vector<std::string>& valores, const char* expresion,
+                     std::regex::flag_type opciones, Validar validar, Adicional adicional) {
+    size_t validosRegex, validosPrecompilado, validosNuevo;
+    std::regex patron(expresion, opciones);
+
+    // Como en la versión anterior de auxiliares.cpp, la expresión regular se construye en cada llamada
+    double regex = medir(valores, [&](const std::string& valor) {
+        std::regex patronLlamada(expresion, opciones);
+        return std::regex_match(valor, patronLlamada) && adicional(valor);
+    }, validosRegex);
+    double precompilado = medir(valores, [&](const std::string& valor) {
+        return std::regex_match(valor, patron) && adicional(valor);
+    }, validosPrecompilado);
+    double nuevo = medir(valores, validar, validosNuevo);
+
+    size_t diferencias = 0;
+    for (const std::string& valor : valores) {
+        if ((std::regex_match(valor, patron) && adicional(valor)) != validar(valor)) {
+            diferencias++;
+        }
+    }
+
+    std::cout << std::setw(10) << formato << std::setw(10) << validosNuevo
+              << std::setw(14) << regex << std::setw(14) << precompilado << std::setw(14) << nuevo
+              << std::setw(11) << regex / nuevo << "x" << std::setw(11) << precompilado / nuevo << "x"
+              << std::setw(12) << diferencias << std::endl;
+    return diferencias == 0;
+}
+
+/**
+ * @brief Función principal del programa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: cantidad de valores por formato (200000 por defecto).
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    size_t cantidad = argc > 1 ? std::stoul(argv[1]) : 200000;
+    std::mt19937 generador(42);
+    std::uniform_int_distribution<int> digito(0, 9);
+    std::uniform_int_distribution<int> porcentaje(0, 99);
+
+    // Valores con una mezcla de formatos válidos y casi válidos
+    std::vector<std::string> fechas, telefonos, archivos;
+    const char* caracteres = "0123456789-";
+    for (size_t i = 0; i < cantidad; i++) {
+        int mes = 1 + generador() % 12;
+        int dia = 1 + generador() % 31;
+        std::string fecha = std::to_string(1990 + generador() % 40) + (mes < 10 ? "-0" : "-") + std::to_string(mes)
+                          + (dia < 10 ? "-0" : "-") + std::to_string(dia);
+        if (porcentaje(generador) < 10) {
+            fecha[generador() % fecha.size()] = caracteres[generador() % 11];
+        }
+        fechas.push_back(fecha);
+
+        std::string telefono(9, '-');
+        for (size_t c = 0; c < telefono.size(); c++) {
+            if (c != 4) {
+                telefono[c] = static_cast<char>('0' + digito(generador));
+            }
+        }
+        if (porcentaje(generador) < 10) {
+            telefono[generador() % telefono.size()] = caracteres[generador() % 11];
+        }
+        telefonos.push_back(telefono);
+
+        std::string archivo = "reporte_" + std::to_string(i);
+        int variante = porcentaje(generador);
+        archivo += variante < 70 ? ".csv" : variante < 80 ? ".CSV" : variante < 90 ? ".txt" : "?.csv";
+        archivos.push_back(archivo);
+    }
+
+    // Expresiones regulares de la versión anterior de auxiliares.cpp
+    const char* formatoFecha = R"((1|2)\d{3}-(0[1-9]|1[0-2])-(0[1-9]|[12]\d|3[01]))";
+    const char* formatoTelefono = R"(\d{4}-\d{4})";
+    const char* patronCSV = R"(([^\/:*?"<>|]+)\.csv$)";
+
+    auto sinAdicional = [](const std::string&) { return true; };
+    auto diaDelMes = [](const std::string& fecha) {
+        return std::stoi(fecha.substr(8, 2)) <= diasDelMes(std::stoi(fecha.substr(0, 4)), std::stoi(fecha.substr(5, 2)));
+    };
+
+    std::cout << "Valores por formato: " << cantidad << " (tiempos en ns por valor)" << std::endl;
+    std::cout << std::setw(10) << "Formato" << std::setw(10) << "Válidos" << std::setw(14) << "regex/llamada"
+              << std::setw(14) << "regex" << std::setw(14) << "validaciones" << std::setw(12) << "vs llamada"
+              << std::setw(12) << "vs regex" << std::setw(12) << "Diferencias" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    bool coinciden = comparar("Fecha", fechas, formatoFecha, std::regex::ECMAScript, esFechaValida, diaDelMes);
+    coinciden = comparar("Telefono", telefonos, formatoTelefono, std::regex::ECMAScript, esTelefonoValido, sinAdicional) && coinciden;
+    coinciden = comparar("Archivo", archivos, patronCSV, std::regex::ECMAScript | std::regex::icase, esArchivoCSV, sinAdicional) && coinciden;
+
+    return coinciden ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file carga.cpp
+ * @brief Programa para generar carga de sesiones de ventanilla concurrentes sobre la base de datos.
+ * @details Este archivo contiene el punto de entrada del programa que simula varias sesiones de
+ *          ventanilla sobre la base de datos indicada con el perfil elegido y muestra el rendimiento,
+ *          los percentiles de latencia y los errores y bloqueos por segundo. Las sesiones registran
+ *          transacciones reales, por lo que el archivo se debe indicar siempre y conviene que sea una copia.
+ *
+ *          Uso: `generador_carga <archivo.db> <sesiones> <segundos> [normal|cierre] [archivo.csv]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Database.hpp"
+#include "GeneradorCarga.hpp"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * Carga las cuentas y préstamos activos, ejecuta las sesiones con el perfil indicado y muestra el
+ * resultado, guardando también la serie de tiempo en un archivo `.csv` si se indica.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: archivo de la base de datos, cantidad de sesiones, duración en segundos,
+ *             perfil (opcional) y archivo de salida (opcional).
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cerr << "Uso: " << argv[0] << " <archivo.db> <sesiones> <segundos> [normal|cierre] [archivo.csv]" << std::endl;
+        std::cerr << "Las sesiones registran transacciones en la base de datos; use una copia." << std::endl;
+        return 1;
+    }
+
+    try {
+        std::string nombreDB = argv[1];
+        std::string perfil = argc > 4 ? argv[4] : "normal";
+        if (perfil != "normal" && perfil != "cierre") {
+            std::cerr << "Error: Perfil inválido: " << perfil << " (use 'normal' o 'cierre')." << std::endl;
+            return 1;
+        }
+
+        ParametrosCarga parametros = perfil == "cierre" ? CargaDef::CIERRE_MES : CargaDef::NORMAL;
+        parametros.sesiones = static_cast<unsigned int>(std::stoul(argv[2]));
+        parametros.segundos = std::stod(argv[3]);
+        std::string nombreArchivo = argc > 5 ? argv[5] : "";
+
+        if (parametros.sesiones == 0 || parametros.segundos <= 0) {
+            std::cerr << "Error: La cantidad de sesiones y la duración deben ser positivas." << std::endl;
+            return 1;
+        }
+
+        GeneradorCarga generador(nombreDB);
+        {
+            Database db(nombreDB); // Conectar a la base de datos
+            if (!generador.cargar(db.get())) {
+                return 1;
+            }
+        }
+
+        ResultadoCarga resultado = generador.ejecutar(parametros);
+        GeneradorCarga::mostrarResultado(resultado);
+
+        if (!nombreArchivo.empty() && GeneradorCarga::exportarCSV(resultado, nombreArchivo)) {
+            std::cout << "Serie de tiempo guardada en " << nombreArchivo << std::endl;
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file estados.cpp
+ * @brief Programa para generar los estados de cuenta de cierre de mes de todas las cuentas.
+ * @details Este archivo contiene el punto de entrada del programa que utiliza EstadosMensuales para
+ *          generar en paralelo el estado de cuenta de un mes para cada cuenta de "banco.db". Si la
+ *          generación se interrumpe, al ejecutarlo de nuevo con el mismo periodo y directorio se
+ *          continúa con los lotes pendientes.
+ *
+ *          Uso: `estados_cuenta <YYYY-MM> <directorio> [hilos]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "EstadosMensuales.hpp"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * Lee los argumentos, genera los estados de cuenta del periodo y muestra el resultado.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: periodo, directorio de salida y cantidad de hilos (opcional).
+ * @return `int` Código de salida del programa (1 si algún lote no se completó).
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Uso: " << argv[0] << " <YYYY-MM> <directorio> [hilos]" << std::endl;
+        return 1;
+    }
+
+    try {
+        std::string periodo = argv[1];
+        std::string directorio = argv[2];
+        unsigned int hilos = argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : 0;
+
+        ResultadoEstados resultado = EstadosMensuales::generar("banco.db", periodo, directorio, hilos);
+        EstadosMensuales::mostrarResultado(resultado);
+
+        if (resultado.lotesFallidos > 0) {
+            std::cerr << "Vuelva a ejecutar el programa para reintentar los lotes pendientes." << std::endl;
+            return 1;
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
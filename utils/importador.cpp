@@ -0,0 +1,64 @@
+/**
+ * @file importador.cpp
+ * @brief Programa para importar clientes y cuentas desde archivos `.csv`.
+ * @details Este archivo contiene el punto de entrada del programa que utiliza ImportadorCSV para cargar
+ *          de forma masiva clientes y cuentas en "banco.db". Los archivos se importan en el orden en que
+ *          se indican, por lo que las cuentas de clientes nuevos deben ir después de su archivo de clientes.
+ *
+ *          Uso: `importador_csv clientes <archivo.csv> [cuentas <archivo.csv>] ...`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Database.hpp"
+#include "ImportadorCSV.hpp"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: pares de tipo (`clientes` o `cuentas`) y archivo a importar.
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    bool argumentosValidos = argc >= 3 && argc % 2 == 1;
+    for (int i = 1; argumentosValidos && i < argc; i += 2) {
+        std::string tipo = argv[i];
+        argumentosValidos = tipo == "clientes" || tipo == "cuentas";
+    }
+    if (!argumentosValidos) {
+        std::cerr << "Uso: " << argv[0] << " clientes <archivo.csv> [cuentas <archivo.csv>] ..." << std::endl;
+        return 1;
+    }
+
+    try {
+        Database db("banco.db");
+
+        for (int i = 1; i < argc; i += 2) {
+            std::string tipo = argv[i];
+            std::string nombreArchivo = argv[i + 1];
+            ResultadoImportacion resultado;
+
+            std::cout << "Importando " << tipo << " desde " << nombreArchivo << "..." << std::endl;
+            bool completado = tipo == "clientes"
+                ? ImportadorCSV::importarClientes(db.get(), nombreArchivo, resultado)
+                : ImportadorCSV::importarCuentas(db.get(), nombreArchivo, resultado);
+
+            ImportadorCSV::mostrarResultado(resultado);
+            if (!completado) {
+                return 1;
+            }
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
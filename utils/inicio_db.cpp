@@ -10,98 +10,14 @@
  * @date 08/11/2024
  */
 
+#include "EsquemaBD.hpp"
 #include <iostream>
+#include <string>
 #include <sqlite3.h>
 
 /// @brief Nombre de la base de datos utilizada en este programa.
 const char* DB_NAME = "banco.db";
 
-/**
- * @brief Script SQL para la creación de las tablas en la base de datos.
- * 
- * Este script incluye la creación de las tablas Clientes, Cuentas, CDP, Transacciones, Prestamos,
- * y PagoPrestamos, al asegurar las restricciones necesarias en cada campo para la integridad de los datos.
- */
-const char* SQL_CREATE_TABLES = R"(
-    CREATE TABLE IF NOT EXISTS Clientes (
-        idCliente INTEGER PRIMARY KEY AUTOINCREMENT CHECK (idCliente <= 999999999),
-        cedula INTEGER UNIQUE NOT NULL,
-        nombre TEXT NOT NULL,
-        primerApellido TEXT NOT NULL,
-        segundoApellido TEXT,
-        telefono TEXT
-    );
-
-    CREATE INDEX IF NOT EXISTS idx_cedula_clientes ON Clientes(cedula);
-
-    CREATE TABLE IF NOT EXISTS Cuentas (
-        idCuenta INTEGER PRIMARY KEY AUTOINCREMENT,
-        idCliente INTEGER NOT NULL,
-        moneda TEXT NOT NULL CHECK (moneda IN ('CRC', 'USD')),
-        saldo REAL NOT NULL,
-        tasaInteres REAL NOT NULL,
-        FOREIGN KEY (idCliente) REFERENCES Clientes(idCliente)
-    );
-
-    CREATE INDEX IF NOT EXISTS idx_idCuenta_cuentas ON Cuentas(idCuenta);
-    CREATE INDEX IF NOT EXISTS idx_idCliente_cuentas ON Cuentas(idCliente);
-
-    CREATE TABLE IF NOT EXISTS CDP (
-        idCDP INTEGER PRIMARY KEY AUTOINCREMENT,
-        idCuenta INTEGER NOT NULL,
-        moneda TEXT NOT NULL CHECK (moneda IN ('CRC', 'USD')),
-        deposito REAL NOT NULL,
-        plazoMeses INTEGER NOT NULL,
-        tasaInteres REAL NOT NULL,
-        FOREIGN KEY (idCuenta) REFERENCES Cuentas(idCuenta)
-    );
-
-    CREATE INDEX IF NOT EXISTS idx_idCuenta_cdp ON CDP(idCuenta);
-
-    CREATE TABLE IF NOT EXISTS Transacciones (
-        idTransaccion INTEGER PRIMARY KEY AUTOINCREMENT,
-        idRemitente INTEGER,
-        idDestinatario INTEGER,
-        tipo TEXT NOT NULL CHECK (tipo IN ('DEP', 'RET', 'TRA', 'ABO', 'CDP')),
-        monto REAL NOT NULL,
-        FOREIGN KEY (idRemitente) REFERENCES Cuentas(idCuenta),
-        FOREIGN KEY (idDestinatario) REFERENCES Cuentas(idCuenta)
-    );
-
-    CREATE INDEX IF NOT EXISTS idx_idRemitente_transacciones ON Transacciones(idRemitente);
-    CREATE INDEX IF NOT EXISTS idx_idDestinatario_transacciones ON Transacciones(idDestinatario);
-
-    CREATE TABLE IF NOT EXISTS Prestamos (
-        idPrestamo INTEGER PRIMARY KEY AUTOINCREMENT,
-        idCuenta INTEGER NOT NULL,
-        tipo TEXT NOT NULL CHECK (tipo IN ('PER', 'PRE', 'HIP')),
-        moneda TEXT NOT NULL CHECK (moneda IN ('CRC', 'USD')),
-        monto REAL NOT NULL,
-        tasaInteres REAL NOT NULL,
-        plazoMeses INTEGER NOT NULL,
-        cuotaMensual REAL NOT NULL,
-        cuotasPagadas INTEGER NOT NULL DEFAULT 0,
-        capitalPagado REAL NOT NULL DEFAULT 0,
-        interesesPagados REAL NOT NULL DEFAULT 0,
-        activo BOOLEAN NOT NULL DEFAULT 1,
-        FOREIGN KEY (idCuenta) REFERENCES Cuentas(idCuenta)
-    );
-
-    CREATE INDEX IF NOT EXISTS idx_idCuenta_prestamos ON Prestamos(idCuenta);
-    CREATE INDEX IF NOT EXISTS idx_idPrestamo_prestamos ON Prestamos(idPrestamo);
-
-    CREATE TABLE IF NOT EXISTS PagoPrestamos (
-        idPagoPrestamo INTEGER PRIMARY KEY AUTOINCREMENT,
-        idPrestamo INTEGER NOT NULL,
-        cuotaPagada REAL NOT NULL,
-        aporteCapital REAL NOT NULL,
-        aporteIntereses REAL NOT NULL,
-        saldoRestante REAL NOT NULL,
-        FOREIGN KEY (idPrestamo) REFERENCES Prestamos(idPrestamo)
-    );
-)";
-
-
 /**
  * @brief Ejecuta un comando SQL en la base de datos.
  * 
@@ -121,6 +37,25 @@ bool ejecutarSQL(sqlite3* db, const char* sql) {
     return true; // Operación exitosa
 }
 
+/**
+ * @brief Obtiene el primer valor entero de una consulta.
+ * 
+ * @param db Puntero a la base de datos SQLite.
+ * @param sql Consulta SQL a ejecutar.
+ * @return `int` Valor de la primera columna de la primera fila, o 0 si no hay filas.
+ */
+int obtenerEntero(sqlite3* db, const char* sql) {
+    sqlite3_stmt* statement = nullptr;
+    int valor = 0;
+
+    if (sqlite3_prepare_v2(db, sql, -1, &statement, nullptr) == SQLITE_OK && sqlite3_step(statement) == SQLITE_ROW) {
+        valor = sqlite3_column_int(statement, 0);
+    }
+    sqlite3_finalize(statement);
+
+    return valor;
+}
+
 /**
  * @brief Inserta datos de ejemplo en las tablas de la base de datos.
  * 
@@ -139,34 +74,34 @@ void insertarDatos(sqlite3* db) {
         (303030303, 'Carlos', 'Ramirez', 'Soto', '4567-8901'),
         (404040404, 'Ana', 'Jimenez', 'Mora', '2345-6789');
 
-        -- Insertar datos en Cuentas
+        -- Insertar datos en Cuentas (moneda: 0 = CRC, 1 = USD)
         INSERT INTO Cuentas (idCliente, moneda, saldo, tasaInteres) VALUES 
-        (1, 'CRC', 150000.0, 2.5),
-        (1, 'USD', 500.0, 1.5),
-        (2, 'CRC', 200000.0, 2.0),
-        (3, 'CRC', 100000.0, 2.0),
-        (3, 'USD', 350.0, 1.2),
-        (4, 'CRC', 250000.0, 2.7);
+        (1, 0, 150000.0, 2.5),
+        (1, 1, 500.0, 1.5),
+        (2, 0, 200000.0, 2.0),
+        (3, 0, 100000.0, 2.0),
+        (3, 1, 350.0, 1.2),
+        (4, 0, 250000.0, 2.7);
 
         -- Insertar datos en CDP
         INSERT INTO CDP (idCuenta, moneda, deposito, plazoMeses, tasaInteres) VALUES
-        (1, 'CRC', 60000.0, 12, 2.5),
-        (3, 'CRC', 120000.0, 24, 3.0),
-        (5, 'USD', 500.0, 18, 2.8);
-
-        -- Insertar transacciones
-        INSERT INTO Transacciones (idRemitente, idDestinatario, tipo, monto) VALUES 
-        (1, 2, 'TRA', 25000.0),
-        (2, NULL, 'RET', 3000.0),
-        (NULL, 1, 'DEP', 12000.0),
-        (3, 4, 'TRA', 45000.0),
-        (NULL, 1, 'CDP', 1000.0),
-        (5, NULL, 'ABO', 250.0);
-
-        -- Insertar préstamos
-        INSERT INTO Prestamos (idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, activo) VALUES 
-        (1, 'PER', 'CRC', 100000.0, 5.0, 24, 5000.0, 2, 10000.0, 2500.0, 1),
-        (5, 'HIP', 'USD', 50000.0, 3.5, 120, 1500.0, 3, 3000.0, 750.0, 1);
+        (1, 0, 60000.0, 12, 2.5),
+        (3, 0, 120000.0, 24, 3.0),
+        (5, 1, 500.0, 18, 2.8);
+
+        -- Insertar transacciones (tipo: 0 = DEP, 1 = RET, 2 = TRA, 3 = ABO, 4 = CDP)
+        INSERT INTO Transacciones (idRemitente, idDestinatario, tipo, monto, fecha) VALUES 
+        (1, 2, 2, 25000.0, datetime('now', '-40 days')),
+        (2, NULL, 1, 3000.0, datetime('now', '-35 days')),
+        (NULL, 1, 0, 12000.0, datetime('now', '-20 days')),
+        (3, 4, 2, 45000.0, datetime('now', '-12 days')),
+        (NULL, 1, 4, 1000.0, datetime('now', '-5 days')),
+        (5, NULL, 3, 250.0, datetime('now', '-1 days'));
+
+        -- Insertar préstamos (tipo: 1 = PER, 2 = PRE, 3 = HIP)
+        INSERT INTO Prestamos (idCuenta, tipo, moneda, monto, tasaInteres, plazoMeses, cuotaMensual, cuotasPagadas, capitalPagado, interesesPagados, activo, fechaProximoPago) VALUES 
+        (1, 1, 0, 100000.0, 5.0, 24, 5000.0, 2, 10000.0, 2500.0, 1, date('now', '+10 days')),
+        (5, 3, 1, 50000.0, 3.5, 120, 1500.0, 3, 3000.0, 750.0, 1, date('now', '-45 days'));
 
         -- Insertar datos en PagoPrestamos
         INSERT INTO PagoPrestamos (idPrestamo, cuotaPagada, aporteCapital, aporteIntereses, saldoRestante) VALUES 
@@ -201,8 +136,24 @@ int main() {
         return 1;
     }
 
-    // Crear tablas
-    if (ejecutarSQL(db, SQL_CREATE_TABLES)) {
+    // Una base de datos con tablas de una versión anterior del esquema se convierte con migrar_db
+    int version = obtenerEntero(db, "PRAGMA user_version;");
+    if (obtenerEntero(db, "SELECT COUNT(*) FROM sqlite_schema;") > 0 && version != VERSION_ESQUEMA) {
+        std::cerr << "Error: " << DB_NAME << " no está en la versión " << VERSION_ESQUEMA << " del esquema. "
+                  << "Ejecute migrar_db para actualizarla." << std::endl;
+        sqlite3_close(db);
+        return 1;
+    }
+
+    // El modo WAL queda guardado en el archivo: las lecturas largas no bloquean a las sesiones que escriben
+    if (!ejecutarSQL(db, "PRAGMA journal_mode = WAL;")) {
+        sqlite3_close(db);
+        return 1;
+    }
+
+    // Crear tablas, índices y registrar la versión del esquema
+    std::string versionEsquema = "PRAGMA user_version = " + std::to_string(VERSION_ESQUEMA) + ";";
+    if (ejecutarSQL(db, SQL_TABLAS) && ejecutarSQL(db, SQL_INDICES) && ejecutarSQL(db, versionEsquema.c_str())) {
         std::cout << "Tablas creadas exitosamente." << std::endl;
     }
     else {
@@ -0,0 +1,104 @@
+/**
+ * @file libro.cpp
+ * @brief Programa para medir el libro mayor en memoria con transferencias concurrentes.
+ * @details Este archivo contiene el punto de entrada del programa que carga los saldos en un LibroMayor,
+ *          ejecuta transferencias entre un grupo pequeño de cuentas en colones con 1, 2, 4, ... hilos,
+ *          espera a que el escritor las guarde y verifica que los saldos de la base de datos coincidan
+ *          con los de la memoria. El programa modifica los saldos de la base de datos, por lo que el
+ *          archivo se debe indicar siempre y conviene que sea una copia.
+ *
+ *          Uso: `libro_mayor <archivo.db> [hilos] [transferencias] [cuentas]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "ColeccionesCartera.hpp"
+#include "Database.hpp"
+#include "LibroMayor.hpp"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: archivo de la base de datos, máximo de hilos, transferencias por prueba y
+ *             cantidad de cuentas del grupo (opcionales, excepto el archivo).
+ * @return `int` Código de salida del programa (1 si algún saldo guardado difiere del de la memoria).
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 5) {
+        std::cerr << "Uso: " << argv[0] << " <archivo.db> [hilos] [transferencias] [cuentas]" << std::endl;
+        std::cerr << "El programa registra transferencias de prueba en la base de datos; use una copia." << std::endl;
+        return 1;
+    }
+
+    try {
+        std::string nombreDB = argv[1];
+        unsigned int hilos = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : std::max(1u, std::thread::hardware_concurrency());
+        long long transferencias = argc > 3 ? std::stoll(argv[3]) : 1000000;
+        size_t cantidadCuentas = argc > 4 ? std::stoul(argv[4]) : 64;
+
+        if (hilos == 0 || transferencias <= 0 || cantidadCuentas < 2) {
+            std::cerr << "Error: Se necesitan al menos un hilo, una transferencia y dos cuentas." << std::endl;
+            return 1;
+        }
+
+        Database db(nombreDB); // Conexión para elegir las cuentas y verificar los saldos guardados
+
+        // Las primeras cuentas en colones con saldo forman el grupo que recibe todas las transferencias
+        std::vector<int> cuentas;
+        {
+            ColeccionCuentas coleccion;
+            if (!coleccion.cargar(db.get())) {
+                return 1;
+            }
+            for (size_t i = 0; i < coleccion.cantidad() && cuentas.size() < cantidadCuentas; i++) {
+                if (coleccion.moneda[i] == Moneda::CRC && coleccion.saldo[i] > 0) {
+                    cuentas.push_back(coleccion.idCuenta[i]);
+                }
+            }
+        }
+        if (cuentas.size() < 2) {
+            std::cerr << "Error: La base de datos no tiene dos cuentas en colones con saldo." << std::endl;
+            return 1;
+        }
+
+        LibroMayor libro(nombreDB);
+        std::vector<ResultadoPruebaLibro> resultados;
+        for (unsigned int h = 1; ; h *= 2) {
+            unsigned int cantidad = std::min(h, hilos);
+            std::cout << "Transfiriendo entre " << cuentas.size() << " cuentas con " << cantidad << " hilos..." << std::endl;
+            resultados.push_back(LibroMayor::probar(libro, cuentas, cantidad, transferencias));
+            if (cantidad == hilos) {
+                break;
+            }
+        }
+
+        long long distintas = libro.diferencias(db.get());
+        LibroMayor::mostrarResultado(resultados, libro.estadisticas());
+        if (!libro.cerrar()) {
+            std::cerr << "Error: El libro mayor se cerró con " << libro.estadisticas().sinGuardar
+                      << " movimientos sin guardar." << std::endl;
+            return 1;
+        }
+
+        if (distintas != 0) {
+            std::cerr << "Error: " << distintas << " cuentas tienen en la base de datos un saldo distinto al de la memoria." << std::endl;
+            return 1;
+        }
+        std::cout << "Los saldos guardados coinciden con los de la memoria." << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
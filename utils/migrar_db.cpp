@@ -0,0 +1,52 @@
+/**
+ * @file migrar_db.cpp
+ * @brief Programa para actualizar una base de datos existente a la versión actual del esquema.
+ * @details Este archivo contiene el punto de entrada del programa que utiliza MigracionBD para convertir
+ *          "banco.db" (u otro archivo indicado) a la versión de `EsquemaBD.hpp` y verificar el plan de
+ *          las sentencias del programa. Una base de datos de la versión 1 se reconstruye y la original se
+ *          conserva como `<archivo>.v1`; las migraciones posteriores se aplican mientras la versión
+ *          anterior del programa sigue en uso. Retorna 1 si la migración falla o si alguna sentencia
+ *          no usa los índices esperados.
+ *
+ *          Uso: `migrar_db [archivo.db]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "MigracionBD.hpp"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: archivo de la base de datos (opcional, "banco.db" por defecto).
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    if (argc > 2) {
+        std::cerr << "Uso: " << argv[0] << " [archivo.db]" << std::endl;
+        return 1;
+    }
+
+    std::string nombreDB = argc == 2 ? argv[1] : "banco.db";
+    ResultadoMigracion resultado;
+
+    bool exito = MigracionBD::migrar(nombreDB, resultado);
+    if (!exito && resultado.versionNueva == 0) {
+        // La reconstrucción desde la versión 1 no guarda avance: al fallar se descarta y empieza de nuevo
+        if (resultado.reanudable) {
+            std::cerr << "La migración no se completó; al ejecutarla de nuevo continúa desde el último paso confirmado." << std::endl;
+        } else {
+            std::cerr << "La migración no se completó y no guardó avance; al ejecutarla de nuevo, el paso que falló se repite desde el principio." << std::endl;
+        }
+        return 1;
+    }
+
+    MigracionBD::mostrarResultado(resultado);
+    return exito ? 0 : 1;
+}
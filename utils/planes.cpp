@@ -0,0 +1,60 @@
+/**
+ * @file planes.cpp
+ * @brief Programa para detectar regresiones en los planes de ejecución de las sentencias SQL.
+ * @details Este archivo contiene el punto de entrada del programa que utiliza PlanesConsulta para
+ *          verificar el plan de cada sentencia de `Consultas.hpp`. Sin argumentos genera en memoria una
+ *          base de datos sintética grande con estadísticas; con un archivo verifica los planes sobre
+ *          esa base de datos, que debe estar en la versión actual del esquema.
+ *
+ *          Uso: `planes_consulta [-v] [archivo.db]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Database.hpp"
+#include "PlanesConsulta.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: `-v` para mostrar todos los planes (opcional) y archivo de la base de datos (opcional).
+ * @return `int` Código de salida del programa (1 si alguna sentencia tiene un plan inválido).
+ */
+int main(int argc, char* argv[]) {
+    bool detallado = argc > 1 && std::string(argv[1]) == "-v";
+    int primerArgumento = detallado ? 2 : 1;
+    if (argc > primerArgumento + 1) {
+        std::cerr << "Uso: " << argv[0] << " [-v] [archivo.db]" << std::endl;
+        return 1;
+    }
+
+    try {
+        bool generada = argc == primerArgumento;
+        Database db(generada ? ":memory:" : argv[primerArgumento], !generada);
+
+        if (generada) {
+            auto inicio = std::chrono::steady_clock::now();
+            if (!PlanesConsulta::generarBaseDatos(db.get())) {
+                return 1;
+            }
+            std::cout << "Base de datos sintética con " << CLIENTES_BASE_PLANES << " clientes generada en "
+                      << std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() << " s" << std::endl;
+        }
+
+        ResultadoPlanes resultado;
+        bool valido = PlanesConsulta::verificar(db.get(), resultado);
+        PlanesConsulta::mostrarResultado(resultado, detallado);
+        return valido ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file proyeccion.cpp
+ * @brief Programa para proyectar los intereses de la cartera de préstamos y CDP.
+ * @details Este archivo contiene el punto de entrada del programa que utiliza Finanzas para proyectar,
+ *          por moneda, los intereses que ingresan por préstamos y los que se pagan por CDP durante los
+ *          próximos meses. La cartera se carga una sola vez desde "banco.db" y el resumen se guarda
+ *          en un archivo `.csv`.
+ *
+ *          Uso: `proyeccion_cartera <meses> <archivo.csv> [hilos]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Database.hpp"
+#include "ProyeccionCartera.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * Lee los argumentos, carga la cartera, ejecuta la proyección y exporta el resumen, mostrando
+ * el tiempo de cada etapa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: meses a proyectar, archivo de salida y cantidad de hilos (opcional).
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Uso: " << argv[0] << " <meses> <archivo.csv> [hilos]" << std::endl;
+        return 1;
+    }
+
+    try {
+        int meses = std::stoi(argv[1]);
+        std::string nombreArchivo = argv[2];
+        unsigned int hilos = argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : 0;
+
+        if (meses <= 0) {
+            std::cerr << "Error: La cantidad de meses debe ser positiva." << std::endl;
+            return 1;
+        }
+
+        Database db("banco.db"); // Conectar a la base de datos
+
+        // Cargar la cartera en memoria
+        auto inicio = std::chrono::steady_clock::now();
+        ProyeccionCartera proyeccion;
+        if (!proyeccion.cargar(db.get())) {
+            return 1;
+        }
+        auto finCarga = std::chrono::steady_clock::now();
+
+        // Proyectar los intereses
+        std::vector<FilaProyeccion> filas = proyeccion.proyectar(meses, hilos);
+        auto finProyeccion = std::chrono::steady_clock::now();
+
+        if (!ProyeccionCartera::exportarCSV(filas, nombreArchivo)) {
+            return 1;
+        }
+
+        std::cout << "Préstamos activos: " << proyeccion.cantidadPrestamos()
+                  << ", CDP: " << proyeccion.cantidadCDP() << std::endl;
+        std::cout << "Carga: " << std::chrono::duration<double, std::milli>(finCarga - inicio).count() << " ms, "
+                  << "proyección: " << std::chrono::duration<double, std::milli>(finProyeccion - finCarga).count() << " ms" << std::endl;
+        std::cout << "Proyección guardada en " << nombreArchivo << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file simulador.cpp
+ * @brief Programa para simular choques de tasa e impagos sobre la cartera de préstamos.
+ * @details Este archivo contiene el punto de entrada del programa que ejecuta la simulación Monte Carlo
+ *          de la cartera de préstamos activos de "banco.db", muestra la distribución de flujos de caja
+ *          y pérdidas por tipo de préstamo y moneda, y reporta el tiempo por millón de combinaciones
+ *          préstamo-escenario.
+ *
+ *          Uso: `simulador_cartera <escenarios> [archivo.csv] [hilos]`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "Database.hpp"
+#include "SimuladorCartera.hpp"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Función principal del programa.
+ *
+ * Carga los préstamos activos, ejecuta la simulación con los parámetros predeterminados y muestra
+ * el resultado, guardándolo también en un archivo `.csv` si se indica.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: cantidad de escenarios, archivo de salida (opcional) y cantidad de hilos (opcional).
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0] << " <escenarios> [archivo.csv] [hilos]" << std::endl;
+        return 1;
+    }
+
+    try {
+        ParametrosSimulacion parametros = SimulacionDef::PARAMETROS;
+        parametros.escenarios = std::stoi(argv[1]);
+        std::string nombreArchivo = argc > 2 ? argv[2] : "";
+        parametros.hilos = argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : 0;
+
+        if (parametros.escenarios <= 0) {
+            std::cerr << "Error: La cantidad de escenarios debe ser positiva." << std::endl;
+            return 1;
+        }
+
+        Database db("banco.db"); // Conectar a la base de datos
+
+        SimuladorCartera simulador;
+        if (!simulador.cargar(db.get())) {
+            return 1;
+        }
+
+        ResultadoSimulacion resultado = simulador.simular(parametros);
+        SimuladorCartera::mostrarResultado(resultado);
+
+        if (!nombreArchivo.empty() && SimuladorCartera::exportarCSV(resultado, nombreArchivo)) {
+            std::cout << "Resultado guardado en " << nombreArchivo << std::endl;
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
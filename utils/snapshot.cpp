@@ -0,0 +1,124 @@
+/**
+ * @file snapshot.cpp
+ * @brief Programa para exportar y consultar instantáneas columnares de la base de datos.
+ * @details Este archivo contiene el punto de entrada del programa que utiliza SnapshotColumnar para
+ *          exportar una instantánea consistente de "banco.db" sin bloquear las escrituras, y
+ *          LectorSnapshot para mostrar su contenido y recorrer sus columnas como ejemplo de análisis.
+ *
+ *          Uso: `snapshot_columnar exportar <archivo.bcol>` o `snapshot_columnar resumen <archivo.bcol>`
+ *
+ * @author Daniel Alberto Sáenz Obando
+ * @author Rodrigo Madrigal Montes
+ * @copyright MIT License
+ * @date 28/11/2024
+ */
+
+#include "SnapshotColumnar.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Muestra las tablas de una instantánea y recorre algunas columnas.
+ *
+ * Suma el monto de las transacciones por tipo y el saldo de las cuentas por moneda, y muestra el
+ * tiempo de cada recorrido.
+ *
+ * @param nombreArchivo Nombre del archivo de instantánea.
+ * @return `void`
+ */
+static void mostrarResumen(const std::string& nombreArchivo) {
+    LectorSnapshot lector(nombreArchivo);
+
+    std::cout << std::setw(16) << "Tabla" << std::setw(12) << "Filas" << std::setw(8) << "Grupos" << std::setw(10) << "Columnas" << std::endl;
+    for (const TablaSnapshot& tabla : lector.getTablas()) {
+        std::cout << std::setw(16) << tabla.nombre << std::setw(12) << tabla.filas
+                  << std::setw(8) << tabla.grupos.size() << std::setw(10) << tabla.columnas.size() << std::endl;
+    }
+
+    // Monto de las transacciones por tipo
+    auto inicio = std::chrono::steady_clock::now();
+    const TablaSnapshot& transacciones = lector.tabla("Transacciones");
+    size_t columnaTipo = transacciones.columna("tipo");
+    size_t columnaMonto = transacciones.columna("monto");
+    std::vector<double> montos(transacciones.columnas[columnaTipo].diccionario.size(), 0.0);
+    std::vector<uint64_t> cantidades(montos.size(), 0);
+
+    for (size_t g = 0; g < transacciones.grupos.size(); g++) {
+        const uint8_t* tipos = lector.codigos(transacciones, columnaTipo, g);
+        const double* monto = lector.decimales(transacciones, columnaMonto, g);
+        for (uint32_t i = 0; i < transacciones.grupos[g].filas; i++) {
+            montos[tipos[i]] += monto[i];
+            cantidades[tipos[i]]++;
+        }
+    }
+    double milisegundos = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "\nTransacciones por tipo (" << milisegundos << " ms):" << std::endl;
+    for (size_t t = 0; t < montos.size(); t++) {
+        std::cout << std::setw(6) << transacciones.columnas[columnaTipo].diccionario[t]
+                  << std::setw(12) << cantidades[t] << std::setw(20) << std::fixed << std::setprecision(2) << montos[t] << std::endl;
+    }
+
+    // Saldo de las cuentas por moneda
+    const TablaSnapshot& cuentas = lector.tabla("Cuentas");
+    size_t columnaMoneda = cuentas.columna("moneda");
+    size_t columnaSaldo = cuentas.columna("saldo");
+    std::vector<double> saldos(cuentas.columnas[columnaMoneda].diccionario.size(), 0.0);
+
+    for (size_t g = 0; g < cuentas.grupos.size(); g++) {
+        const uint8_t* monedas = lector.codigos(cuentas, columnaMoneda, g);
+        const double* saldo = lector.decimales(cuentas, columnaSaldo, g);
+        for (uint32_t i = 0; i < cuentas.grupos[g].filas; i++) {
+            saldos[monedas[i]] += saldo[i];
+        }
+    }
+
+    std::cout << "\nSaldo de las cuentas por moneda:" << std::endl;
+    for (size_t m = 0; m < saldos.size(); m++) {
+        std::cout << std::setw(6) << cuentas.columnas[columnaMoneda].diccionario[m] << std::setw(20) << saldos[m] << std::endl;
+    }
+}
+
+/**
+ * @brief Función principal del programa.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Argumentos: acción (`exportar` o `resumen`) y archivo de instantánea.
+ * @return `int` Código de salida del programa.
+ */
+int main(int argc, char* argv[]) {
+    std::string accion = argc > 1 ? argv[1] : "";
+    if (argc < 3 || (accion != "exportar" && accion != "resumen")) {
+        std::cerr << "Uso: " << argv[0] << " exportar <archivo.bcol>" << std::endl;
+        std::cerr << "     " << argv[0] << " resumen <archivo.bcol>" << std::endl;
+        return 1;
+    }
+
+    try {
+        std::string nombreArchivo = argv[2];
+
+        if (accion == "exportar") {
+            ResumenSnapshot resumen;
+            if (!SnapshotColumnar::exportar("banco.db", nombreArchivo, resumen)) {
+                return 1;
+            }
+
+            for (const auto& [tabla, filas] : resumen.filas) {
+                std::cout << std::setw(16) << tabla << std::setw(12) << filas << " filas" << std::endl;
+            }
+            std::cout << "Instantánea guardada en " << nombreArchivo << " (" << resumen.bytes << " bytes, "
+                      << resumen.segundos << " s)" << std::endl;
+        } else {
+            mostrarResumen(nombreArchivo);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}